@@ -0,0 +1,123 @@
+#ifndef ARRAY_ARITHMETIC_HPP
+#define ARRAY_ARITHMETIC_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "array/array.hpp"
+
+/**
+ * @brief Element-wise binary operations writing their results to another Array.
+ *
+ * Unlike the in-place operators of Array, the operands may have any numeric
+ * types and shapes, as NumPy ufuncs allow:
+ *
+ * - the result type is promoted from both operand types as by
+ *   ``numpy.result_type`` (int8 and uint8 give int16, int64 and uint64 give
+ *   float64, int32 and float32 give float64, ...), divisions of integers
+ *   give float64 and comparisons give bool;
+ * - shapes are broadcast against each other from their last axis, axes of
+ *   extent 1 being repeated, so that one-item arrays act as scalars. The
+ *   scalar constructors of Array turn C++ numbers into such operands, typed
+ *   as NumPy scalars of the same type.
+ *
+ * Results are written to a new array, laid out as the operand of the same
+ * shape, or to @p out, which must have the broadcast shape and a type the
+ * results can be cast to (``same_kind`` casting: floats are not written to
+ * integers, nor numbers to bool). Operands overlapping @p out are read
+ * before being overwritten, so ``add(a, b, a)`` updates ``a`` in place.
+ *
+ * Items are converted to the computation type by blocks held in cache and
+ * combined by the vectorized kernels of ``arraysimd``; large results are
+ * shared between the threads of utils::ThreadPool::shared().
+ */
+namespace arraymath {
+
+/** @brief Element-wise binary operation, named as the NumPy ufunc it mirrors. */
+enum class Operation {
+    Add,          ///< ``numpy.add``: logical or for bool
+    Subtract,     ///< ``numpy.subtract``: not defined for bool
+    Multiply,     ///< ``numpy.multiply``: logical and for bool
+    Divide,       ///< ``numpy.true_divide``: float64 for integers
+    Minimum,      ///< ``numpy.minimum``: NaN when either item is NaN
+    Maximum,      ///< ``numpy.maximum``: NaN when either item is NaN
+    Equal,        ///< ``numpy.equal``
+    NotEqual,     ///< ``numpy.not_equal``
+    Less,         ///< ``numpy.less``
+    LessEqual,    ///< ``numpy.less_equal``
+    Greater,      ///< ``numpy.greater``
+    GreaterEqual  ///< ``numpy.greater_equal``
+};
+
+/**
+ * @brief Smallest numeric type holding the items of both types, as ``numpy.promote_types``.
+ * @throws std::invalid_argument for string and none types.
+ */
+ArrayTypeId promoteTypes(ArrayTypeId a, ArrayTypeId b);
+
+/**
+ * @brief Type of the results of @p operation on items of types @p a and @p b.
+ * @throws std::invalid_argument for string and none types, and for the subtraction of bools.
+ */
+ArrayTypeId resultType(Operation operation, ArrayTypeId a, ArrayTypeId b);
+
+/**
+ * @brief Shape of the results of operands of shapes @p a and @p b.
+ * @throws std::invalid_argument when an axis differs in both shapes and is not of extent 1 in one of them.
+ */
+std::vector<size_t> broadcastShapes(const std::vector<size_t>& a, const std::vector<size_t>& b);
+
+/** @brief Results of @p operation on the items of @p a and @p b, in a new array. */
+Array apply(Operation operation, const Array& a, const Array& b);
+
+/**
+ * @brief Results of @p operation on the items of @p a and @p b, written to @p out.
+ * @return @p out.
+ * @throws std::invalid_argument when @p out does not have the broadcast shape,
+ * or the results cannot be cast to its type.
+ */
+Array& apply(Operation operation, const Array& a, const Array& b, Array& out);
+
+/** @name Operations by name
+ *  Shortcuts for apply(), with or without an output array.
+ *  @{
+ */
+Array add(const Array& a, const Array& b);
+Array& add(const Array& a, const Array& b, Array& out);
+Array subtract(const Array& a, const Array& b);
+Array& subtract(const Array& a, const Array& b, Array& out);
+Array multiply(const Array& a, const Array& b);
+Array& multiply(const Array& a, const Array& b, Array& out);
+Array divide(const Array& a, const Array& b);
+Array& divide(const Array& a, const Array& b, Array& out);
+Array minimum(const Array& a, const Array& b);
+Array& minimum(const Array& a, const Array& b, Array& out);
+Array maximum(const Array& a, const Array& b);
+Array& maximum(const Array& a, const Array& b, Array& out);
+Array equal(const Array& a, const Array& b);
+Array& equal(const Array& a, const Array& b, Array& out);
+Array notEqual(const Array& a, const Array& b);
+Array& notEqual(const Array& a, const Array& b, Array& out);
+Array less(const Array& a, const Array& b);
+Array& less(const Array& a, const Array& b, Array& out);
+Array lessEqual(const Array& a, const Array& b);
+Array& lessEqual(const Array& a, const Array& b, Array& out);
+Array greater(const Array& a, const Array& b);
+Array& greater(const Array& a, const Array& b, Array& out);
+Array greaterEqual(const Array& a, const Array& b);
+Array& greaterEqual(const Array& a, const Array& b, Array& out);
+/** @} */
+
+} // namespace arraymath
+
+/** @name Out-of-place arithmetic operators
+ *  arraymath::add(), subtract(), multiply() and divide() into new arrays.
+ *  @{
+ */
+Array operator+(const Array& a, const Array& b);
+Array operator-(const Array& a, const Array& b);
+Array operator*(const Array& a, const Array& b);
+Array operator/(const Array& a, const Array& b);
+/** @} */
+
+#endif
@@ -142,6 +142,14 @@ public:
 
     std::shared_ptr<Data> clone() const override;
     std::shared_ptr<Data> copy(bool deep = false) const override;
+    /**
+     * @brief Deep copy stored contiguously in @p order.
+     * @param order ``'C'``, ``'F'`` or ``'A'`` (Fortran order when this array is
+     * Fortran- but not C-contiguous, C order otherwise).
+     * @param threads Maximum number of threads of utils::ThreadPool::shared()
+     * sharing large copies; 0 uses all of them.
+     */
+    Array copyWithOrder(char order, size_t threads = 0) const;
 
     bool hasString() const override;
     bool isNone() const override;
@@ -159,6 +167,7 @@ public:
     std::shared_ptr<Data> take(int64_t index, size_t axis) const override;
     int64_t itemAsInt64(const std::vector<size_t>& indices) const override;
     void setItemFromInt64(const std::vector<size_t>& indices, int64_t value) override;
+    double itemAsDouble(const std::vector<size_t>& indices) const override;
 
     bool isContiguous() const;
     bool isContiguousInStyleC() const;
@@ -211,6 +220,34 @@ public:
     size_t getFlatIndex(const std::vector<size_t>& indices) const;
 
     std::string extractString() const override;
+    std::string_view stringView(std::string& buffer) const override;
+
+    bool satisfies(const ValuePredicate& predicate) const override;
+
+    bool isCloseTo(
+        const Data& other,
+        double relativeTolerance = 0.0,
+        double absoluteTolerance = 0.0) const override;
+    std::uint64_t fingerprint() const override;
+
+    /**
+     * @brief Reduce every item to a one-item Array, as Data::reduce defines it.
+     *
+     * Runs of contiguous items go through the vectorized kernels of
+     * arraysimd: floating-point sums are pairwise, and the items of large
+     * arrays are shared between the threads of utils::ThreadPool::shared().
+     */
+    std::shared_ptr<Data> reduce(Reduction reduction, bool skipNaN = false) const override;
+    CountedReduction reduceCounted(Reduction reduction, bool skipNaN = false) const override;
+    /**
+     * @brief Reduce the items along @p axis, as Data::reduceAlong defines it.
+     *
+     * Each output item is reduced from a contiguous run by the same kernels
+     * as reduce() when @p axis is the fastest-varying one in memory;
+     * otherwise whole slices are walked in memory order and floating-point
+     * sums are compensated (Kahan-Neumaier, in double precision).
+     */
+    std::shared_ptr<Data> reduceAlong(size_t axis, Reduction reduction, bool skipNaN = false) const override;
 
     std::vector<size_t> strides() const { return this->_strides; }
 
@@ -280,67 +317,27 @@ private:
 
     template <typename T>
     Array& setElementsFrom(const Array& other);
-    template <typename T>
-    Array& setElementsOfThisContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& setElementsOfThisContiguousUsingNonContiguous(const Array& other);
-    template <typename T>
-    Array& setElementsOfThisNonContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& setElementsOfThisNonContiguousUsingNonContiguous(const Array& other);
 
     template <typename T>
     Array& increaseElementsBy(const T& scalar);
 
     template <typename T>
     Array& increaseElementsFrom(const Array& other);
-    template <typename T>
-    Array& increaseElementsOfThisContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& increaseElementsOfThisContiguousUsingNonContiguous(const Array& other);
-    template <typename T>
-    Array& increaseElementsOfThisNonContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& increaseElementsOfThisNonContiguousUsingNonContiguous(const Array& other);
 
     template <typename T>
     Array& decreaseElementsFrom(const Array& other);
-    template <typename T>
-    Array& decreaseElementsOfThisContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& decreaseElementsOfThisContiguousUsingNonContiguous(const Array& other);
-    template <typename T>
-    Array& decreaseElementsOfThisNonContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& decreaseElementsOfThisNonContiguousUsingNonContiguous(const Array& other);
 
     template <typename T>
     Array& multiplyElementsBy(const T& scalar);
 
     template <typename T>
     Array& multiplyElementsFrom(const Array& other);
-    template <typename T>
-    Array& multiplyElementsOfThisContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& multiplyElementsOfThisContiguousUsingNonContiguous(const Array& other);
-    template <typename T>
-    Array& multiplyElementsOfThisNonContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& multiplyElementsOfThisNonContiguousUsingNonContiguous(const Array& other);
 
     template <typename T>
     Array& divideElementsBy(const T& scalar);
 
     template <typename T>
     Array& divideElementsFrom(const Array& other);
-    template <typename T>
-    Array& divideElementsOfThisContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& divideElementsOfThisContiguousUsingNonContiguous(const Array& other);
-    template <typename T>
-    Array& divideElementsOfThisNonContiguousUsingContiguous(const Array& other);
-    template <typename T>
-    Array& divideElementsOfThisNonContiguousUsingNonContiguous(const Array& other);
 
     template <typename T>
     Array getItemAsArrayAtIndex(const size_t& flatIndex);
@@ -359,6 +356,9 @@ private:
     template <typename T>
     bool hasAllItemsEqualToThoseIn(const Array& other) const;
 
+    template <typename T>
+    bool hasAllItemsCloseToThoseIn(const Array& other, double relativeTolerance, double absoluteTolerance) const;
+
     template <typename T>
     bool hasAllItemsEqualTo(const T& scalar) const;
 
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "array/array.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace arrayfactory {
 
@@ -74,7 +75,9 @@ namespace arrayfactory {
     Array full(const std::vector<size_t>& shape, T fill_value, const char order) {
         Array array = empty<T>(shape, order);
         T* data = array.getPointerOfModifiableDataFast<T>();
-        std::fill(data, data + array.size(), fill_value);
+        utils::forEachRange(array.size(), sizeof(T), [&](size_t begin, size_t end) {
+            std::fill(data + begin, data + end, fill_value);
+        });
         return array;
     }
 
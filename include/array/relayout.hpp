@@ -0,0 +1,54 @@
+#ifndef ARRAY_RELAYOUT_HPP
+#define ARRAY_RELAYOUT_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "array/array.hpp"
+
+/**
+ * @brief Kernels copying n-dimensional strided blocks between memory layouts.
+ *
+ * Used for C/Fortran order conversions (Array::copyWithOrder, Array::ravel,
+ * CGNS/HDF5 IO). Axes are reordered and merged before copying, so the
+ * innermost loop always writes the destination sequentially. When the source
+ * is fastest along another axis, the two axes are transposed tile by tile to
+ * keep both sides in cache.
+ */
+namespace arraylayout {
+
+/**
+ * @brief Byte strides of a contiguous array of shape @p shape in @p order.
+ * @param order ``'C'`` or ``'F'``.
+ */
+std::vector<size_t> contiguousStrides(const std::vector<size_t>& shape, size_t itemsize, char order);
+
+/**
+ * @brief Copy every item of a strided block into another strided block.
+ *
+ * Both blocks have shape @p shape; strides are in bytes and the blocks must
+ * not overlap.
+ *
+ * @param itemsize Item size in bytes; 1, 2, 4 and 8 bytes use typed kernels.
+ * @param threads Maximum number of threads of utils::ThreadPool::shared()
+ * sharing large copies; 0 uses all of them. Small copies always run on the
+ * calling thread.
+ */
+void copyStrided(
+    const void* source,
+    const std::vector<size_t>& sourceStrides,
+    void* destination,
+    const std::vector<size_t>& destinationStrides,
+    const std::vector<size_t>& shape,
+    size_t itemsize,
+    size_t threads = 1);
+
+/**
+ * @brief Copy the items of @p source into the contiguous buffer @p destination laid out in @p order.
+ * @param order ``'C'`` or ``'F'``.
+ */
+void copyToContiguous(const Array& source, void* destination, char order, size_t threads = 1);
+
+} // namespace arraylayout
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef ARRAY_SIMD_HPP
+#define ARRAY_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Vectorized kernels over contiguous runs of items, used by the Array operators.
+ *
+ * Each kernel is compiled for several instruction sets and the widest one
+ * supported by the running processor is picked on first use: AVX-512 and
+ * AVX2 on x86-64, 128-bit vectors (SSE2 or NEON) with GCC and Clang, and
+ * plain loops otherwise. Results do not depend on the level used, except
+ * for the rounding of floating-point sums, whose items are added in another
+ * order by each vector width.
+ *
+ * Kernels are instantiated for the eleven numeric types of Array (bool
+ * only for the comparisons and reductions).
+ */
+namespace arraysimd {
+
+/** @brief Instruction sets the kernels are compiled for, from the narrowest. */
+enum class Level {
+    Portable,  ///< one item at a time
+    Vector128, ///< 128-bit vectors: SSE2 on x86-64, NEON on ARM
+    AVX2,      ///< 256-bit vectors
+    AVX512     ///< 512-bit vectors (AVX-512F and AVX-512BW)
+};
+
+/** @brief Widest level supported by both the build and the running processor. */
+Level supportedLevel();
+
+/** @brief Level used by the kernels: supportedLevel() unless lowered by useLevel(). */
+Level activeLevel();
+
+/**
+ * @brief Run the kernels at @p level, for benchmarks and tests.
+ * @throws std::invalid_argument when @p level is not supported.
+ */
+void useLevel(Level level);
+
+/** @brief Lowercase name of @p level (``"portable"``, ``"sse2"`` or ``"neon"``, ``"avx2"``, ``"avx512"``). */
+const char* levelName(Level level);
+
+/**
+ * @brief In-place arithmetic applied by apply() and applyScalar().
+ *
+ * Minimum and Maximum return NaN when either item is NaN, as np.minimum and
+ * np.maximum do.
+ */
+enum class Operation { Add, Subtract, Multiply, Divide, Minimum, Maximum };
+
+/** @brief Item comparison computed by compare(). */
+enum class Comparison { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual };
+
+/** @brief values[i] = values[i] (op) others[i], for i < count. */
+template <typename T>
+void apply(Operation operation, T* values, const T* others, size_t count);
+
+/** @brief values[i] = values[i] (op) scalar, for i < count. */
+template <typename T>
+void applyScalar(Operation operation, T* values, T scalar, size_t count);
+
+/**
+ * @brief results[i] = values[i] (comparison) others[i], for i < count.
+ *
+ * Items are compared exactly, so that comparisons with NaN are false except
+ * NotEqual.
+ */
+template <typename T>
+void compare(Comparison comparison, const T* values, const T* others, bool* results, size_t count);
+
+/** @brief True when utils::approxEqual(values[i], others[i]) holds for every i < count. */
+template <typename T>
+bool allEqual(const T* values, const T* others, size_t count);
+
+/** @brief True when utils::approxEqual(values[i], scalar) holds for every i < count. */
+template <typename T>
+bool allEqualTo(const T* values, T scalar, size_t count);
+
+/** @brief True when utils::approxEqual(values[i], others[i]) holds for some i < count. */
+template <typename T>
+bool anyEqual(const T* values, const T* others, size_t count);
+
+/**
+ * @brief True when every pair of items is close, as Data::isCloseTo defines it.
+ *
+ * Items are equal, both NaN, or differ by at most @p absoluteTolerance +
+ * @p relativeTolerance times the larger magnitude, computed in double.
+ * With both tolerances zero, only equal items (or NaN pairs) are close.
+ */
+template <typename T>
+bool allClose(const T* values, const T* others, size_t count,
+              double relativeTolerance, double absoluteTolerance);
+
+/** @brief Type of sum(): int64 for bool and signed integers, uint64 for unsigned ones, T for floating point. */
+template <typename T>
+using SumOf = std::conditional_t<std::is_floating_point_v<T>, T,
+    std::conditional_t<std::is_unsigned_v<T> && !std::is_same_v<T, bool>, std::uint64_t, std::int64_t>>;
+
+/**
+ * @brief Sum of values[i] for i < count.
+ *
+ * Floating-point items are added by pairwise summation of blocks of vectors,
+ * integers wrap around as in NumPy. With @p skipNaN, NaN items count as zero.
+ */
+template <typename T>
+SumOf<T> sum(const T* values, size_t count, bool skipNaN);
+
+/** @brief Sum of the squares of values[i] for i < count, computed in double like sum(). */
+template <typename T>
+double sumOfSquares(const T* values, size_t count, bool skipNaN);
+
+/**
+ * @brief Smallest of values[i] for i < count.
+ *
+ * NaN when an item is NaN, unless @p skipNaN is set: NaN items are then
+ * ignored. The largest value of @p T (infinity for floating point) when no
+ * item is left.
+ */
+template <typename T>
+T minimum(const T* values, size_t count, bool skipNaN);
+
+/** @brief Largest of values[i] for i < count, as minimum() defines the smallest. */
+template <typename T>
+T maximum(const T* values, size_t count, bool skipNaN);
+
+/** @brief Number of NaN items among values[i] for i < count (0 for integers). */
+template <typename T>
+size_t countNaN(const T* values, size_t count);
+
+/** @brief Number of items equal to zero among values[i] for i < count. */
+template <typename T>
+size_t countZeros(const T* values, size_t count);
+
+/** @brief Smallest i < count with values[i] == @p value (values[i] NaN when @p value is), or count. */
+template <typename T>
+size_t find(const T* values, size_t count, T value);
+
+} // namespace arraysimd
+
+#endif
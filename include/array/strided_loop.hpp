@@ -0,0 +1,383 @@
+#ifndef ARRAY_STRIDED_LOOP_HPP
+#define ARRAY_STRIDED_LOOP_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "array/array.hpp"
+#include "utils/thread_pool.hpp"
+
+/**
+ * @brief Element-wise loops over strided arrays, one row at a time.
+ *
+ * Used by the Array modifiers and comparisons. The items of the operands
+ * are paired by their C-order flat index, as Array::getItemAtIndex does for
+ * strided views, but instead of computing each offset from the flat index
+ * the axes of the operands are merged once into a short list of common
+ * axes, and every row of the innermost axis is walked with a constant
+ * stride, so sliced and transposed views cost a pointer increment per item.
+ */
+namespace arrayiter {
+
+/** @brief Axis of a loop: its extent and the byte stride of each operand along it. */
+template <size_t Operands>
+struct Axis {
+    size_t extent;
+    std::array<size_t, Operands> strides;
+};
+
+/**
+ * @brief Common axes of arrays of the same size, outermost first.
+ *
+ * Axes of extent 1 are dropped and consecutive axes are merged when they
+ * are contiguous in every operand. Operands of different shapes are paired
+ * by flat index when their axes can be split into common ones (e.g. shapes
+ * (2, 6) and (4, 3)); otherwise paired() is false.
+ *
+ * When @p anyOrder is set, the axes are also sorted from the largest to the
+ * smallest stride of the first operand, so that rows follow its memory
+ * order, and when the second operand is fastest along another axis the two
+ * axes are walked tile by tile. Leave it unset when a written operand
+ * overlaps another one, to keep visiting the items in flat index order.
+ */
+template <size_t Operands>
+class StridedLoop {
+
+public:
+    StridedLoop(const std::array<const Array*, Operands>& arrays, bool anyOrder);
+
+    /** @brief False when the operands have incompatible shapes. */
+    bool paired() const { return _paired; }
+
+    const std::vector<Axis<Operands>>& axes() const { return _axes; }
+
+    /**
+     * @brief Call @p row(offsets, strides, count) for each row of the innermost axis.
+     *
+     * @p offsets are the byte offsets of the first item of the row in each
+     * operand and @p strides their byte strides along the row. Stops and
+     * returns false as soon as @p row returns false.
+     */
+    template <typename Row>
+    bool forEachRow(Row&& row) const {
+        return forEachRow(row, 0, outerRows());
+    }
+
+    /**
+     * @brief Number of positions along the outer axes, each one holding one
+     * row, or one tile of rows when the last two axes are walked by tiles.
+     */
+    size_t outerRows() const {
+        size_t outerCount = _axes.empty() ? 0 : 1;
+        for (size_t dim = 0; dim < outerAxes(); ++dim) {
+            outerCount *= _axes[dim].extent;
+        }
+        return outerCount;
+    }
+
+    /** @brief Same as forEachRow(row), for the outer positions in [@p begin, @p end) only. */
+    template <typename Row>
+    bool forEachRow(Row&& row, size_t begin, size_t end) const {
+        const size_t outer = outerAxes();
+        std::array<size_t, Operands> offsets{};
+        std::vector<size_t> position(outer, 0);
+        for (size_t dim = outer, rest = begin; dim-- > 0;) {
+            position[dim] = rest % _axes[dim].extent;
+            rest /= _axes[dim].extent;
+            for (size_t k = 0; k < Operands; ++k) {
+                offsets[k] += position[dim] * _axes[dim].strides[k];
+            }
+        }
+        for (size_t n = begin; n < end; ++n) {
+            const bool completed = _tiled
+                ? forEachRowOfTiles(offsets, row)
+                : row(offsets, _axes.back().strides, _axes.back().extent);
+            if (!completed) {
+                return false;
+            }
+            for (size_t dim = outer; dim-- > 0;) {
+                for (size_t k = 0; k < Operands; ++k) {
+                    offsets[k] += _axes[dim].strides[k];
+                }
+                if (++position[dim] < _axes[dim].extent) {
+                    break;
+                }
+                for (size_t k = 0; k < Operands; ++k) {
+                    offsets[k] -= position[dim] * _axes[dim].strides[k];
+                }
+                position[dim] = 0;
+            }
+        }
+        return true;
+    }
+
+private:
+    // tiles of 32x32 items keep the rows of both operands in cache when they are transposed
+    static constexpr size_t kTileEdge = 32;
+
+    std::vector<Axis<Operands>> _axes;
+    bool _paired = true;
+    bool _tiled = false;
+
+    size_t outerAxes() const { return _axes.empty() ? 0 : _axes.size() - (_tiled ? 2 : 1); }
+
+    /** Rows of the last two axes, one square tile at a time. */
+    template <typename Row>
+    bool forEachRowOfTiles(const std::array<size_t, Operands>& base, Row& row) const {
+        const Axis<Operands>& rows = _axes[_axes.size() - 2];
+        const Axis<Operands>& columns = _axes.back();
+        std::array<size_t, Operands> offsets;
+        for (size_t row0 = 0; row0 < rows.extent; row0 += kTileEdge) {
+            const size_t rowEnd = std::min(rows.extent, row0 + kTileEdge);
+            for (size_t column0 = 0; column0 < columns.extent; column0 += kTileEdge) {
+                const size_t count = std::min(kTileEdge, columns.extent - column0);
+                for (size_t r = row0; r < rowEnd; ++r) {
+                    for (size_t k = 0; k < Operands; ++k) {
+                        offsets[k] = base[k] + r * rows.strides[k] + column0 * columns.strides[k];
+                    }
+                    if (!row(offsets, columns.strides, count)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+
+/** True when the byte ranges spanned by @p a and @p b intersect. */
+bool overlap(const Array& a, const Array& b);
+
+/** @p other as a C-ordered vector, pairable with any array of its size. */
+std::shared_ptr<Array> flattened(const Array& other);
+
+/**
+ * @brief Apply @p op(item) to every item of @p array, in place.
+ *
+ * Runs of contiguous items are handed to @p rows(values, count) instead,
+ * for kernels that process a whole run at once.
+ */
+template <typename T, typename Op, typename Rows>
+void forEachItem(Array& array, Op&& op, Rows&& rows) {
+    auto* bytes = static_cast<std::uint8_t*>(array.rawData());
+    if (array.isContiguous()) {
+        T* values = reinterpret_cast<T*>(bytes);
+        utils::forEachRange(array.size(), sizeof(T), [&](size_t begin, size_t end) noexcept(noexcept(rows(values, end))) {
+            rows(values + begin, end - begin);
+        });
+        return;
+    }
+    const StridedLoop<1> loop({&array}, true);
+    const size_t outerRows = loop.outerRows();
+    utils::forEachRange(outerRows, outerRows == 0 ? 0 : array.size() / outerRows * sizeof(T), [&](size_t begin, size_t end) {
+        loop.forEachRow([&](const std::array<size_t, 1>& offsets, const std::array<size_t, 1>& strides, size_t count) {
+            std::uint8_t* item = bytes + offsets[0];
+            if (strides[0] == sizeof(T)) {
+                rows(reinterpret_cast<T*>(item), count);
+                return true;
+            }
+            for (size_t i = 0; i < count; ++i, item += strides[0]) {
+                op(*reinterpret_cast<T*>(item));
+            }
+            return true;
+        }, begin, end);
+    });
+}
+
+/** @brief Apply @p op(item) to every item of @p array, in place. */
+template <typename T, typename Op>
+void forEachItem(Array& array, Op&& op) {
+    forEachItem<T>(array, op, [&op](T* values, size_t count) noexcept(noexcept(op(*values))) {
+        for (size_t i = 0; i < count; ++i) {
+            op(values[i]);
+        }
+    });
+}
+
+/**
+ * @brief Apply @p op(item, otherItem) to the items of @p array and @p other paired by flat index.
+ *
+ * @p array is written in place. Runs of contiguous items are handed to
+ * @p rows(values, otherValues, count), unless @p other overlaps @p array
+ * elsewhere than on the same items: the items are then visited one at a
+ * time in flat index order.
+ */
+template <typename T, typename Op, typename Rows>
+void forEachPair(Array& array, const Array& other, Op&& op, Rows&& rows) {
+    auto* bytes = static_cast<std::uint8_t*>(array.rawData());
+    const auto* otherBytes = static_cast<const std::uint8_t*>(other.rawData());
+    const bool separate = !overlap(array, other);
+    if (array.isContiguousInStyleC() && other.isContiguousInStyleC() && (separate || bytes == otherBytes)) {
+        T* values = reinterpret_cast<T*>(bytes);
+        const T* otherValues = reinterpret_cast<const T*>(otherBytes);
+        utils::forEachRange(array.size(), sizeof(T), [&](size_t begin, size_t end) noexcept(noexcept(rows(values, otherValues, end))) {
+            rows(values + begin, otherValues + begin, end - begin);
+        });
+        return;
+    }
+    const StridedLoop<2> loop({&array, &other}, separate);
+    if (!loop.paired()) {
+        forEachPair<T>(array, *flattened(other), op, rows);
+        return;
+    }
+    auto forRows = [&](size_t begin, size_t end) {
+        loop.forEachRow([&](const std::array<size_t, 2>& offsets, const std::array<size_t, 2>& strides, size_t count) {
+            std::uint8_t* item = bytes + offsets[0];
+            const std::uint8_t* otherItem = otherBytes + offsets[1];
+            if (separate && strides[0] == sizeof(T) && strides[1] == sizeof(T)) {
+                rows(reinterpret_cast<T*>(item), reinterpret_cast<const T*>(otherItem), count);
+                return true;
+            }
+            for (size_t i = 0; i < count; ++i, item += strides[0], otherItem += strides[1]) {
+                op(*reinterpret_cast<T*>(item), *reinterpret_cast<const T*>(otherItem));
+            }
+            return true;
+        }, begin, end);
+    };
+    // overlapping operands keep the flat index order, on one thread
+    const size_t outerRows = loop.outerRows();
+    if (separate && outerRows > 0) {
+        utils::forEachRange(outerRows, array.size() / outerRows * sizeof(T), forRows);
+    } else {
+        forRows(0, outerRows);
+    }
+}
+
+/** @brief Apply @p op(item, otherItem) to the items of @p array and @p other paired by flat index. */
+template <typename T, typename Op>
+void forEachPair(Array& array, const Array& other, Op&& op) {
+    forEachPair<T>(array, other, op, [&op](T* values, const T* otherValues, size_t count) noexcept(noexcept(op(*values, *otherValues))) {
+        for (size_t i = 0; i < count; ++i) {
+            op(values[i], otherValues[i]);
+        }
+    });
+}
+
+/**
+ * @brief True when @p test(item) holds for some item of @p array.
+ *
+ * Runs of contiguous items are handed to @p rows(values, count), which
+ * returns true when @p test holds for one of them.
+ */
+template <typename T, typename Test, typename Rows>
+bool anyItem(const Array& array, Test&& test, Rows&& rows) {
+    const auto* bytes = static_cast<const std::uint8_t*>(array.rawData());
+    // ranges give up as soon as another one found an item
+    std::atomic<bool> found{false};
+    if (array.isContiguous()) {
+        const T* values = reinterpret_cast<const T*>(bytes);
+        utils::forEachRange(array.size(), sizeof(T), [&](size_t begin, size_t end) noexcept(noexcept(rows(values, end))) {
+            if (!found.load(std::memory_order_relaxed) && rows(values + begin, end - begin)) {
+                found.store(true, std::memory_order_relaxed);
+            }
+        });
+        return found.load();
+    }
+    const StridedLoop<1> loop({&array}, true);
+    const size_t outerRows = loop.outerRows();
+    utils::forEachRange(outerRows, outerRows == 0 ? 0 : array.size() / outerRows * sizeof(T), [&](size_t begin, size_t end) {
+        loop.forEachRow([&](const std::array<size_t, 1>& offsets, const std::array<size_t, 1>& strides, size_t count) {
+            if (found.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            const std::uint8_t* item = bytes + offsets[0];
+            bool foundHere = false;
+            if (strides[0] == sizeof(T)) {
+                foundHere = rows(reinterpret_cast<const T*>(item), count);
+            }
+            for (size_t i = 0; i < count && !foundHere && strides[0] != sizeof(T); ++i, item += strides[0]) {
+                foundHere = test(*reinterpret_cast<const T*>(item));
+            }
+            if (foundHere) {
+                found.store(true, std::memory_order_relaxed);
+            }
+            return !foundHere;
+        }, begin, end);
+    });
+    return found.load();
+}
+
+/** @brief True when @p test(item) holds for some item of @p array. */
+template <typename T, typename Test>
+bool anyItem(const Array& array, Test&& test) {
+    return anyItem<T>(array, test, [&test](const T* values, size_t count) noexcept(noexcept(test(*values))) {
+        for (size_t i = 0; i < count; ++i) {
+            if (test(values[i])) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+/**
+ * @brief True when @p test(item, otherItem) holds for some pair of items of @p array and @p other.
+ *
+ * Runs of contiguous items are handed to @p rows(values, otherValues,
+ * count), which returns true when @p test holds for one of their pairs.
+ */
+template <typename T, typename Test, typename Rows>
+bool anyPair(const Array& array, const Array& other, Test&& test, Rows&& rows) {
+    const auto* bytes = static_cast<const std::uint8_t*>(array.rawData());
+    const auto* otherBytes = static_cast<const std::uint8_t*>(other.rawData());
+    std::atomic<bool> found{false};
+    if (array.isContiguousInStyleC() && other.isContiguousInStyleC()) {
+        const T* values = reinterpret_cast<const T*>(bytes);
+        const T* otherValues = reinterpret_cast<const T*>(otherBytes);
+        utils::forEachRange(array.size(), sizeof(T), [&](size_t begin, size_t end) noexcept(noexcept(rows(values, otherValues, end))) {
+            if (!found.load(std::memory_order_relaxed) && rows(values + begin, otherValues + begin, end - begin)) {
+                found.store(true, std::memory_order_relaxed);
+            }
+        });
+        return found.load();
+    }
+    const StridedLoop<2> loop({&array, &other}, true);
+    if (!loop.paired()) {
+        return anyPair<T>(array, *flattened(other), test, rows);
+    }
+    const size_t outerRows = loop.outerRows();
+    utils::forEachRange(outerRows, outerRows == 0 ? 0 : array.size() / outerRows * sizeof(T), [&](size_t begin, size_t end) {
+        loop.forEachRow([&](const std::array<size_t, 2>& offsets, const std::array<size_t, 2>& strides, size_t count) {
+            if (found.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            const std::uint8_t* item = bytes + offsets[0];
+            const std::uint8_t* otherItem = otherBytes + offsets[1];
+            const bool unitStrides = strides[0] == sizeof(T) && strides[1] == sizeof(T);
+            bool foundHere = false;
+            if (unitStrides) {
+                foundHere = rows(reinterpret_cast<const T*>(item), reinterpret_cast<const T*>(otherItem), count);
+            }
+            for (size_t i = 0; i < count && !foundHere && !unitStrides; ++i, item += strides[0], otherItem += strides[1]) {
+                foundHere = test(*reinterpret_cast<const T*>(item), *reinterpret_cast<const T*>(otherItem));
+            }
+            if (foundHere) {
+                found.store(true, std::memory_order_relaxed);
+            }
+            return !foundHere;
+        }, begin, end);
+    });
+    return found.load();
+}
+
+/** @brief True when @p test(item, otherItem) holds for some pair of items of @p array and @p other. */
+template <typename T, typename Test>
+bool anyPair(const Array& array, const Array& other, Test&& test) {
+    return anyPair<T>(array, other, test, [&test](const T* values, const T* otherValues, size_t count) noexcept(noexcept(test(*values, *otherValues))) {
+        for (size_t i = 0; i < count; ++i) {
+            if (test(values[i], otherValues[i])) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+} // namespace arrayiter
+
+#endif
@@ -64,6 +64,13 @@ public:
         bool appendContainerToFieldName = false,
         bool ravel = false) const;
 
+    /** @brief Reduce a field over every zone, see reduceFieldOverZones. */
+    double reduceField(
+        const std::string& fieldName,
+        Data::Reduction reduction,
+        const std::string& container = "FlowSolution",
+        bool skipNaN = false) const;
+
     void assertFieldsSizeCoherency() const;
     void removeEmptyZones();
 };
@@ -98,6 +98,26 @@ public:
     std::string inferLocation(const std::string& container) const;
     bool hasFields() const;
 
+    /**
+     * @brief Payload of an existing field, loaded if it was read lazily.
+     *
+     * @throws std::runtime_error if the container or the field does not exist.
+     */
+    std::shared_ptr<Data> existingField(
+        const std::string& fieldName,
+        const std::string& container = "FlowSolution") const;
+
+    /**
+     * @brief Reduce every item of an existing field, see Data::reduce.
+     *
+     * @throws std::runtime_error if the container or the field does not exist.
+     */
+    double reduceField(
+        const std::string& fieldName,
+        Data::Reduction reduction,
+        const std::string& container = "FlowSolution",
+        bool skipNaN = false) const;
+
     ShapePair getArrayShapes() const;
     void updateShape();
     bool isEmpty() const;
@@ -130,4 +150,22 @@ std::shared_ptr<Zone> newZoneFromArrays(
     const std::vector<std::string>& arrayNames,
     const std::vector<std::shared_ptr<Data>>& arrays);
 
+/**
+ * @brief Reduce a field over several zones as if their items were joined.
+ *
+ * Each zone is read once, with Data::reduceCounted for means, and the
+ * results are combined: sums and counts add up, means are the total sum over
+ * the total count and norms the root of the sum of squared norms. Zones with
+ * no item (or only skipped NaN) are left out of minima and maxima.
+ *
+ * @throws std::invalid_argument for ArgMin and ArgMax, whose flat indices do
+ * not carry over between zones, and for the extrema of no zone or no item.
+ */
+double reduceFieldOverZones(
+    const std::vector<std::shared_ptr<Zone>>& zones,
+    const std::string& fieldName,
+    Data::Reduction reduction,
+    const std::string& container = "FlowSolution",
+    bool skipNaN = false);
+
 #endif
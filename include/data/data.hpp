@@ -2,11 +2,14 @@
 # define DATA_HPP
 
 # include <string>
+# include <string_view>
 # include <memory>
 # include <cstdint>
 # include <type_traits>
 # include <vector>
 
+# include "data/value_predicate.hpp"
+
 /**
  * @brief Abstract interface for payload values attached to Node instances.
  *
@@ -16,6 +19,26 @@
 class Data {
 
 public:
+    /** @brief Reductions computed by reduce() and reduceAlong(), named after their NumPy counterparts. */
+    enum class Reduction {
+        Sum,    ///< sum of the elements
+        Min,    ///< smallest element
+        Max,    ///< largest element
+        Mean,   ///< arithmetic mean
+        Norm,   ///< Euclidean norm, the square root of the sum of squares
+        ArgMin, ///< index of the first smallest element
+        ArgMax, ///< index of the first largest element
+        Any,    ///< whether some element is non-zero
+        All,    ///< whether every element is non-zero
+        Count   ///< number of elements, NaN excluded when they are skipped
+    };
+
+    /** @brief Result of reduceCounted(). */
+    struct CountedReduction {
+        std::shared_ptr<Data> value; ///< result of reduce()
+        size_t items = 0;            ///< elements reduced, as Count counts them
+    };
+
     /** @brief Virtual destructor for polymorphic use. */
     virtual ~Data() = default;
 
@@ -76,9 +99,81 @@ public:
      * @param value New value converted to payload dtype.
      */
     virtual void setItemFromInt64(const std::vector<size_t>& indices, int64_t value) = 0;
+    /**
+     * @brief Read one element at multidimensional indices and cast to double.
+     * @param indices Index tuple with one index per dimension.
+     */
+    virtual double itemAsDouble(const std::vector<size_t>& indices) const = 0;
 
     /** @brief Extract payload as UTF-8 string when available. */
     virtual std::string extractString() const = 0;
+    /**
+     * @brief Same text as extractString(), without allocating when possible.
+     *
+     * The view points into the payload or into @p buffer, whose capacity is
+     * reused from one call to the next; it is valid until either changes.
+     */
+    virtual std::string_view stringView(std::string& buffer) const = 0;
+
+    /**
+     * @brief True when the numeric elements satisfy @p predicate.
+     *
+     * Evaluated on the typed elements, without conversion; None, empty and
+     * string payloads never satisfy a predicate.
+     */
+    virtual bool satisfies(const ValuePredicate& predicate) const = 0;
+
+    /**
+     * @brief True when @p other holds the same value, up to a tolerance.
+     *
+     * Numbers must have the same dtype and shape, and pairs of elements
+     * differ by at most @p absoluteTolerance + @p relativeTolerance times the
+     * larger magnitude; NaN matches NaN. Strings compare by text, and None
+     * only matches None. The comparison stops at the first differing element.
+     */
+    virtual bool isCloseTo(
+        const Data& other,
+        double relativeTolerance = 0.0,
+        double absoluteTolerance = 0.0) const = 0;
+
+    /**
+     * @brief Stable hash of the value: dtype, shape and elements in C order.
+     *
+     * The same values hash equal whatever the memory layout; strings hash
+     * their text. Used by Node::fingerprint.
+     */
+    virtual std::uint64_t fingerprint() const = 0;
+
+    /**
+     * @brief Reduce every numeric element to a one-element payload.
+     *
+     * Results are typed as in NumPy: sums are int64 for bool and signed
+     * integers and uint64 for unsigned ones, means and norms of integers are
+     * float64, ArgMin, ArgMax and Count are int64, Any and All are bool, and
+     * other results keep the dtype. ArgMin and ArgMax give a C-order flat
+     * index. NaN elements propagate, or are ignored with @p skipNaN, as by
+     * ``numpy.nansum`` and its siblings.
+     *
+     * @throws std::invalid_argument for None and string payloads, for Min,
+     * Max, ArgMin and ArgMax of empty payloads, and for ArgMin and ArgMax
+     * when every element is a skipped NaN.
+     */
+    virtual std::shared_ptr<Data> reduce(Reduction reduction, bool skipNaN = false) const = 0;
+    /**
+     * @brief reduce() together with the number of elements it reduced, counted in the same pass.
+     *
+     * The counts let the results of several payloads be combined without
+     * reading them again, as means over several zones are.
+     */
+    virtual CountedReduction reduceCounted(Reduction reduction, bool skipNaN = false) const = 0;
+    /**
+     * @brief Reduce the elements along @p axis, as reduce() reduces all of them.
+     *
+     * The result has the shape of this payload without @p axis (``{1}`` for
+     * vectors) and its memory order; ArgMin and ArgMax give indices along
+     * @p axis.
+     */
+    virtual std::shared_ptr<Data> reduceAlong(size_t axis, Reduction reduction, bool skipNaN = false) const = 0;
 
     /** @brief Detailed payload description for debugging/logging. */
     virtual std::string info() const = 0;
@@ -0,0 +1,133 @@
+# ifndef DEFERRED_DATA_HPP
+# define DEFERRED_DATA_HPP
+
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <string>
+# include <vector>
+
+# include "data/data.hpp"
+
+/**
+ * @brief Placeholder payload whose content is loaded on first access.
+ *
+ * A DeferredData knows the shape and dtype of the payload it stands for, so
+ * metadata queries (shape, size, dtype, shortInfo...) never trigger a load.
+ * Any access to the payload values calls the loader once and forwards to the
+ * loaded Data; the result is cached and shared by all clones.
+ *
+ * An optional slab loader lets take() read only the requested slice while the
+ * payload is not loaded yet.
+ *
+ * Node::dataPtr() returns the loaded counterpart of a deferred payload, so
+ * callers downcasting the returned pointer always see the concrete Data type.
+ */
+class DeferredData : public Data {
+
+public:
+    /** @brief Callable producing the actual payload. */
+    using Loader = std::function<std::shared_ptr<Data>()>;
+    /**
+     * @brief Callable producing the rectangular block of the payload starting
+     * at ``start`` with extents ``count`` (one entry per axis).
+     */
+    using SlabLoader = std::function<std::shared_ptr<Data>(
+        const std::vector<size_t>& start, const std::vector<size_t>& count)>;
+
+    /**
+     * @brief Build a placeholder from payload metadata.
+     * @param loader Callable invoked once, on first payload access.
+     * @param shape Shape of the payload once loaded.
+     * @param dtypeName Dtype name of the payload once loaded (for example ``float64``).
+     * @param isString True when the payload is textual.
+     */
+    DeferredData(Loader loader,
+                 const std::vector<size_t>& shape,
+                 const std::string& dtypeName,
+                 bool isString = false);
+
+    /** @brief True once the loader has been called successfully. */
+    bool isLoaded() const;
+    /** @brief Return the loaded payload, calling the loader on first use. */
+    std::shared_ptr<Data> load() const;
+    /** @brief Install a loader used by take() to avoid loading the whole payload. */
+    void setSlabLoader(SlabLoader slabLoader);
+
+    std::shared_ptr<Data> clone() const override;
+    std::shared_ptr<Data> copy(bool deep = false) const override;
+
+    bool hasString() const override;
+    bool isNone() const override;
+    bool isScalar() const override;
+
+    size_t dimensions() const override;
+    size_t size() const override;
+    std::vector<size_t> shape() const override;
+    std::string dtype() const override;
+
+    std::shared_ptr<Data> full(
+        const std::vector<size_t>& shape,
+        double value,
+        const std::string& dtypeName,
+        char order = 'F') const override;
+    std::shared_ptr<Data> ravel(const std::string& order = "K") const override;
+    std::shared_ptr<Data> take(int64_t index, size_t axis) const override;
+    int64_t itemAsInt64(const std::vector<size_t>& indices) const override;
+    void setItemFromInt64(const std::vector<size_t>& indices, int64_t value) override;
+    double itemAsDouble(const std::vector<size_t>& indices) const override;
+
+    std::string extractString() const override;
+    std::string_view stringView(std::string& buffer) const override;
+    bool satisfies(const ValuePredicate& predicate) const override;
+    bool isCloseTo(
+        const Data& other,
+        double relativeTolerance = 0.0,
+        double absoluteTolerance = 0.0) const override;
+    std::uint64_t fingerprint() const override;
+    std::shared_ptr<Data> reduce(Reduction reduction, bool skipNaN = false) const override;
+    CountedReduction reduceCounted(Reduction reduction, bool skipNaN = false) const override;
+    std::shared_ptr<Data> reduceAlong(size_t axis, Reduction reduction, bool skipNaN = false) const override;
+
+    std::string info() const override;
+    std::string shortInfo() const override;
+
+    bool operator==(const int8_t& scalar) const override;
+    bool operator==(const int16_t& scalar) const override;
+    bool operator==(const int32_t& scalar) const override;
+    bool operator==(const int64_t& scalar) const override;
+    bool operator==(const uint8_t& scalar) const override;
+    bool operator==(const uint16_t& scalar) const override;
+    bool operator==(const uint32_t& scalar) const override;
+    bool operator==(const uint64_t& scalar) const override;
+    bool operator==(const float& scalar) const override;
+    bool operator==(const double& scalar) const override;
+    bool operator==(const bool& scalar) const override;
+
+    bool operator!=(const int8_t& scalar) const override;
+    bool operator!=(const int16_t& scalar) const override;
+    bool operator!=(const int32_t& scalar) const override;
+    bool operator!=(const int64_t& scalar) const override;
+    bool operator!=(const uint8_t& scalar) const override;
+    bool operator!=(const uint16_t& scalar) const override;
+    bool operator!=(const uint32_t& scalar) const override;
+    bool operator!=(const uint64_t& scalar) const override;
+    bool operator!=(const float& scalar) const override;
+    bool operator!=(const double& scalar) const override;
+    bool operator!=(const bool& scalar) const override;
+
+private:
+    struct State {
+        Loader loader;
+        SlabLoader slabLoader;
+        std::shared_ptr<Data> loaded;
+        std::mutex mutex;
+        std::vector<size_t> shape;
+        std::string dtype;
+        bool isString = false;
+    };
+
+    std::shared_ptr<State> _state;
+};
+
+# endif
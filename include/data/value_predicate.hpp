@@ -0,0 +1,94 @@
+# ifndef VALUE_PREDICATE_HPP
+# define VALUE_PREDICATE_HPP
+
+# include <limits>
+
+/**
+ * @brief Numeric test on the elements of a payload, evaluated on its typed buffer.
+ *
+ * A predicate is an interval, with open or closed and possibly infinite
+ * bounds, and a quantifier: with Quantifier::All (the default) every element
+ * must lie in the interval, with Quantifier::Any one element is enough.
+ * Thresholds on extrema follow: ``min >= t`` is ``atLeast(t)``, and
+ * ``max > t`` is ``greaterThan(t).any()``.
+ *
+ * Elements are compared as double. NaN never lies in an interval, and None,
+ * empty and string payloads never satisfy a predicate (see Data::satisfies).
+ */
+class ValuePredicate {
+
+public:
+    /** @brief Whether every element or at least one element must lie in the interval. */
+    enum class Quantifier { All, Any };
+
+    /** @brief Elements in [@p lower, @p upper]. */
+    static ValuePredicate between(double lower, double upper) {
+        return ValuePredicate(lower, true, upper, true);
+    }
+
+    /** @brief Elements within @p tolerance of @p value (bounds included). */
+    static ValuePredicate near(double value, double tolerance) {
+        return between(value - tolerance, value + tolerance);
+    }
+
+    /** @brief Elements equal to @p value. */
+    static ValuePredicate equalTo(double value) {
+        return between(value, value);
+    }
+
+    /** @brief Elements strictly greater than @p value. */
+    static ValuePredicate greaterThan(double value) {
+        return ValuePredicate(value, false, kInfinity, true);
+    }
+
+    /** @brief Elements greater than or equal to @p value. */
+    static ValuePredicate atLeast(double value) {
+        return ValuePredicate(value, true, kInfinity, true);
+    }
+
+    /** @brief Elements strictly less than @p value. */
+    static ValuePredicate lessThan(double value) {
+        return ValuePredicate(-kInfinity, true, value, false);
+    }
+
+    /** @brief Elements less than or equal to @p value. */
+    static ValuePredicate atMost(double value) {
+        return ValuePredicate(-kInfinity, true, value, true);
+    }
+
+    /** @brief Same interval, satisfied when at least one element lies in it. */
+    ValuePredicate any() const {
+        ValuePredicate predicate = *this;
+        predicate._quantifier = Quantifier::Any;
+        return predicate;
+    }
+
+    /** @brief Same interval, satisfied when every element lies in it. */
+    ValuePredicate all() const {
+        ValuePredicate predicate = *this;
+        predicate._quantifier = Quantifier::All;
+        return predicate;
+    }
+
+    Quantifier quantifier() const { return _quantifier; }
+
+    /** @brief True when @p value lies in the interval. */
+    bool contains(double value) const {
+        return (_lowerIncluded ? value >= _lower : value > _lower)
+            && (_upperIncluded ? value <= _upper : value < _upper);
+    }
+
+private:
+    static constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+    ValuePredicate(double lower, bool lowerIncluded, double upper, bool upperIncluded)
+        : _lower(lower), _upper(upper), _lowerIncluded(lowerIncluded), _upperIncluded(upperIncluded) {}
+
+    double _lower;
+    double _upper;
+    bool _lowerIncluded;
+    bool _upperIncluded;
+    Quantifier _quantifier = Quantifier::All;
+};
+
+# endif
@@ -4,14 +4,82 @@
 #ifdef ENABLE_HDF5_IO
 
 #include "node/node.hpp"
+#include "io/io_options.hpp"
+#include "io/hyperslab.hpp"
+#include "array/array.hpp"
 
 #include <memory>
 #include <string>
 
+#ifdef ENABLE_MPI
+#include <mpi.h>
+#endif
+
 namespace io::hdf5::cgns {
 
 void write_node(const std::string& filename, std::shared_ptr<Node> node, const float& cgnsVersion = 3.1f);
+void write_node(const std::string& filename, std::shared_ptr<Node> node, const io::WriteOptions& options);
 std::shared_ptr<Node> read(const std::string& filename, const char order = 'F');
+std::shared_ptr<Node> read(const std::string& filename, const io::ReadOptions& options);
+
+/**
+ * @brief Read only the node at @p nodePath: its label, payload and link metadata, without children.
+ * @param nodePath Path of the node relative to the file root; empty for the file root.
+ */
+std::shared_ptr<Node> read_node(const std::string& filename, const std::string& nodePath, const char order = 'F');
+/**
+ * @brief Update in place the node at @p nodePath of an existing file from @p node.
+ *
+ * The label, payload and link metadata of the stored node are replaced; its
+ * children are kept and the children of @p node are not written. A payload
+ * with unchanged dtype and shape is overwritten in the existing dataset.
+ * Missing groups along @p nodePath are created. The payload is written
+ * with the staging buffer of @p options, and a new dataset with its
+ * storage layout and filters, as by write_node().
+ */
+void update_node(const std::string& filename, const std::string& nodePath, const Node& node,
+                 const io::WriteOptions& options = io::WriteOptions());
+
+/**
+ * @brief Read a hyperslab of the payload of the node at @p nodePath.
+ * @param nodePath Path of the node relative to the file root (for example ``Base/Zone/GridCoordinates/CoordinateX``).
+ * @return Array shaped like ``slab.count``.
+ */
+Array read_data_slab(const std::string& filename, const std::string& nodePath,
+                     const io::Hyperslab& slab, const char order = 'F');
+/**
+ * @brief Overwrite a hyperslab of the existing payload of the node at @p nodePath.
+ *
+ * When ``slab.count`` is empty it is taken from the shape of @p values,
+ * otherwise both must agree. Values are converted to the dataset type by HDF5.
+ */
+void write_data_slab(const std::string& filename, const std::string& nodePath,
+                     const Array& values, const io::Hyperslab& slab);
+
+#ifdef ENABLE_MPI
+/**
+ * @brief Write into one file the trees held by all ranks of @p comm (collective call).
+ *
+ * Each rank passes its own tree, typically its bases holding only its zones.
+ * The file contains the union of the nodes of all ranks; a node held by
+ * several ranks must have the same label on each of them, and its payload is
+ * written by the first rank holding one. With parallel HDF5, every rank
+ * creates the structure collectively then writes its payloads with
+ * collective or independent MPI-IO transfers (WriteOptions::collectiveTransfers).
+ * Otherwise rank 0 creates the structure and ranks write their payloads in turn.
+ */
+void write_node_parallel(const std::string& filename, std::shared_ptr<Node> root,
+                         MPI_Comm comm, const io::WriteOptions& options = io::WriteOptions());
+/**
+ * @brief Read on each rank of @p comm only the zones assigned to it; ranks read on their own, without collective calls.
+ *
+ * Zone_t nodes below the bases are split in contiguous blocks, in read order:
+ * the k-th of n zones goes to rank ``k * size / n``. Nodes outside zones are
+ * read on every rank. Each rank opens the file on its own, read-only.
+ */
+std::shared_ptr<Node> read_parallel(const std::string& filename, MPI_Comm comm,
+                                    const io::ReadOptions& options = io::ReadOptions());
+#endif // ENABLE_MPI
 
 } // namespace io::hdf5::cgns
 
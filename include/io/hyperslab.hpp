@@ -0,0 +1,27 @@
+#ifndef IO_HYPERSLAB_HPP
+#define IO_HYPERSLAB_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace io {
+
+/**
+ * @brief Strided rectangular selection of an array payload.
+ *
+ * All vectors have one entry per array axis, in the axis order of the Array
+ * seen in memory (not the reversed order used on disk). Element @c n along an
+ * axis selects index ``start + n * stride`` for ``n < count``.
+ */
+struct Hyperslab {
+    /** @brief First selected index along each axis. */
+    std::vector<size_t> start;
+    /** @brief Number of selected indices along each axis. */
+    std::vector<size_t> count;
+    /** @brief Step between selected indices along each axis; empty means 1 everywhere. */
+    std::vector<size_t> stride;
+};
+
+} // namespace io
+
+#endif // IO_HYPERSLAB_HPP
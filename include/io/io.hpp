@@ -2,6 +2,9 @@
 #define IO_HPP
 
 #include "node/node.hpp"
+#include "array/array.hpp"
+#include "io/io_options.hpp"
+#include "io/hyperslab.hpp"
 
 #include <algorithm>
 #include <cctype>
@@ -16,6 +19,10 @@
 #include "io/hdf5/cgns/cgns_io.hpp"
 #endif
 
+#ifdef ENABLE_MPI
+#include <mpi.h>
+#endif
+
 namespace io {
 
 enum class FileFormat {
@@ -55,24 +62,25 @@ inline bool file_flattens_cgns_tree_root(const std::string& filename) {
  * @brief Write a Node hierarchy to disk using the format inferred from @p filename.
  * @param filename Output file path.
  * @param node Root node to serialize.
- * @param cgnsVersion CGNS version metadata used by the CGNS/HDF5 backend.
+ * @param options Write options. Storage layout and filters are only used by the HDF5/CGNS backend.
  */
 inline void write_node(
     const std::string& filename,
     std::shared_ptr<Node> node,
-    const float& cgnsVersion = 3.1f) {
+    const WriteOptions& options) {
 
     switch (detect_format(filename)) {
         case FileFormat::Yaml:
+            (void)options; // YAML has no storage layout
             io::yaml::write_node(filename, std::move(node));
             return;
         case FileFormat::Hdf5Cgns:
 #ifdef ENABLE_HDF5_IO
-            io::hdf5::cgns::write_node(filename, std::move(node), cgnsVersion);
+            io::hdf5::cgns::write_node(filename, std::move(node), options);
             return;
 #else
             (void)node;
-            (void)cgnsVersion;
+            (void)options;
             throw std::runtime_error(
                 "io::write_node: HDF5/CGNS support is disabled. Use a '.yaml' filename or enable HDF5.");
 #endif
@@ -81,22 +89,38 @@ inline void write_node(
     throw std::runtime_error("io::write_node: unsupported file format");
 }
 
+/**
+ * @brief Write a Node hierarchy to disk using the format inferred from @p filename.
+ * @param filename Output file path.
+ * @param node Root node to serialize.
+ * @param cgnsVersion CGNS version metadata used by the CGNS/HDF5 backend.
+ */
+inline void write_node(
+    const std::string& filename,
+    std::shared_ptr<Node> node,
+    const float& cgnsVersion = 3.1f) {
+
+    WriteOptions options;
+    options.cgnsVersion = cgnsVersion;
+    write_node(filename, std::move(node), options);
+}
+
 /**
  * @brief Read a Node hierarchy from disk using the format inferred from @p filename.
  * @param filename Input file path.
- * @param order Memory order for arrays (``'C'`` or ``'F'``). Only used for HDF5/CGNS format.
+ * @param options Read options. ``order`` and ``lazy`` are only used for HDF5/CGNS format.
  * @return Root node of the loaded hierarchy.
  */
-inline std::shared_ptr<Node> read(const std::string& filename, const char order = 'F') {
+inline std::shared_ptr<Node> read(const std::string& filename, const ReadOptions& options) {
     switch (detect_format(filename)) {
         case FileFormat::Yaml:
-            (void)order; // YAML doesn't use order parameter
+            (void)options; // YAML reads the whole document at once
             return io::yaml::read(filename);
         case FileFormat::Hdf5Cgns:
 #ifdef ENABLE_HDF5_IO
-            return io::hdf5::cgns::read(filename, order);
+            return io::hdf5::cgns::read(filename, options);
 #else
-            (void)order;
+            (void)options;
             throw std::runtime_error(
                 "io::read: HDF5/CGNS support is disabled. Use a '.yaml' file or enable HDF5.");
 #endif
@@ -105,6 +129,174 @@ inline std::shared_ptr<Node> read(const std::string& filename, const char order
     throw std::runtime_error("io::read: unsupported file format");
 }
 
+/**
+ * @brief Read a Node hierarchy from disk using the format inferred from @p filename.
+ * @param filename Input file path.
+ * @param order Memory order for arrays (``'C'`` or ``'F'``). Only used for HDF5/CGNS format.
+ * @return Root node of the loaded hierarchy.
+ */
+inline std::shared_ptr<Node> read(const std::string& filename, const char order = 'F') {
+    ReadOptions options;
+    options.order = order;
+    return read(filename, options);
+}
+
+/**
+ * @brief Read only the node at @p nodePath in @p filename, without its children.
+ * @param filename Input file path (HDF5/CGNS format only).
+ * @param nodePath Path of the node relative to the file root; empty for the file root.
+ * @param order Memory order for arrays (``'C'`` or ``'F'``).
+ */
+inline std::shared_ptr<Node> read_node(
+    const std::string& filename,
+    const std::string& nodePath,
+    const char order = 'F') {
+
+    if (detect_format(filename) != FileFormat::Hdf5Cgns) {
+        throw std::runtime_error("io::read_node: single-node reads require an HDF5/CGNS file");
+    }
+#ifdef ENABLE_HDF5_IO
+    return io::hdf5::cgns::read_node(filename, nodePath, order);
+#else
+    (void)nodePath;
+    (void)order;
+    throw std::runtime_error("io::read_node: HDF5/CGNS support is disabled.");
+#endif
+}
+
+/**
+ * @brief Update in place the node at @p nodePath of an existing file from @p node.
+ * @param filename Existing file path (HDF5/CGNS format only).
+ * @param nodePath Path of the node relative to the file root.
+ * @param node Node providing the label, payload and link metadata; its children are not written.
+ * @param options Write options: staging buffer, and storage of a new payload dataset.
+ */
+inline void update_node(
+    const std::string& filename,
+    const std::string& nodePath,
+    const Node& node,
+    const WriteOptions& options = WriteOptions()) {
+
+    if (detect_format(filename) != FileFormat::Hdf5Cgns) {
+        throw std::runtime_error("io::update_node: in-place updates require an HDF5/CGNS file");
+    }
+#ifdef ENABLE_HDF5_IO
+    io::hdf5::cgns::update_node(filename, nodePath, node, options);
+#else
+    (void)nodePath;
+    (void)node;
+    (void)options;
+    throw std::runtime_error("io::update_node: HDF5/CGNS support is disabled.");
+#endif
+}
+
+/**
+ * @brief Read a hyperslab of the payload of the node at @p nodePath in @p filename.
+ * @param filename Input file path (HDF5/CGNS format only).
+ * @param nodePath Path of the node relative to the file root.
+ * @param slab Selection, in array axis order.
+ * @param order Memory order of the returned Array (``'C'`` or ``'F'``).
+ * @return Array shaped like ``slab.count``.
+ */
+inline Array read_data_slab(
+    const std::string& filename,
+    const std::string& nodePath,
+    const Hyperslab& slab,
+    const char order = 'F') {
+
+    if (detect_format(filename) != FileFormat::Hdf5Cgns) {
+        throw std::runtime_error("io::read_data_slab: partial reads require an HDF5/CGNS file");
+    }
+#ifdef ENABLE_HDF5_IO
+    return io::hdf5::cgns::read_data_slab(filename, nodePath, slab, order);
+#else
+    (void)nodePath;
+    (void)slab;
+    (void)order;
+    throw std::runtime_error("io::read_data_slab: HDF5/CGNS support is disabled.");
+#endif
+}
+
+/**
+ * @brief Overwrite a hyperslab of the payload of the node at @p nodePath in @p filename.
+ * @param filename Existing file path (HDF5/CGNS format only).
+ * @param nodePath Path of the node relative to the file root.
+ * @param values Values to write; their shape gives the slab count. Values
+ * that are not Fortran-contiguous are written through a staging buffer of
+ * the default WriteOptions::stagingBytes.
+ * @param slab Selection, in array axis order.
+ */
+inline void write_data_slab(
+    const std::string& filename,
+    const std::string& nodePath,
+    const Array& values,
+    const Hyperslab& slab) {
+
+    if (detect_format(filename) != FileFormat::Hdf5Cgns) {
+        throw std::runtime_error("io::write_data_slab: partial writes require an HDF5/CGNS file");
+    }
+#ifdef ENABLE_HDF5_IO
+    io::hdf5::cgns::write_data_slab(filename, nodePath, values, slab);
+#else
+    (void)nodePath;
+    (void)values;
+    (void)slab;
+    throw std::runtime_error("io::write_data_slab: HDF5/CGNS support is disabled.");
+#endif
+}
+
+#ifdef ENABLE_MPI
+/**
+ * @brief Write into one file the trees held by all ranks of @p comm (collective call).
+ * @param filename Output file path (HDF5/CGNS format only).
+ * @param node Tree of the calling rank, typically its bases holding only its zones.
+ * @param comm Communicator of the writing ranks.
+ * @param options Write options; WriteOptions::collectiveTransfers selects the MPI-IO transfer mode.
+ */
+inline void write_node_parallel(
+    const std::string& filename,
+    std::shared_ptr<Node> node,
+    MPI_Comm comm,
+    const WriteOptions& options = WriteOptions()) {
+
+    if (detect_format(filename) != FileFormat::Hdf5Cgns) {
+        throw std::runtime_error("io::write_node_parallel: parallel writes require an HDF5/CGNS file");
+    }
+#ifdef ENABLE_HDF5_IO
+    io::hdf5::cgns::write_node_parallel(filename, std::move(node), comm, options);
+#else
+    (void)node;
+    (void)comm;
+    (void)options;
+    throw std::runtime_error("io::write_node_parallel: HDF5/CGNS support is disabled.");
+#endif
+}
+
+/**
+ * @brief Read on each rank of @p comm only the zones assigned to it; ranks read on their own, without collective calls.
+ * @param filename Input file path (HDF5/CGNS format only).
+ * @param comm Communicator of the reading ranks.
+ * @param options Read options, applied on every rank.
+ * @return Tree holding the zones of the calling rank and every node outside zones.
+ */
+inline std::shared_ptr<Node> read_parallel(
+    const std::string& filename,
+    MPI_Comm comm,
+    const ReadOptions& options = ReadOptions()) {
+
+    if (detect_format(filename) != FileFormat::Hdf5Cgns) {
+        throw std::runtime_error("io::read_parallel: parallel reads require an HDF5/CGNS file");
+    }
+#ifdef ENABLE_HDF5_IO
+    return io::hdf5::cgns::read_parallel(filename, comm, options);
+#else
+    (void)comm;
+    (void)options;
+    throw std::runtime_error("io::read_parallel: HDF5/CGNS support is disabled.");
+#endif
+}
+#endif // ENABLE_MPI
+
 } // namespace io
 
 #endif // IO_HPP
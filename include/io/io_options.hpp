@@ -0,0 +1,125 @@
+#ifndef IO_IO_OPTIONS_HPP
+#define IO_IO_OPTIONS_HPP
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace io {
+
+/**
+ * @brief Options controlling how a Node hierarchy is read from disk.
+ */
+struct ReadOptions {
+    /** @brief Memory order for arrays (``'C'`` or ``'F'``). */
+    char order = 'F';
+    /**
+     * @brief Defer payload reads until the data is first accessed.
+     *
+     * Only the hierarchy, names, labels, shapes and dtypes are read upfront.
+     * The source file stays open while any deferred payload is pending, so
+     * it must not be overwritten before those payloads are loaded.
+     * Ignored by formats that cannot read payloads independently (YAML).
+     */
+    bool lazy = false;
+    /**
+     * @brief Only read nodes whose path matches one of these patterns.
+     *
+     * Patterns are ``/``-separated paths relative to the file root, each
+     * element being a glob with the semantics of Navigation::byNameGlob
+     * (for example ``Base/Zone?/FlowSolution*``). A matching node is read with
+     * its whole subtree; its ancestors are read without payload so that the
+     * hierarchy is preserved. Branches leading to no match are not read.
+     * An empty list selects every node.
+     */
+    std::vector<std::string> includePatterns;
+    /**
+     * @brief Skip nodes (and their subtree) whose path matches one of these patterns.
+     *
+     * Same syntax as includePatterns; exclusion takes precedence.
+     */
+    std::vector<std::string> excludePatterns;
+    /** @brief Deepest level read, the file root being level 0. */
+    size_t maxDepth = std::numeric_limits<size_t>::max();
+    /**
+     * @brief Maximum number of threads of utils::ThreadPool::shared() reading payloads; 0 uses all of them.
+     *
+     * With more than one thread, the hierarchy is read first, then payloads
+     * are read and converted to the requested order on the shared pool.
+     * HDF5 calls are serialized unless the HDF5 library is thread-safe.
+     * The result does not depend on the thread count. Ignored by lazy reads
+     * and by formats other than HDF5/CGNS.
+     */
+    size_t threads = 1;
+};
+
+/**
+ * @brief How array datasets are split into chunks when chunked storage is used.
+ */
+enum class ChunkPolicy {
+    /** @brief Never chunk; compression filters cannot be used. */
+    Contiguous,
+    /** @brief Chunks of about WriteOptions::chunkBytes, cut along the slowest-varying axes. */
+    Auto,
+    /** @brief Chunks of WriteOptions::chunkShape, clipped to the array shape. */
+    Fixed
+};
+
+/**
+ * @brief Options controlling how a Node hierarchy is written to disk.
+ *
+ * Arrays are stored contiguously unless a filter is enabled or the chunk
+ * policy is ChunkPolicy::Fixed. Readers need no option to read chunked or
+ * compressed datasets back.
+ */
+struct WriteOptions {
+    /** @brief CGNS version metadata used by the CGNS/HDF5 backend. */
+    float cgnsVersion = 3.1f;
+    /** @brief Chunk shape policy of chunked datasets. */
+    ChunkPolicy chunkPolicy = ChunkPolicy::Auto;
+    /** @brief Chunk shape in array axis order, used by ChunkPolicy::Fixed (arrays of another rank use Auto chunks). */
+    std::vector<size_t> chunkShape;
+    /** @brief Target chunk size in bytes, used by ChunkPolicy::Auto. */
+    size_t chunkBytes = size_t{1} << 20;
+    /** @brief Deflate (gzip) compression level from 1 to 9; 0 disables compression. */
+    unsigned deflateLevel = 0;
+    /** @brief Apply the byte shuffle filter before compression. */
+    bool shuffle = false;
+    /** @brief Arrays smaller than this many bytes are always stored contiguously. */
+    size_t minChunkedBytes = 0;
+    /**
+     * @brief Largest staging buffer, in bytes, used to reorder arrays that are not Fortran-contiguous.
+     *
+     * Fortran-contiguous arrays are written straight from their buffer; other
+     * layouts are written tile by tile through a buffer of at most this size.
+     * Collective MPI-parallel transfers take one call per payload, so they
+     * stage a whole payload at once.
+     */
+    size_t stagingBytes = size_t{4} << 20;
+    /**
+     * @brief Use collective MPI-IO transfers in MPI-parallel writes; independent transfers otherwise.
+     *
+     * Compression filters require collective transfers. Ignored by serial writes.
+     */
+    bool collectiveTransfers = true;
+    /**
+     * @brief Update an existing file in place, rewriting only what changed since it was last written.
+     *
+     * Each group records the Node::fingerprint of the subtree it holds,
+     * taken after Node::refreshFingerprint has rehashed the payloads, so
+     * that buffers edited in place are seen. When @p filename holds such
+     * records for the same root, unchanged subtrees are skipped, changed
+     * payloads of the same dtype and shape are overwritten in their dataset,
+     * and added, removed or renamed nodes are created or unlinked; otherwise
+     * the file is written in full, with records.
+     * Kept datasets keep their storage layout and filters; space freed by
+     * unlinked or resized datasets is not reclaimed. Only used by serial
+     * HDF5/CGNS writes.
+     */
+    bool incremental = false;
+};
+
+} // namespace io
+
+#endif // IO_IO_OPTIONS_HPP
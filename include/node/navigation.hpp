@@ -6,6 +6,7 @@
 # include <regex>
 # include <vector>
 
+# include "node/query.hpp"
 # include "utils/template_instantiator.hpp"
 
 
@@ -15,7 +16,10 @@ class Node;
  * @brief Read-only traversal and query helper for Node trees.
  *
  * Navigation methods search descendants by name, type, data, glob or regex
- * matching, and combined predicates.
+ * matching, and combined predicates. Each method runs a NodeQuery; build one
+ * directly to reuse a compiled query across several searches. Exact name
+ * and type searches read their candidates from the TreeIndex of the tree
+ * when one is enabled (see Node::enableTreeIndex).
  */
 class Navigation {
 
@@ -90,6 +94,11 @@ public:
 
     template <typename T>
     std::vector<std::shared_ptr<Node>> allByData(const T& data, const size_t& depth=100);
+
+    /** First descendant whose numeric data satisfies @p predicate, tested on the typed buffer. */
+    std::shared_ptr<Node> byValue(const ValuePredicate& predicate, const size_t& depth=100);
+
+    std::vector<std::shared_ptr<Node>> allByValue(const ValuePredicate& predicate, const size_t& depth=100);
     /** @} */
 
     /** @name Combined predicates (name + type + data)
@@ -159,6 +168,30 @@ public:
         const size_t& depth=100);
     /** @} */
 
+    /** @name Parallel queries
+     *  Same results as allByAnd and allByAndGlob, with the subtrees searched
+     *  on at most @p threads threads of utils::ThreadPool::shared() (0 uses
+     *  all of them); see
+     *  NodeQuery::allParallel for the splitting and @p grainSize.
+     *  @{
+     */
+    std::vector<std::shared_ptr<Node>> allByAndParallel(
+        const std::string& name = std::string(""),
+        const std::string& type = std::string(""),
+        const std::string& data = std::string(""),
+        const size_t& depth=100,
+        size_t threads=0,
+        size_t grainSize=NodeQuery::kParallelGrainSize);
+
+    std::vector<std::shared_ptr<Node>> allByAndGlobParallel(
+        const std::string& name = std::string(""),
+        const std::string& type = std::string(""),
+        const std::string& data = std::string(""),
+        const size_t& depth=100,
+        size_t threads=0,
+        size_t grainSize=NodeQuery::kParallelGrainSize);
+    /** @} */
+
 };
 
 # endif 
@@ -29,10 +29,15 @@
 # include <utility>
 # include <sstream>
 # include <tuple>
+# include <unordered_map>
+# include <atomic>
+# include <optional>
 
 # include "data/data.hpp"
+# include "io/io_options.hpp"
 # include "node/navigation.hpp"
 # include "node/node_group.hpp"
+# include "node/tree_index.hpp"
 # include "utils/data_types.hpp"
 # include "utils/compat.hpp"
 
@@ -112,14 +117,63 @@ private:
     std::string _linkTargetPath;
     static std::function<std::shared_ptr<Data>()> dataFactory;
 
+    // name -> child index, built when the children become many and kept
+    // up to date by attachTo, detach and setName, so lookups only read it
+    std::unordered_multimap<std::string, Node*> _childrenByName;
+    bool _childrenByNameIsBuilt = false;
+
     mutable std::shared_ptr<Navigation> _navigator;
 
+    // index owned by this node, and index covering it (its own or an ancestor's)
+    std::shared_ptr<TreeIndex> _ownedIndex;
+    TreeIndex* _treeIndex = nullptr;
+
+    friend class TreeIndex;
+
+    using TreeGeneration = std::atomic<uint64_t>;
+
+    // path, level and root, valid while generation equals the generation of
+    // the tree they were computed in; filled once under a lock, then only read
+    struct Placement {
+        std::string path;
+        size_t level = 0;
+        const Node* root = nullptr;
+        std::shared_ptr<TreeGeneration> tree;
+        // the tree replaced by the last fill, kept for readers still checking it
+        std::shared_ptr<TreeGeneration> previousTree;
+        std::atomic<const TreeGeneration*> treeToCheck{nullptr};
+        std::atomic<uint64_t> generation{0};
+
+        bool isCurrent() const;
+    };
+    mutable Placement _placement;
+
+    // generation of the tree rooted at this node, created by the first placement
+    // computed in it, and bumped by every change of parent links or names in it
+    mutable std::shared_ptr<TreeGeneration> _treeGeneration;
+    void structureChanged();
+
+    const Placement& placement() const;
+
+    // fingerprint of the subtree and of the payload alone, see fingerprint()
+    mutable std::uint64_t _fingerprint = 0;
+    mutable std::uint64_t _dataFingerprint = 0;
+    mutable bool _fingerprintIsValid = false;
+    mutable bool _dataFingerprintIsValid = false;
+
+    /** Clear the subtree fingerprint of this node and of its ancestors. */
+    void fingerprintChanged();
+    /** Hash this node from its payload fingerprint and the valid fingerprints of its children. */
+    void updateFingerprint() const;
+
+    void indexChild(Node* child);
+    void unindexChild(const Node* child);
+
 protected:
 
     /** @brief Create an empty instance of the concrete node type for copying. */
     virtual std::shared_ptr<Node> makeCopyShell() const;
 
-    void gatherAllDescendantsInList( std::shared_ptr<Node> node, std::vector<std::shared_ptr<Node>>& descendants);
     std::string printTreeImpl(
         int max_depth,
         const std::string& highlighted_path,
@@ -143,6 +197,15 @@ public:
      */
     std::vector<std::shared_ptr<Node>> descendants(); // to be refactored into Navigation
 
+    /**
+     * @brief Select nodes below this one with a path expression.
+     *
+     * For example ``select("CGNSBase_t/Zone_t[name~'blk*']//DataArray_t[dtype=float64]")``;
+     * see PathQuery for the syntax. Compile a PathQuery directly to reuse it.
+     * @return Selected nodes in depth-first order.
+     */
+    std::vector<std::shared_ptr<Node>> select(const std::string& expression);
+
     /**
      * @brief Construct a node.
      * @param name Node name.
@@ -152,6 +215,21 @@ public:
 
     virtual ~Node();
 
+    /**
+     * @brief Index this node and its descendants by name, type and path.
+     *
+     * The index is kept up to date as the tree changes, and used by
+     * Navigation name and type searches and by getAtPath. Enabling it again
+     * returns the existing index.
+     * @throws std::runtime_error when this node is already covered by the
+     * index of an ancestor, or when one of its descendants owns an index.
+     */
+    TreeIndex& enableTreeIndex();
+    /** @brief Drop the index owned by this node, if any. */
+    void disableTreeIndex();
+    /** @brief Index covering this node (owned by it or by an ancestor), or null. */
+    TreeIndex* treeIndex() const;
+
     /** @brief Access navigation helper bound to this node. */
     Navigation& pick();
     Navigation& pick() const;
@@ -168,7 +246,7 @@ public:
     void setName(const std::string& name);
 
     /** @brief Node type accessor. */
-    std::string type() const;
+    const std::string& type() const;
     /** @brief Change node type string. */
     void setType(const std::string& type);
     /** @brief True when link target metadata is set. */
@@ -189,9 +267,21 @@ public:
     /** @brief Parent accessor (weak to avoid cycles). */
     std::weak_ptr<Node> parent() const;
 
-    /** @brief Read payload by reference. */
+    /**
+     * @brief Read payload by reference.
+     *
+     * A payload read lazily from disk is returned as a placeholder: metadata
+     * queries stay cheap and value accesses load it on demand.
+     */
     const Data& data() const;
-    /** @brief Read payload shared pointer. */
+    /**
+     * @brief Read payload shared pointer.
+     *
+     * A payload read lazily from disk is loaded and returned, so the pointer
+     * always holds the concrete Data type. The node keeps its placeholder,
+     * which forwards to the loaded payload: concurrent calls only share the
+     * guarded load of the placeholder.
+     */
     std::shared_ptr<Data> dataPtr() const;
 
     /** @brief Replace payload with shared Data instance. */
@@ -232,8 +322,26 @@ public:
     bool hasSiblings() const;
     /** @brief Return child names in insertion order. */
     std::vector<std::string> getChildrenNames() const;
+    /**
+     * @brief First child (in insertion order) named @p name, or null.
+     *
+     * Children equal to @p ignoredA or @p ignoredB are skipped. Nodes with
+     * many children keep a name index, maintained by attachTo, detach,
+     * setName and swap, so the lookup does not scan the children. The
+     * lookup only reads the index, and may run concurrently with other reads.
+     */
+    std::shared_ptr<Node> childByName(
+        const std::string& name,
+        const Node* ignoredA = nullptr,
+        const Node* ignoredB = nullptr) const;
     
-    /** @brief Return root ancestor for this node. */
+    /**
+     * @brief Return root ancestor for this node.
+     *
+     * root(), level() and path() are cached per node and recomputed only
+     * after attachTo, detach, setName or swap changed the tree of the node.
+     * They may be called concurrently from several threads.
+     */
     std::shared_ptr<const Node> root() const;
 
     /** @brief Depth level relative to root (root is 0). */
@@ -250,6 +358,8 @@ public:
      * @param node New parent.
      * @param position Optional insertion index (-1 means append).
      * @param overrideSiblingByName Replace conflicting sibling when true.
+     * @throws std::runtime_error when @p node is indexed and a node of this
+     * subtree owns an index (see enableTreeIndex).
      */
     void attachTo(
         std::shared_ptr<Node> node,
@@ -288,18 +398,65 @@ public:
         const std::string& parameterType = "DataArray_t");
     /** @brief Read parameter container as recursive ParameterValue. */
     ParameterValue getParameters(const std::string& containerName) const;
-    /** @brief Reload payload from disk using this node path as lookup key. */
+    /**
+     * @brief Reload payload from disk using this node path as lookup key.
+     *
+     * For HDF5/CGNS files only the group of this node is read.
+     */
     void reloadNodeData(const std::string& filename);
-    /** @brief Save only this node payload/metadata to an existing file. */
+    /**
+     * @brief Save only this node payload/metadata to an existing file.
+     *
+     * For HDF5/CGNS files the node group is updated in place; the rest of the
+     * file is left untouched.
+     */
     void saveThisNodeOnly(const std::string& filename, const std::string& backend = "hdf5");
     /** @brief Merge another subtree into this node (same-root strategy). */
     void merge(std::shared_ptr<Node> node);
 
-    /** @brief Build absolute path from root to this node. */
+    /**
+     * @brief Absolute path from root to this node.
+     *
+     * Cached, see root(): the path is built again only after a rename or a
+     * move of this node or of an ancestor.
+     */
     std::string path() const;
 
+    /**
+     * @brief Stable hash of this subtree: names, types, link targets, payloads and order of children.
+     *
+     * Payloads are hashed with Data::fingerprint, so the same values in C
+     * or Fortran order hash equal. The result is cached per node, and
+     * setName, setType, setLinkTarget, clearLinkTarget, setData, attachTo,
+     * detach and swap clear the cache of the changed node and its ancestors
+     * only: after a local change, the next call rehashes the changed payload
+     * and the nodes on the path to the root. The place of the subtree in its
+     * tree is not hashed, so a moved subtree keeps its fingerprint.
+     *
+     * Payload buffers edited in place (through a NumPy view for instance)
+     * are not seen: call invalidateFingerprint() on their node, or
+     * refreshFingerprint() on the subtree, after such edits.
+     */
+    std::uint64_t fingerprint() const;
+    /** @brief Forget the cached payload and subtree fingerprints of this node and of its ancestors. */
+    void invalidateFingerprint();
+    /**
+     * @brief Rehash the loaded payloads of this subtree, forgetting the fingerprints they no longer match.
+     *
+     * Catches payloads edited in place since they were hashed, at the cost
+     * of hashing every payload. Incremental writes call it before comparing
+     * the tree with the file.
+     */
+    void refreshFingerprint();
+    /** @brief Cached fingerprint when it is up to date, without computing it. */
+    std::optional<std::uint64_t> cachedFingerprint() const;
+    /** @brief Fingerprint of the payload alone (Data::fingerprint), cached like fingerprint(). */
+    std::uint64_t dataFingerprint() const;
+
     /** @brief Write this subtree to file using the format inferred from the filename. */
     void write(const std::string& filename);
+    /** @brief Write this subtree to file with storage options (chunking, compression). */
+    void write(const std::string& filename, const io::WriteOptions& options);
 
     // Print method
     /** @brief Stream helper for textual tree rendering. */
@@ -0,0 +1,79 @@
+# ifndef NODE_PATH_QUERY_HPP
+# define NODE_PATH_QUERY_HPP
+
+# include <memory>
+# include <string>
+# include <vector>
+
+class Node;
+
+/**
+ * @brief Compiled path expression selecting nodes below a start node.
+ *
+ * An expression is a sequence of steps separated by axes, for example
+ * ``CGNSBase_t/Zone_t[name~'blk*']/FlowSolution_t/DataArray_t[dtype=float64]``:
+ *
+ * - axes: ``/`` selects children; ``//`` selects descendants at any depth;
+ *   ``//{n}`` and ``//{m,n}`` select descendants from 1 (or ``m``) to ``n``
+ *   levels below. A leading axis applies to the start node; without one the
+ *   first step selects children.
+ * - node tests: ``*`` matches any node; a word ending with ``_t`` (the CGNS
+ *   type convention) is matched against the node type, any other word, or a
+ *   quoted one, against the node name. Unquoted words may use ``*`` and ``?``
+ *   globs.
+ * - predicates: ``[key op value]`` with key ``name``, ``type``, ``data``
+ *   (string payload, or scalar payload when the value is an unquoted number)
+ *   or ``dtype``, and op ``=``, ``!=``, ``~`` (glob) or ``!~``. Values may be
+ *   quoted with ``'`` or ``"``.
+ *
+ * The query is evaluated in a single pre-order walk. Each step keeps its
+ * name and type conditions ahead of data conditions, so payloads are only
+ * inspected on nodes whose name and type already match, and subtrees where
+ * no step can match anymore are not entered.
+ *
+ * Results are returned once each, in pre-order.
+ */
+class PathQuery {
+
+public:
+    /**
+     * @brief Parse @p expression.
+     * @throws std::invalid_argument when the expression is malformed.
+     */
+    explicit PathQuery(const std::string& expression);
+
+    /** @brief Nodes below @p start selected by the expression. */
+    std::vector<std::shared_ptr<Node>> select(Node& start) const;
+
+    /** @brief Source expression. */
+    const std::string& expression() const;
+
+private:
+    class Parser;
+
+    struct Condition {
+        enum class Field { Name, Type, DType, Data };
+        enum class Compare { Equal, Glob, Number };
+
+        Field field;
+        Compare compare;
+        bool negated;
+        std::string text;
+        double number;
+
+        bool matches(const Node& node) const;
+    };
+
+    struct Step {
+        size_t minLevel;
+        size_t maxLevel;
+        std::vector<Condition> conditions;
+
+        bool matches(const Node& node) const;
+    };
+
+    std::string _expression;
+    std::vector<Step> _steps;
+};
+
+# endif
@@ -0,0 +1,122 @@
+# ifndef NODE_QUERY_HPP
+# define NODE_QUERY_HPP
+
+# include <functional>
+# include <memory>
+# include <optional>
+# include <regex>
+# include <string>
+# include <string_view>
+# include <vector>
+
+# include "data/data.hpp"
+
+class Node;
+
+/**
+ * @brief Node predicate compiled once and evaluated over a whole tree.
+ *
+ * A query combines optional criteria on node name, type and data; a node
+ * matches when it satisfies every criterion that was set. Patterns are
+ * compiled when the criterion is set, so searching a tree of any depth
+ * builds each regex once, and glob patterns are matched without regex.
+ *
+ * first() and all() visit the descendants of the start node (not the start
+ * node itself) in depth-first pre-order, down to @p depth levels, with a
+ * traversal::Walker. When the start node is covered by a TreeIndex and the
+ * query has an exact name or type, the candidates are taken from the index
+ * instead, so the search costs O(matches) rather than O(tree).
+ */
+class NodeQuery {
+
+public:
+    /** @brief How a name, type or string-data pattern is compared. */
+    enum class Match {
+        Exact, ///< whole-string equality
+        Glob,  ///< whole-string glob, see utils::globMatch
+        Regex  ///< ECMAScript regex found anywhere in the string (std::regex_search)
+    };
+
+    /** @brief Require the node name to match @p pattern. */
+    NodeQuery& name(const std::string& pattern, Match match = Match::Exact);
+
+    /** @brief Require the node type to match @p pattern. */
+    NodeQuery& type(const std::string& pattern, Match match = Match::Exact);
+
+    /**
+     * @brief Require the node data to hold a string matching @p pattern.
+     *
+     * The text is matched in place in the data buffer when it is stored as
+     * one run of characters (see Data::stringView), so no string is built
+     * for the nodes visited.
+     */
+    NodeQuery& data(const std::string& pattern, Match match = Match::Exact);
+
+    /** @brief Require the node data to hold numbers satisfying @p predicate (see Data::satisfies). */
+    NodeQuery& value(const ValuePredicate& predicate);
+
+    /** @brief Require the node data to be a scalar equal to @p value. */
+    template <typename T>
+    NodeQuery& scalar(const T& value) {
+        _data = [value](const Data& data) {
+            return data.isScalar() && data == value;
+        };
+        return *this;
+    }
+
+    /** @brief True when @p node satisfies every criterion of the query. */
+    bool matches(const Node& node) const;
+
+    /** @brief First matching descendant of @p start in pre-order, or nullptr. */
+    std::shared_ptr<Node> first(Node& start, size_t depth = 100) const;
+
+    /** @brief All matching descendants of @p start in pre-order. */
+    std::vector<std::shared_ptr<Node>> all(Node& start, size_t depth = 100) const;
+
+    /** @brief Default minimum number of nodes searched by each worker of allParallel(). */
+    static constexpr size_t kParallelGrainSize = 4096;
+
+    /**
+     * @brief Same result as all(), searching the subtrees of @p start on several threads.
+     *
+     * The first levels below @p start are split into many subtrees, which
+     * idle workers take in turn, so a few large zones do not leave the
+     * other workers waiting. Results of each subtree are kept apart and
+     * concatenated in pre-order.
+     *
+     * At most one worker is used per @p grainSize nodes, so trees of fewer
+     * than 2 * @p grainSize nodes are searched serially, like with all().
+     * Exact searches answered by a TreeIndex are also run serially.
+     *
+     * @param threads Maximum number of threads of utils::ThreadPool::shared() (0 uses all of them).
+     * @param grainSize Minimum number of nodes per worker.
+     */
+    std::vector<std::shared_ptr<Node>> allParallel(
+        Node& start,
+        size_t depth = 100,
+        size_t threads = 0,
+        size_t grainSize = kParallelGrainSize) const;
+
+private:
+    class Pattern {
+    public:
+        Pattern(const std::string& pattern, Match match);
+        bool matches(std::string_view text) const;
+        /** Compared string when matching is exact, else nullptr. */
+        const std::string* exact() const;
+
+    private:
+        std::string _pattern;
+        Match _match;
+        std::regex _regex;
+    };
+
+    std::optional<Pattern> _name;
+    std::optional<Pattern> _type;
+    std::function<bool(const Data&)> _data;
+
+    /** Indexed nodes below @p start with the exact name or type of the query, in pre-order. */
+    std::optional<std::vector<Node*>> indexedCandidates(const Node& start, size_t depth) const;
+};
+
+# endif
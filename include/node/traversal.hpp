@@ -0,0 +1,201 @@
+# ifndef NODE_TRAVERSAL_HPP
+# define NODE_TRAVERSAL_HPP
+
+# include <cstddef>
+# include <limits>
+# include <type_traits>
+# include <utility>
+# include <vector>
+
+# include "node/node.hpp"
+
+/**
+ * @brief Non-recursive walks over a Node tree.
+ *
+ * Walks keep an explicit stack (or queue) instead of recursing, so their
+ * depth is not limited by the call stack, and hand out ``Node&`` references
+ * without copying any shared_ptr.
+ *
+ * A visitor is called as ``visitor(node, level)`` (or ``visitor(node)``),
+ * where ``level`` is 0 for the start node, 1 for its children and so on. It
+ * may return an Action to prune the children of the visited node or to stop
+ * the walk; a visitor returning ``void`` always continues. Null children are
+ * skipped.
+ */
+namespace traversal {
+
+/** @brief Order in which nodes are handed to the visitor. */
+enum class Order {
+    PreOrder,     ///< depth first, a node before its children
+    PostOrder,    ///< depth first, a node after its children
+    BreadthFirst  ///< level by level, children in order
+};
+
+/** @brief What the walk does after a node is visited. */
+enum class Action {
+    Continue,     ///< visit the children of the node, then go on
+    SkipChildren, ///< do not visit the children of the node (no effect in post-order)
+    Stop          ///< end the walk
+};
+
+/** @brief Level limit meaning the whole tree is walked. */
+inline constexpr size_t kAllLevels = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief Reusable walk state.
+ *
+ * The stack and queue keep their capacity between walks, so repeated walks
+ * with the same Walker do not allocate once the largest tree has been seen.
+ * A Walker must not be reused from inside one of its own visitors.
+ */
+class Walker {
+
+public:
+
+    /**
+     * @brief Visit @p start and its descendants in @p order, down to @p maxLevel levels below @p start.
+     * @return ``true`` when the visitor stopped the walk.
+     */
+    template <typename Visitor>
+    bool walk(Node& start, Visitor&& visitor, Order order = Order::PreOrder, size_t maxLevel = kAllLevels) {
+        switch (order) {
+            case Order::PreOrder: return walkPreOrder(start, visitor, maxLevel);
+            case Order::PostOrder: return walkPostOrder(start, visitor, maxLevel);
+            case Order::BreadthFirst: return walkBreadthFirst(start, visitor, maxLevel);
+        }
+        return false;
+    }
+
+private:
+
+    struct Frame {
+        Node* node;
+        size_t nextChild;
+    };
+
+    struct Queued {
+        Node* node;
+        size_t level;
+    };
+
+    std::vector<Frame> _frames;
+    std::vector<Queued> _queue;
+
+    template <typename Visitor>
+    static Action visit(Visitor& visitor, Node& node, size_t level) {
+        if constexpr (std::is_invocable_v<Visitor&, Node&, size_t>) {
+            if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, Node&, size_t>>) {
+                visitor(node, level);
+                return Action::Continue;
+            } else {
+                return visitor(node, level);
+            }
+        } else {
+            if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, Node&>>) {
+                visitor(node);
+                return Action::Continue;
+            } else {
+                return visitor(node);
+            }
+        }
+    }
+
+    /** Next non-null child of the top frame, or nullptr once all were taken. */
+    Node* nextChild(Frame& frame) {
+        const auto& children = frame.node->children();
+        while (frame.nextChild < children.size()) {
+            Node* child = children[frame.nextChild++].get();
+            if (child) {
+                return child;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename Visitor>
+    bool walkPreOrder(Node& start, Visitor& visitor, size_t maxLevel) {
+        _frames.clear();
+        const Action action = visit(visitor, start, 0);
+        if (action == Action::Stop) return true;
+        if (action == Action::SkipChildren || maxLevel == 0) return false;
+
+        _frames.push_back({&start, 0});
+        while (!_frames.empty()) {
+            Node* child = nextChild(_frames.back());
+            if (!child) {
+                _frames.pop_back();
+                continue;
+            }
+            const size_t level = _frames.size();
+            const Action childAction = visit(visitor, *child, level);
+            if (childAction == Action::Stop) {
+                _frames.clear();
+                return true;
+            }
+            if (childAction == Action::Continue && level < maxLevel) {
+                _frames.push_back({child, 0});
+            }
+        }
+        return false;
+    }
+
+    template <typename Visitor>
+    bool walkPostOrder(Node& start, Visitor& visitor, size_t maxLevel) {
+        _frames.clear();
+        _frames.push_back({&start, 0});
+        while (!_frames.empty()) {
+            Frame& top = _frames.back();
+            Node* child = _frames.size() <= maxLevel ? nextChild(top) : nullptr;
+            if (child) {
+                _frames.push_back({child, 0});
+                continue;
+            }
+            Node* node = top.node;
+            _frames.pop_back();
+            if (visit(visitor, *node, _frames.size()) == Action::Stop) {
+                _frames.clear();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename Visitor>
+    bool walkBreadthFirst(Node& start, Visitor& visitor, size_t maxLevel) {
+        _queue.clear();
+        _queue.push_back({&start, 0});
+        // the queue is consumed from the front and never shrinks during a walk
+        for (size_t head = 0; head < _queue.size(); ++head) {
+            const Queued current = _queue[head];
+            const Action action = visit(visitor, *current.node, current.level);
+            if (action == Action::Stop) {
+                _queue.clear();
+                return true;
+            }
+            if (action == Action::SkipChildren || current.level >= maxLevel) {
+                continue;
+            }
+            for (const auto& child : current.node->children()) {
+                if (child) {
+                    _queue.push_back({child.get(), current.level + 1});
+                }
+            }
+        }
+        _queue.clear();
+        return false;
+    }
+};
+
+/**
+ * @brief Visit @p start and its descendants with a one-off Walker.
+ * @return ``true`` when the visitor stopped the walk.
+ */
+template <typename Visitor>
+bool walk(Node& start, Visitor&& visitor, Order order = Order::PreOrder, size_t maxLevel = kAllLevels) {
+    Walker walker;
+    return walker.walk(start, std::forward<Visitor>(visitor), order, maxLevel);
+}
+
+} // namespace traversal
+
+# endif
@@ -0,0 +1,99 @@
+# ifndef NODE_TREE_DIFF_HPP
+# define NODE_TREE_DIFF_HPP
+
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "data/data.hpp"
+
+class Node;
+
+/**
+ * @brief Structural difference between two trees, applicable to the first to obtain the second.
+ *
+ * TreePatch::diff pairs the children of matching nodes by name; among the
+ * children left unpaired on both sides, a removed and an added child of the
+ * same type are recorded as a rename. Payloads are compared with
+ * Data::isCloseTo, except when both nodes share the same Data, and a Node
+ * found on both sides is skipped with its subtree. Payloads read lazily are
+ * compared through their placeholders: those differing in shape or dtype
+ * are not loaded, and only the new payload of a DataChanged is resolved.
+ *
+ * Changes are recorded in the order apply() replays them: paths are written
+ * relative to the patched root (``Base/Zone``, empty for the root itself)
+ * and use the names the tree has at that point of the replay. Added
+ * subtrees and new payloads are shared with the compared tree (or with the
+ * node read by fromNode()), not copied: apply() and toNode() attach copies
+ * of the added subtrees, whose payloads stay shared.
+ * The order of siblings that exist on both sides is not recorded.
+ */
+class TreePatch {
+
+public:
+    /** @brief What a change does to the node at its path. */
+    enum class Kind {
+        Added,      ///< attach a copy of subtree below the node at path, at position
+        Removed,    ///< detach the node at path
+        Renamed,    ///< rename the node at path to value
+        Retyped,    ///< set the type of the node at path to value
+        DataChanged ///< set the payload of the node at path to data
+    };
+
+    /** @brief One change; fields not used by its kind are empty. */
+    struct Change {
+        Kind kind;
+        std::string path;
+        std::string value;
+        size_t position = 0;
+        std::shared_ptr<Node> subtree;
+        std::shared_ptr<Data> data;
+    };
+
+    /**
+     * @brief Changes turning @p before into @p after.
+     *
+     * Numeric payloads whose elements differ by at most @p absoluteTolerance +
+     * @p relativeTolerance times the larger magnitude are considered unchanged.
+     */
+    static TreePatch diff(
+        const Node& before,
+        const Node& after,
+        double relativeTolerance = 0.0,
+        double absoluteTolerance = 0.0);
+
+    /** @brief Changes in replay order. */
+    const std::vector<Change>& changes() const;
+
+    /** @brief True when the compared trees are equal. */
+    bool empty() const;
+
+    /** @brief Number of changes. */
+    size_t size() const;
+
+    /**
+     * @brief Replay the changes on the tree rooted at @p root, in place.
+     * @throws std::runtime_error when a path does not lead to a node of the tree.
+     */
+    void apply(Node& root) const;
+
+    /**
+     * @brief The patch as a tree, to be written and read back with the node IO.
+     *
+     * Each change is a child ``Change.<i>`` of type the kind name, holding
+     * its path (with a leading ``/``) as data, and children ``Value``,
+     * ``Position``, ``Subtree`` or ``Data`` for the fields its kind uses.
+     */
+    std::shared_ptr<Node> toNode() const;
+
+    /** @brief Patch encoded by toNode(). */
+    static TreePatch fromNode(const Node& node);
+
+    /** @brief Name of @p kind, as used by toNode(). */
+    static const char* kindName(Kind kind);
+
+private:
+    std::vector<Change> _changes;
+};
+
+# endif
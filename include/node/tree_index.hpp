@@ -0,0 +1,116 @@
+# ifndef NODE_TREE_INDEX_HPP
+# define NODE_TREE_INDEX_HPP
+
+# include <cstdint>
+# include <map>
+# include <string>
+# include <unordered_map>
+# include <vector>
+
+class Node;
+
+/**
+ * @brief Opt-in secondary indices of a tree: type -> nodes, name -> nodes, path -> node.
+ *
+ * Enabled with Node::enableTreeIndex on the root of a tree (the owner), the
+ * index covers the owner and all its descendants. It is kept up to date by
+ * Node::attachTo, Node::detach, Node::setName, Node::setType and Node::swap,
+ * and Navigation uses it for exact name and type searches, so repeated
+ * searches on a static tree cost O(matches) instead of O(tree).
+ *
+ * Results are returned in depth-first pre-order. Each node holds a range of
+ * labels nested in the range of its parent, after those of its previous
+ * siblings, and the name and type maps keep their nodes sorted by label: a
+ * search reads the range of the start node only, in O(log n + nodes of that
+ * name or type below it). An attached subtree takes labels from the free
+ * range between its siblings; when that range is too small, the smallest
+ * enclosing subtree with room enough is labeled again. Searches do not
+ * modify the index, so concurrent searches on a tree that is not being
+ * edited are safe.
+ */
+class TreeIndex {
+
+public:
+    /**
+     * @brief Index @p owner and its descendants.
+     * @throws std::runtime_error when a descendant of @p owner owns an index.
+     */
+    explicit TreeIndex(Node& owner);
+
+    TreeIndex(const TreeIndex&) = delete;
+    TreeIndex& operator=(const TreeIndex&) = delete;
+
+    /** @brief Root of the indexed tree. */
+    Node& owner() const;
+
+    /** @brief Number of indexed nodes. */
+    size_t size() const;
+
+    /** @brief Nodes named @p name below @p start, at most @p depth levels down, in pre-order. */
+    std::vector<Node*> byName(const Node& start, const std::string& name, size_t depth) const;
+
+    /** @brief Nodes of type @p type below @p start, at most @p depth levels down, in pre-order. */
+    std::vector<Node*> byType(const Node& start, const std::string& type, size_t depth) const;
+
+    /**
+     * @brief Node at @p path, written from the owner as in Node::path (``Root/Base/Zone``).
+     * @return nullptr when no node, or more than one node, has this path.
+     */
+    Node* atPath(const std::string& path) const;
+
+    /** @name Updates called by Node
+     *  @{
+     */
+    /**
+     * @brief Throw when a node of @p subtreeRoot owns an index, which indexing
+     * the subtree from another index would drop.
+     */
+    static void checkInsertable(Node& subtreeRoot);
+
+    /** @brief Index @p subtreeRoot, just attached below an indexed node, and its descendants. */
+    void insertSubtree(Node& subtreeRoot);
+
+    /** @brief Forget @p subtreeRoot, about to be detached, and its descendants. */
+    void removeSubtree(Node& subtreeRoot);
+
+    /** @brief Update name and path entries after @p node was renamed from @p oldName. */
+    void rename(Node& node, const std::string& oldName);
+
+    /** @brief Update type entries after the type of @p node changed from @p oldType. */
+    void retype(Node& node, const std::string& oldType);
+
+    /** @brief Update the order of the children of @p parent, reordered without being attached or detached. */
+    void reorder(Node& parent);
+
+    /** @brief Unlink every indexed node from this index, before the index is dropped. */
+    void release();
+    /** @} */
+
+private:
+    struct Entry {
+        std::string path;
+        std::uint64_t first = 0; ///< label of the node
+        std::uint64_t last = 0;  ///< last label of the range of its subtree
+        size_t level = 0;
+        bool isLabeled = false;
+    };
+    using NodesByLabel = std::map<std::uint64_t, Node*>;
+
+    Node& _owner;
+    std::unordered_map<const Node*, Entry> _entries;
+    std::unordered_map<std::string, NodesByLabel> _byName;
+    std::unordered_map<std::string, NodesByLabel> _byType;
+    std::unordered_multimap<std::string, Node*> _byPath;
+
+    void insert(Node& node, const std::string& path, size_t level);
+    void erase(Node& node);
+    void updatePaths(Node& subtreeRoot, const std::string& path);
+    void place(Node& subtreeRoot, size_t size);
+    void label(Node& subtreeRoot, std::uint64_t first, std::uint64_t last);
+    std::vector<Node*> below(const NodesByLabel& candidates, const Node& start, size_t depth) const;
+
+    static void eraseFrom(std::unordered_map<std::string, NodesByLabel>& map,
+                          const std::string& key, std::uint64_t label);
+};
+
+# endif
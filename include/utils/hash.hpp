@@ -0,0 +1,134 @@
+# ifndef UTILS_HASH_HPP
+# define UTILS_HASH_HPP
+
+# include <bit>
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <string_view>
+
+namespace utils {
+
+    /**
+     * @brief Streaming 64-bit content hash, stable across runs and processes.
+     *
+     * Bytes are consumed in 32-byte blocks of four little-endian words, each
+     * mixed into its own lane so that long inputs hash at memory speed. The
+     * result only depends on the concatenated input, not on how it was split
+     * between calls to update(). The hash detects changes; it is not
+     * cryptographic.
+     */
+    class Hasher {
+
+    public:
+        /** @brief Append @p size bytes at @p data. */
+        void update(const void* data, size_t size) {
+            const auto* bytes = static_cast<const std::uint8_t*>(data);
+            _length += size;
+            if (_pending > 0) {
+                const size_t taken = size < kBlock - _pending ? size : kBlock - _pending;
+                std::memcpy(_block + _pending, bytes, taken);
+                _pending += taken;
+                bytes += taken;
+                size -= taken;
+                if (_pending < kBlock) {
+                    return;
+                }
+                mixBlock(_block);
+                _pending = 0;
+            }
+            // lanes kept in locals: stores through the byte pointer could otherwise alias them
+            std::uint64_t a = _lanes[0], b = _lanes[1], c = _lanes[2], d = _lanes[3];
+            for (; size >= kBlock; bytes += kBlock, size -= kBlock) {
+                a = mix(a, load(bytes));
+                b = mix(b, load(bytes + 8));
+                c = mix(c, load(bytes + 16));
+                d = mix(d, load(bytes + 24));
+            }
+            _lanes[0] = a;
+            _lanes[1] = b;
+            _lanes[2] = c;
+            _lanes[3] = d;
+            std::memcpy(_block, bytes, size);
+            _pending = size;
+        }
+
+        /** @brief Append @p text, preceded by its length so that consecutive strings stay apart. */
+        void update(std::string_view text) {
+            update(text.size());
+            update(text.data(), text.size());
+        }
+
+        /** @brief Append the 8 bytes of @p value. */
+        void update(std::uint64_t value) {
+            std::uint8_t bytes[8];
+            for (size_t i = 0; i < 8; ++i) {
+                bytes[i] = static_cast<std::uint8_t>(value >> (8 * i));
+            }
+            update(bytes, 8);
+        }
+
+        /** @brief Hash of everything appended so far. */
+        std::uint64_t digest() const {
+            std::uint64_t state = _length;
+            for (size_t lane = 0; lane < kLanes; ++lane) {
+                state = mix(state, _lanes[lane]);
+            }
+            std::uint8_t word[8];
+            for (size_t offset = 0; offset < _pending; offset += 8) {
+                const size_t count = _pending - offset < 8 ? _pending - offset : 8;
+                std::memset(word, 0, sizeof(word));
+                std::memcpy(word, _block + offset, count);
+                state = mix(state, load(word));
+            }
+            return finalize(state);
+        }
+
+    private:
+        static constexpr size_t kLanes = 4;
+        static constexpr size_t kBlock = 8 * kLanes;
+        static constexpr std::uint64_t kMultiplier = 0x9E3779B97F4A7C15ULL;
+
+        std::uint64_t _lanes[kLanes] = {
+            0x243F6A8885A308D3ULL, 0x13198A2E03707344ULL, 0xA4093822299F31D0ULL, 0x082EFA98EC4E6C89ULL};
+        std::uint64_t _length = 0;
+        std::uint8_t _block[kBlock] = {};
+        size_t _pending = 0;
+
+        static std::uint64_t load(const std::uint8_t* bytes) {
+            std::uint64_t word = 0;
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(&word, bytes, sizeof(word));
+            } else {
+                for (size_t i = 0; i < 8; ++i) {
+                    word |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+                }
+            }
+            return word;
+        }
+
+        static std::uint64_t mix(std::uint64_t state, std::uint64_t word) {
+            word *= kMultiplier;
+            word ^= word >> 29;
+            state ^= word;
+            state = (state << 27) | (state >> 37);
+            return state * 0xBF58476D1CE4E5B9ULL + kMultiplier;
+        }
+
+        static std::uint64_t finalize(std::uint64_t state) {
+            state ^= state >> 30;
+            state *= 0xBF58476D1CE4E5B9ULL;
+            state ^= state >> 27;
+            state *= 0x94D049BB133111EBULL;
+            return state ^ (state >> 31);
+        }
+
+        void mixBlock(const std::uint8_t* bytes) {
+            for (size_t lane = 0; lane < kLanes; ++lane) {
+                _lanes[lane] = mix(_lanes[lane], load(bytes + 8 * lane));
+            }
+        }
+    };
+}
+
+# endif
@@ -2,6 +2,7 @@
 # define UTILS_STRING_HPP
 
 # include <string>
+# include <string_view>
 # include <cstdint>
 
 namespace utils {
@@ -11,6 +12,20 @@ namespace utils {
     bool stringEndsWith(const std::string& fullString, const std::string& ending);
     /** @brief Clip long text to @p maxChars, appending ellipsis when needed. */
     std::string clipStringIfTooLong(const std::string& longString, const size_t& maxChars);
+    /**
+     * @brief Translate a glob pattern into an anchored ECMAScript regex pattern.
+     *
+     * ``*`` matches any sequence of characters and ``?`` any single character;
+     * every other character is matched literally.
+     */
+    std::string globToRegexPattern(const std::string& globPattern);
+    /**
+     * @brief True when the whole of @p text matches the glob @p globPattern.
+     *
+     * Same syntax as globToRegexPattern, matched directly without building a
+     * regex, in linear time for patterns with a single ``*``.
+     */
+    bool globMatch(std::string_view text, std::string_view globPattern);
 }
 
 # endif
@@ -0,0 +1,107 @@
+# ifndef UTILS_THREAD_POOL_HPP
+# define UTILS_THREAD_POOL_HPP
+
+# include <condition_variable>
+# include <cstddef>
+# include <deque>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <vector>
+
+namespace utils {
+
+    /**
+     * @brief Worker threads kept alive between parallel loops.
+     *
+     * parallelFor() splits a range of items into ranges of at least a given
+     * number of items and runs them on the workers and on the calling
+     * thread, so a pool of N threads has N - 1 workers. Loops started from
+     * several threads share the workers; a loop started from within a task
+     * runs on the calling thread alone.
+     *
+     * shared() is the process-wide pool used by the Array kernels, deep
+     * copies and factories. It starts with the number of threads given by
+     * the ``NODER_NUM_THREADS`` environment variable, or the hardware
+     * concurrency when unset.
+     */
+    class ThreadPool {
+
+    public:
+        /** @brief Pool of @p threads threads, counting the caller (0 uses the hardware concurrency). */
+        explicit ThreadPool(size_t threads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief The process-wide pool. */
+        static ThreadPool& shared();
+
+        /** @brief Number of threads running a loop, counting the caller. */
+        size_t threads() const;
+
+        /**
+         * @brief Resize the pool to @p threads threads (0 uses the hardware concurrency).
+         *
+         * Waits for the running loops to finish.
+         */
+        void setThreads(size_t threads);
+
+        /**
+         * @brief Call @p task(begin, end) on consecutive ranges covering [0, @p count).
+         *
+         * Ranges hold at least @p minimumPerTask items, so that small loops
+         * run on the calling thread alone, and there are at most as many
+         * ranges as threads (or as @p maximumTasks, when not 0). Returns
+         * once every range is done and rethrows the first exception thrown
+         * by a task.
+         */
+        void parallelFor(
+            size_t count,
+            size_t minimumPerTask,
+            const std::function<void(size_t, size_t)>& task,
+            size_t maximumTasks = 0);
+
+    private:
+        struct Loop;
+
+        void work();
+        void stopWorkers();
+
+        mutable std::mutex _mutex;
+        std::mutex _resizing;
+        std::condition_variable _wakeUp;
+        std::deque<std::shared_ptr<Loop>> _loops;
+        std::vector<std::thread> _workers;
+        bool _stopping = false;
+    };
+
+    /** @brief Number of hardware threads, at least 1. */
+    size_t hardwareThreads();
+
+    /** @brief Loops over at least twice this many bytes are shared between threads by forEachRange(). */
+    constexpr size_t kMinBytesPerTask = size_t{1} << 20;
+
+    /**
+     * @brief Call @p task(begin, end) on ranges covering [0, @p count), where
+     * each unit spans @p unitBytes bytes.
+     *
+     * Large loops are split between the threads of ThreadPool::shared(),
+     * each range spanning at least kMinBytesPerTask bytes; smaller ones run
+     * on the calling thread without touching the pool.
+     */
+    template <typename Task>
+    void forEachRange(size_t count, size_t unitBytes, Task&& task) {
+        if (count * unitBytes < 2 * kMinBytesPerTask) {
+            task(size_t{0}, count);
+            return;
+        }
+        ThreadPool::shared().parallelFor(count, (kMinBytesPerTask + unitBytes - 1) / unitBytes,
+            [&task](size_t begin, size_t end) noexcept(noexcept(task(begin, end))) { task(begin, end); });
+    }
+
+} // namespace utils
+
+# endif
@@ -0,0 +1,111 @@
+/*
+    Throughput of the elementwise Array operators and reductions, per data type.
+
+    Usage (from a directory containing this file, with noder installed in the
+    current Python environment; see cpp_user_build_and_run.sh):
+
+        NODER_DIR=$(python -c "import noder, os; print(os.path.dirname(noder.__file__))")
+        g++ -std=c++20 -O2 bench_array_kernels.cpp -I"$NODER_DIR/include" \
+            "$NODER_DIR"/libcore_shared.so -Wl,-rpath,"$NODER_DIR" -o bench_array_kernels
+        ./bench_array_kernels [items] [repeat]
+
+    Every operator is timed on contiguous arrays of ``items`` items (default
+    2^22, larger than most caches) with the kernels at the portable level,
+    which runs the same one-item-at-a-time loops as before the vectorized
+    kernels, and at the widest level supported by the processor. The best
+    of ``repeat`` runs (default 10) is reported in GB/s, counting every byte
+    read or written, together with the speedup over the portable level.
+*/
+# include <array/arithmetic.hpp>
+# include <array/array.hpp>
+# include <array/factory/matrices.hpp>
+# include <array/simd.hpp>
+
+# include <algorithm>
+# include <chrono>
+# include <cstdint>
+# include <cstdio>
+# include <cstdlib>
+# include <functional>
+# include <limits>
+# include <string>
+
+namespace {
+
+size_t items = size_t(1) << 22;
+int repeat = 10;
+
+double bestSeconds(const std::function<void()>& operation) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int r = 0; r < repeat; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        operation();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+void report(const char* typeName, const char* operatorName, size_t bytes, const std::function<void()>& operation) {
+    const arraysimd::Level widest = arraysimd::supportedLevel();
+    arraysimd::useLevel(arraysimd::Level::Portable);
+    const double portable = bestSeconds(operation);
+    arraysimd::useLevel(widest);
+    const double vectorized = bestSeconds(operation);
+    std::printf("%-9s %-12s %9.2f %9.2f %8.2fx\n", typeName, operatorName,
+        static_cast<double>(bytes) / portable * 1e-9,
+        static_cast<double>(bytes) / vectorized * 1e-9,
+        portable / vectorized);
+}
+
+template <typename T>
+void benchmark(const char* typeName) {
+    Array array = arrayfactory::ones<T>({items});
+    Array other = arrayfactory::ones<T>({items});
+    Array copy = arrayfactory::ones<T>({items});
+    Array results = arrayfactory::ones<T>({items});
+    Array flags = arrayfactory::zeros<bool>({items});
+    const size_t bytes = items * sizeof(T);
+    volatile bool result = false;
+
+    // adding then subtracting keeps the items bounded over the runs
+    report(typeName, "a += b", 3 * bytes, [&] { array += other; });
+    report(typeName, "a -= b", 3 * bytes, [&] { array -= other; });
+    report(typeName, "a *= b", 3 * bytes, [&] { array *= other; });
+    report(typeName, "a *= 1", 2 * bytes, [&] { array *= T(1); });
+    report(typeName, "c = a + b", 3 * bytes, [&] { arraymath::add(array, other, results); });
+    report(typeName, "c = a < b", 2 * bytes + items, [&] { arraymath::less(array, other, flags); });
+    report(typeName, "a == b", 2 * bytes, [&] { result = array == copy; });
+    report(typeName, "a == 1", bytes, [&] { result = array == T(1); });
+    report(typeName, "isCloseTo", 2 * bytes, [&] { result = array.isCloseTo(copy); });
+    report(typeName, "sum", bytes, [&] { result = array.reduce(Data::Reduction::Sum) == nullptr; });
+    report(typeName, "max", bytes, [&] { result = array.reduce(Data::Reduction::Max) == nullptr; });
+    (void)result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        items = std::strtoull(argv[1], nullptr, 10);
+    }
+    if (argc > 2) {
+        repeat = std::atoi(argv[2]);
+    }
+    std::printf("%zu items, best of %d runs, widest level: %s\n\n", items, repeat,
+        arraysimd::levelName(arraysimd::supportedLevel()));
+    std::printf("%-9s %-12s %9s %9s %9s\n", "dtype", "operator", "portable", "vector", "speedup");
+    std::printf("%-9s %-12s %9s %9s\n", "", "", "(GB/s)", "(GB/s)");
+
+    benchmark<int8_t>("int8");
+    benchmark<int16_t>("int16");
+    benchmark<int32_t>("int32");
+    benchmark<int64_t>("int64");
+    benchmark<uint8_t>("uint8");
+    benchmark<uint16_t>("uint16");
+    benchmark<uint32_t>("uint32");
+    benchmark<uint64_t>("uint64");
+    benchmark<float>("float32");
+    benchmark<double>("float64");
+    return 0;
+}
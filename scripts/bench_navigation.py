@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+"""Time tree searches (``Node.pick()`` queries and ``Node.descendants``).
+
+Usage::
+
+    python scripts/bench_navigation.py [--zones Z] [--fields F] [--levels L]
+                                       [--repeat R] [--save FILE] [--baseline FILE]
+
+Two trees are searched: a wide CGNS-like tree of 20 bases with ``Z`` zones of
+``F`` fields each, and a single chain of ``L`` nested nodes. For every query
+the script reports the best time over ``R`` runs and the number of matches.
+
+To compare two builds (for instance before and after a change to the
+traversal engine), run the script once with ``--save before.json`` on the
+first build, then with ``--baseline before.json`` on the second one: the
+baseline time and the speedup are printed next to each query. Keep ``L``
+moderate when the baseline build searches recursively, since very deep
+chains can overflow its call stack.
+"""
+from __future__ import annotations
+
+import argparse
+import json
+import time
+
+from noder.core import Node
+
+
+def build_wide_tree(zones: int, fields: int) -> Node:
+    root = Node("root", "CGNSTree_t")
+    for b in range(20):
+        base = Node(f"Base{b}", "CGNSBase_t")
+        base.attach_to(root)
+        for z in range(zones):
+            zone = Node(f"Zone{z}", "Zone_t")
+            zone.attach_to(base)
+            for f in range(fields):
+                field = Node(f"Field{f}", "DataArray_t")
+                field.set_data(f"field {f}")
+                field.attach_to(zone)
+    return root
+
+
+def build_deep_tree(levels: int) -> tuple[Node, list[Node]]:
+    root = Node("root", "UserDefinedData_t")
+    chain = [root]
+    for level in range(levels):
+        node = Node(f"Level{level}", "UserDefinedData_t")
+        node.attach_to(chain[-1])
+        chain.append(node)
+    return root, chain
+
+
+def best_time(query, repeat: int) -> tuple[float, int]:
+    best = float("inf")
+    result = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = query()
+        best = min(best, time.perf_counter() - start)
+    if isinstance(result, list):
+        return best, len(result)
+    return best, int(result is not None)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--zones", type=int, default=100)
+    parser.add_argument("--fields", type=int, default=100)
+    parser.add_argument("--levels", type=int, default=2000)
+    parser.add_argument("--repeat", type=int, default=5)
+    parser.add_argument("--save", help="write the timings to this JSON file")
+    parser.add_argument("--baseline", help="JSON file written by --save on another build")
+    args = parser.parse_args()
+
+    wide = build_wide_tree(args.zones, args.fields)
+    deep, chain = build_deep_tree(args.levels)
+    everything = args.levels + 1
+
+    queries = [
+        ("wide descendants", lambda: wide.descendants()),
+        ("wide all_by_name miss", lambda: wide.pick().all_by_name("missing")),
+        ("wide all_by_type", lambda: wide.pick().all_by_type("Zone_t")),
+        ("wide all_by_name_regex", lambda: wide.pick().all_by_name_regex("^Field9")),
+        ("wide all_by_name_glob", lambda: wide.pick().all_by_name_glob("Field*9")),
+        ("wide all_by_type_glob", lambda: wide.pick().all_by_type_glob("Zone*")),
+        ("wide all_by_data_glob", lambda: wide.pick().all_by_data_glob("field 1*")),
+        ("wide all_by_and_glob", lambda: wide.pick().all_by_and_glob("Field1*", "DataArray_t", "*1")),
+        ("wide by_name last", lambda: wide.pick().by_name(f"Field{args.fields - 1}")),
+        ("deep descendants", lambda: deep.descendants()),
+        ("deep all_by_name_regex", lambda: deep.pick().all_by_name_regex("9$", everything)),
+        ("deep all_by_type_glob", lambda: deep.pick().all_by_type_glob("User*", everything)),
+        ("deep by_name deepest", lambda: deep.pick().by_name(f"Level{args.levels - 1}", everything)),
+    ]
+
+    baseline = {}
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+
+    print(f"{'query':<28}{'matches':>9}{'time [ms]':>12}"
+          + (f"{'baseline [ms]':>15}{'speedup':>9}" if baseline else ""))
+    timings = {}
+    for label, query in queries:
+        elapsed, matches = best_time(query, args.repeat)
+        timings[label] = elapsed
+        line = f"{label:<28}{matches:>9}{elapsed * 1e3:>12.2f}"
+        if label in baseline:
+            line += f"{baseline[label] * 1e3:>15.2f}{baseline[label] / elapsed:>9.2f}"
+        print(line)
+
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(timings, f, indent=2)
+
+    # release the chain from the bottom so that freeing it does not recurse
+    for node in reversed(chain[1:]):
+        node.detach()
+
+
+if __name__ == "__main__":
+    main()
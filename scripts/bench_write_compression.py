@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+"""Compare CGNS/HDF5 write throughput and file size across storage settings.
+
+Usage::
+
+    python scripts/bench_write_compression.py [--points N] [--fields F] [--repeat R]
+
+A synthetic zone with ``F`` smooth float64 flow-solution fields of ``N``
+points each is written with several chunk/filter settings. For every setting
+the script reports the best write time over ``R`` runs, the write throughput
+of the raw payload, the file size and the compression ratio, then reads the
+file back to check values are preserved.
+"""
+from __future__ import annotations
+
+import argparse
+import os
+import tempfile
+import time
+
+import numpy as np
+
+import noder.core.io as gio
+from noder.core import Node
+
+SETTINGS = [
+    ("contiguous", dict()),
+    ("chunked", dict(chunks="auto", chunk_bytes=1 << 20, deflate_level=0, shuffle=True)),
+    ("deflate-1", dict(deflate_level=1)),
+    ("deflate-4", dict(deflate_level=4)),
+    ("deflate-9", dict(deflate_level=9)),
+    ("shuffle+deflate-1", dict(deflate_level=1, shuffle=True)),
+    ("shuffle+deflate-4", dict(deflate_level=4, shuffle=True)),
+    ("shuffle+deflate-4 256KiB", dict(deflate_level=4, shuffle=True, chunk_bytes=1 << 18)),
+    ("shuffle+deflate-4 4MiB", dict(deflate_level=4, shuffle=True, chunk_bytes=1 << 22)),
+]
+
+
+def build_tree(points: int, fields: int) -> tuple[Node, dict[str, np.ndarray]]:
+    x = np.linspace(0.0, 10.0, points)
+    root = Node("Base", "CGNSBase_t")
+    zone = Node("Zone", "Zone_t")
+    zone.attach_to(root)
+    solution = Node("FlowSolution", "FlowSolution_t")
+    solution.attach_to(zone)
+    values = {}
+    for i in range(fields):
+        name = f"Field{i}"
+        data = np.sin(x * (i + 1)) + 0.01 * i
+        node = Node(name, "DataArray_t")
+        node.set_data(data)
+        node.attach_to(solution)
+        values[name] = data
+    return root, values
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--points", type=int, default=2_000_000)
+    parser.add_argument("--fields", type=int, default=5)
+    parser.add_argument("--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    root, values = build_tree(args.points, args.fields)
+    payload_bytes = sum(v.nbytes for v in values.values())
+    print(f"payload: {args.fields} x {args.points} float64 = {payload_bytes / 2**20:.1f} MiB")
+    print(f"{'setting':<28}{'time [s]':>10}{'MiB/s':>10}{'size [MiB]':>12}{'ratio':>8}")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        reference_size = None
+        for label, options in SETTINGS:
+            filename = os.path.join(tmp, "bench.cgns")
+            best = float("inf")
+            for _ in range(args.repeat):
+                start = time.perf_counter()
+                root.write(filename, **options)
+                best = min(best, time.perf_counter() - start)
+            size = os.path.getsize(filename)
+            if reference_size is None:
+                reference_size = size
+
+            read_back = gio.read(filename)
+            for name, expected in values.items():
+                got = read_back.get_at_path(f"Base/Zone/FlowSolution/{name}").data().getPyArray()
+                np.testing.assert_array_equal(got, expected)
+
+            print(f"{label:<28}{best:>10.3f}{payload_bytes / 2**20 / best:>10.1f}"
+                  f"{size / 2**20:>12.1f}{reference_size / size:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
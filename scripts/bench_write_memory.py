@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+"""Measure the peak memory used by ``Node.write`` for several array layouts.
+
+Usage::
+
+    python scripts/bench_write_memory.py [--points N] [--staging-bytes B]
+
+Each case runs in a fresh Python process: a float64 field of about ``N``
+points is built with the given memory layout, then written to a CGNS/HDF5
+file. The script reports the peak resident set size before and during the
+write, and the extra memory taken by the write relative to the payload size.
+Fortran-contiguous arrays should need no extra memory; other layouts should
+only need a staging buffer of at most ``B`` bytes.
+"""
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+LAYOUTS = ["fortran", "c", "strided", "transposed"]
+
+CASE = r"""
+import json, resource, sys, time
+import numpy as np
+from noder.core import Node
+
+layout, points, staging_bytes, filename = sys.argv[1], int(sys.argv[2]), int(sys.argv[3]), sys.argv[4]
+side = max(1, round((points / 8) ** (1 / 3)))
+shape = (2 * side, 2 * side, 2 * side)
+if layout == "fortran":
+    data = np.asfortranarray(np.random.default_rng(0).random(shape))
+elif layout == "c":
+    data = np.random.default_rng(0).random(shape)
+elif layout == "strided":
+    data = np.random.default_rng(0).random((shape[0], shape[1], 2 * shape[2]))[:, :, ::2]
+else:
+    data = np.random.default_rng(0).random(shape).transpose(2, 0, 1)
+
+root = Node("root", "UserDefinedData_t")
+field = Node("field", "DataArray_t")
+field.set_data(data)
+field.attach_to(root)
+payload = field.data().getPyArray().nbytes
+
+before = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss * 1024
+start = time.perf_counter()
+root.write(filename, staging_bytes=staging_bytes)
+elapsed = time.perf_counter() - start
+peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss * 1024
+print(json.dumps(dict(payload=payload, before=before, peak=peak, time=elapsed)))
+"""
+
+
+def run_case(layout: str, points: int, staging_bytes: int, filename: str) -> dict:
+    output = subprocess.run(
+        [sys.executable, "-c", CASE, layout, str(points), str(staging_bytes), filename],
+        check=True, capture_output=True, text=True).stdout
+    return json.loads(output.strip().splitlines()[-1])
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--points", type=int, default=32_000_000)
+    parser.add_argument("--staging-bytes", type=int, default=4 << 20)
+    args = parser.parse_args()
+
+    print(f"{'layout':<12}{'payload [MiB]':>15}{'RSS before':>12}{'RSS peak':>10}"
+          f"{'extra [MiB]':>13}{'extra/payload':>15}{'time [s]':>10}")
+    with tempfile.TemporaryDirectory() as tmp:
+        filename = os.path.join(tmp, "bench.cgns")
+        for layout in LAYOUTS:
+            result = run_case(layout, args.points, args.staging_bytes, filename)
+            extra = max(0, result["peak"] - result["before"])
+            print(f"{layout:<12}{result['payload'] / 2**20:>15.1f}{result['before'] / 2**20:>12.1f}"
+                  f"{result['peak'] / 2**20:>10.1f}{extra / 2**20:>13.1f}"
+                  f"{extra / result['payload']:>15.2f}{result['time']:>10.3f}")
+
+
+if __name__ == "__main__":
+    main()
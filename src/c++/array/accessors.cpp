@@ -3,6 +3,7 @@
 #include "array/factory/strings.hpp"
 
 #include <codecvt>
+#include <cstring>
 #include <locale>
 #include <stdexcept>
 
@@ -175,6 +176,90 @@ std::string Array::extractStringOfKindS() const {
     return outputString;
 }
 
+namespace {
+
+/** Appends the UTF-8 encoding of @p codePoint; false, leaving @p text unchanged, for invalid code points. */
+bool appendUtf8(std::string& text, char32_t codePoint) {
+    if (codePoint < 0x80) {
+        text.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+        return false;
+    } else if (codePoint < 0x10000) {
+        text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint <= 0x10FFFF) {
+        text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+std::string_view Array::stringView(std::string& buffer) const {
+    const char kind = this->dtypeKind();
+    if (kind != 'S' && kind != 'U') {
+        return std::string_view();
+    }
+    const auto* bytes = static_cast<const std::uint8_t*>(this->rawData());
+    const size_t itemsize = this->itemsize();
+
+    if (kind == 'S') {
+        // a run of characters in C order is its own text once trailing padding is dropped
+        const bool inItemOrder = this->isContiguousInStyleC() || (this->dimensions() <= 1 && this->isContiguous());
+        if (inItemOrder && (itemsize == sizeof(char) || this->size() == 1)) {
+            const auto* text = reinterpret_cast<const char*>(bytes);
+            size_t length = this->size() * itemsize;
+            while (length > 0 && text[length - 1] == '\0') {
+                --length;
+            }
+            if (std::memchr(text, '\0', length) == nullptr) {
+                return std::string_view(text, length);
+            }
+        }
+        const bool concatenateCharacters = itemsize == sizeof(char);
+        buffer.clear();
+        for (size_t i = 0; i < this->size(); ++i) {
+            if (i > 0 && !concatenateCharacters) {
+                buffer.push_back(' ');
+            }
+            const auto* text = reinterpret_cast<const char*>(bytes + this->getByteOffsetFromFlatIndex(i));
+            size_t length = itemsize;
+            while (length > 0 && text[length - 1] == '\0') {
+                --length;
+            }
+            buffer.append(text, length);
+        }
+        return buffer;
+    }
+
+    const bool concatenateCharacters = itemsize == sizeof(char32_t);
+    const size_t codePointCapacity = itemsize / sizeof(char32_t);
+    buffer.clear();
+    for (size_t i = 0; i < this->size(); ++i) {
+        if (i > 0 && !concatenateCharacters) {
+            buffer.push_back(' ');
+        }
+        const auto* codePoints = reinterpret_cast<const char32_t*>(bytes + this->getByteOffsetFromFlatIndex(i));
+        for (size_t j = 0; j < codePointCapacity && codePoints[j] != U'\0'; ++j) {
+            if (!appendUtf8(buffer, codePoints[j])) {
+                // let the converter of extractString() handle or report invalid code points
+                buffer = this->extractStringOfKindU();
+                return buffer;
+            }
+        }
+    }
+    return buffer;
+}
+
 template <typename... T>
 struct Instantiator {
     template <typename... U>
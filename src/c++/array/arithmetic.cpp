@@ -0,0 +1,448 @@
+# include "array/arithmetic.hpp"
+# include "array/simd.hpp"
+# include "array/strided_loop.hpp"
+
+# include <algorithm>
+# include <array>
+# include <cmath>
+# include <cstdint>
+# include <stdexcept>
+# include <string>
+# include <type_traits>
+
+namespace {
+
+using arraymath::Operation;
+
+// items converted and combined at a time: the blocks of both operands and
+// of the results stay in the L1 cache
+constexpr size_t kBlock = 1024;
+
+bool compares(Operation operation) {
+    switch (operation) {
+        case Operation::Equal:
+        case Operation::NotEqual:
+        case Operation::Less:
+        case Operation::LessEqual:
+        case Operation::Greater:
+        case Operation::GreaterEqual:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::string operationName(Operation operation) {
+    switch (operation) {
+        case Operation::Add: return "add";
+        case Operation::Subtract: return "subtract";
+        case Operation::Multiply: return "multiply";
+        case Operation::Divide: return "divide";
+        case Operation::Minimum: return "minimum";
+        case Operation::Maximum: return "maximum";
+        case Operation::Equal: return "equal";
+        case Operation::NotEqual: return "notEqual";
+        case Operation::Less: return "less";
+        case Operation::LessEqual: return "lessEqual";
+        case Operation::Greater: return "greater";
+        case Operation::GreaterEqual: return "greaterEqual";
+    }
+    return "apply";
+}
+
+arraysimd::Operation simdOperation(Operation operation) {
+    switch (operation) {
+        case Operation::Add: return arraysimd::Operation::Add;
+        case Operation::Subtract: return arraysimd::Operation::Subtract;
+        case Operation::Multiply: return arraysimd::Operation::Multiply;
+        case Operation::Divide: return arraysimd::Operation::Divide;
+        case Operation::Minimum: return arraysimd::Operation::Minimum;
+        default: return arraysimd::Operation::Maximum;
+    }
+}
+
+arraysimd::Comparison simdComparison(Operation operation) {
+    switch (operation) {
+        case Operation::Equal: return arraysimd::Comparison::Equal;
+        case Operation::NotEqual: return arraysimd::Comparison::NotEqual;
+        case Operation::Less: return arraysimd::Comparison::Less;
+        case Operation::LessEqual: return arraysimd::Comparison::LessEqual;
+        case Operation::Greater: return arraysimd::Comparison::Greater;
+        default: return arraysimd::Comparison::GreaterEqual;
+    }
+}
+
+/** Result of @p call(utils::TypeTag<T>{}) for the numeric type @p T of @p typeId. */
+template <typename Call>
+decltype(auto) withType(ArrayTypeId typeId, Call&& call) {
+    switch (typeId) {
+        case ArrayTypeId::Bool: return call(utils::TypeTag<bool>{});
+        case ArrayTypeId::Int8: return call(utils::TypeTag<int8_t>{});
+        case ArrayTypeId::Int16: return call(utils::TypeTag<int16_t>{});
+        case ArrayTypeId::Int32: return call(utils::TypeTag<int32_t>{});
+        case ArrayTypeId::Int64: return call(utils::TypeTag<int64_t>{});
+        case ArrayTypeId::UInt8: return call(utils::TypeTag<uint8_t>{});
+        case ArrayTypeId::UInt16: return call(utils::TypeTag<uint16_t>{});
+        case ArrayTypeId::UInt32: return call(utils::TypeTag<uint32_t>{});
+        case ArrayTypeId::UInt64: return call(utils::TypeTag<uint64_t>{});
+        case ArrayTypeId::Float32: return call(utils::TypeTag<float>{});
+        case ArrayTypeId::Float64: return call(utils::TypeTag<double>{});
+        default: break;
+    }
+    throw std::runtime_error("arraymath: unsupported array data type");
+}
+
+char kindOf(ArrayTypeId typeId) {
+    return ArrayDType{typeId, 0}.kind();
+}
+
+std::string nameOf(ArrayTypeId typeId) {
+    return ArrayDType{typeId, 0}.name();
+}
+
+size_t sizeOf(ArrayTypeId typeId) {
+    return withType(typeId, []<typename T>(utils::TypeTag<T>) { return sizeof(T); });
+}
+
+ArrayTypeId typeOf(char kind, size_t size) {
+    if (kind == 'f') {
+        return size == 4 ? ArrayTypeId::Float32 : ArrayTypeId::Float64;
+    }
+    const bool isSigned = kind == 'i';
+    switch (size) {
+        case 1: return isSigned ? ArrayTypeId::Int8 : ArrayTypeId::UInt8;
+        case 2: return isSigned ? ArrayTypeId::Int16 : ArrayTypeId::UInt16;
+        case 4: return isSigned ? ArrayTypeId::Int32 : ArrayTypeId::UInt32;
+        default: return isSigned ? ArrayTypeId::Int64 : ArrayTypeId::UInt64;
+    }
+}
+
+/** 0 for bool, 1 for integers and 2 for floating point: results are only cast to types of the same rank or above. */
+int rankOf(ArrayTypeId typeId) {
+    const char kind = kindOf(typeId);
+    return kind == 'b' ? 0 : (kind == 'f' ? 2 : 1);
+}
+
+std::string shapeString(const std::vector<size_t>& shape) {
+    std::string text = "(";
+    for (size_t dim = 0; dim < shape.size(); ++dim) {
+        text += (dim == 0 ? "" : ", ") + std::to_string(shape[dim]);
+    }
+    return text + (shape.size() == 1 ? ",)" : ")");
+}
+
+void checkNumeric(ArrayTypeId typeId, const char* context) {
+    if (typeId == ArrayTypeId::None || ArrayDType{typeId, 0}.isString()) {
+        throw std::invalid_argument(std::string(context) + ": operands must be numeric arrays, not "
+            + (typeId == ArrayTypeId::None ? "none" : "string") + " arrays");
+    }
+}
+
+/** Broadcast shape of @p a and @p b, (1,) for two arrays without axes. */
+std::vector<size_t> resultShape(const Array& a, const Array& b) {
+    std::vector<size_t> shape = arraymath::broadcastShapes(a.shape(), b.shape());
+    if (shape.empty()) {
+        shape = {1};
+    }
+    return shape;
+}
+
+/** @p array seen with shape @p shape: broadcast axes get a zero stride. */
+Array broadcastView(const Array& array, const std::vector<size_t>& shape) {
+    const std::vector<size_t> arrayShape = array.shape();
+    const std::vector<size_t> arrayStrides = array.strides();
+    const size_t offset = shape.size() - arrayShape.size();
+    std::vector<size_t> strides(shape.size(), 0);
+    for (size_t dim = 0; dim < arrayShape.size(); ++dim) {
+        strides[offset + dim] = arrayShape[dim] == 1 ? 0 : arrayStrides[dim];
+    }
+    return Array(array.typeId(), array.itemsize(), const_cast<void*>(array.rawData()), shape, strides,
+                 array.owner(), array.ownerKind());
+}
+
+/**
+ * @p operand broadcast to the shape of @p out, read from a copy when it
+ * overlaps @p out elsewhere than on the same items.
+ */
+Array operandFor(const Array& operand, const Array& out) {
+    const Array view = broadcastView(operand, out.shape());
+    const bool sameItems = view.rawData() == out.rawData() && view.itemsize() == out.itemsize()
+        && view.strides() == out.strides();
+    if (!sameItems && arrayiter::overlap(view, out)) {
+        return broadcastView(operand.copyWithOrder('A'), out.shape());
+    }
+    return view;
+}
+
+/** Copy @p count items @p sourceStride bytes apart to items @p destinationStride bytes apart, converting them. */
+using Convert = void (*)(const std::uint8_t* source, size_t sourceStride,
+                         std::uint8_t* destination, size_t destinationStride, size_t count);
+
+template <typename From, typename To>
+void convertItems(const std::uint8_t* source, size_t sourceStride,
+                  std::uint8_t* destination, size_t destinationStride, size_t count) {
+    for (size_t i = 0; i < count; ++i, source += sourceStride, destination += destinationStride) {
+        const From item = *reinterpret_cast<const From*>(source);
+        if constexpr (std::is_same_v<To, bool> && std::is_floating_point_v<From>) {
+            // as in NumPy, every non-zero value (NaN and denormals included) is true
+            *reinterpret_cast<To*>(destination) = std::fpclassify(item) != FP_ZERO;
+        } else {
+            *reinterpret_cast<To*>(destination) = static_cast<To>(item);
+        }
+    }
+}
+
+template <typename To>
+Convert converterTo(ArrayTypeId from) {
+    return withType(from, []<typename From>(utils::TypeTag<From>) -> Convert { return &convertItems<From, To>; });
+}
+
+template <typename From>
+Convert converterFrom(ArrayTypeId to) {
+    return withType(to, []<typename To>(utils::TypeTag<To>) -> Convert { return &convertItems<From, To>; });
+}
+
+/**
+ * Items of an operand, computed in type @p C: its runs of @p C items are
+ * read in place, other items are converted into a block first.
+ */
+template <typename C>
+struct Input {
+    const std::uint8_t* bytes;
+    bool direct;
+    Convert convert;
+
+    explicit Input(const Array& operand)
+        : bytes(static_cast<const std::uint8_t*>(operand.rawData())),
+          direct(operand.typeId() == Array::typeIdFor<C>()),
+          convert(converterTo<C>(operand.typeId())) {}
+
+    /** @p count items from byte @p offset, @p stride bytes apart. */
+    const C* items(size_t offset, size_t stride, size_t count, C* block) const {
+        if (direct && stride == sizeof(C)) {
+            return reinterpret_cast<const C*>(bytes + offset);
+        }
+        if (stride == 0) {
+            C item;
+            convert(bytes + offset, 0, reinterpret_cast<std::uint8_t*>(&item), 0, 1);
+            std::fill_n(block, count, item);
+            return block;
+        }
+        convert(bytes + offset, stride, reinterpret_cast<std::uint8_t*>(block), sizeof(C), count);
+        return block;
+    }
+};
+
+/** values[i] = values[i] (op) others[i]: logical or and and for bool items, stored as the bytes 0 and 1. */
+template <typename C>
+void combineItems(Operation operation, C* values, const C* others, size_t count) {
+    if constexpr (std::is_same_v<C, bool>) {
+        const bool either = operation == Operation::Add || operation == Operation::Maximum;
+        arraysimd::apply(either ? arraysimd::Operation::Maximum : arraysimd::Operation::Minimum,
+                         reinterpret_cast<std::uint8_t*>(values), reinterpret_cast<const std::uint8_t*>(others), count);
+    } else {
+        arraysimd::apply(simdOperation(operation), values, others, count);
+    }
+}
+
+/** Results of @p operation computed in type @p C on @p a and @p b, broadcast to the shape of @p out. */
+template <typename C, bool Compares>
+void combine(Operation operation, const Array& a, const Array& b, Array& out) {
+    using R = std::conditional_t<Compares, bool, C>;
+    const Input<C> x(a);
+    const Input<C> y(b);
+    auto* outBytes = static_cast<std::uint8_t*>(out.rawData());
+    const bool directOut = out.typeId() == Array::typeIdFor<R>();
+    const Convert store = converterFrom<R>(out.typeId());
+
+    auto block = [&](const std::array<size_t, 3>& offsets, const std::array<size_t, 3>& strides, size_t count) {
+        C xBlock[kBlock];
+        C yBlock[kBlock];
+        R resultBlock[kBlock];
+        R* results = directOut && strides[0] == sizeof(R) ? reinterpret_cast<R*>(outBytes + offsets[0]) : resultBlock;
+        const C* xItems = x.items(offsets[1], strides[1], count, xBlock);
+        const C* yItems = y.items(offsets[2], strides[2], count, yBlock);
+        if constexpr (Compares) {
+            arraysimd::compare(simdComparison(operation), xItems, yItems, results, count);
+        } else {
+            if (yItems == results && xItems != results) {
+                // the second operand is the output: keep its items before writing the first one
+                std::copy_n(yItems, count, yBlock);
+                yItems = yBlock;
+            }
+            if (xItems != results) {
+                std::copy_n(xItems, count, results);
+            }
+            if (strides[2] == 0 && !std::is_same_v<C, bool>) {
+                arraysimd::applyScalar(simdOperation(operation), results, yItems[0], count);
+            } else {
+                combineItems(operation, results, yItems, count);
+            }
+        }
+        if (results == resultBlock) {
+            store(reinterpret_cast<const std::uint8_t*>(resultBlock), sizeof(R), outBytes + offsets[0], strides[0], count);
+        }
+    };
+
+    const arrayiter::StridedLoop<3> loop({&out, &a, &b}, true);
+    const size_t outerRows = loop.outerRows();
+    if (outerRows == 0) {
+        return;
+    }
+    const size_t unitBytes = out.itemsize() + a.itemsize() + b.itemsize();
+    utils::forEachRange(outerRows, out.size() / outerRows * unitBytes, [&](size_t begin, size_t end) {
+        loop.forEachRow([&](const std::array<size_t, 3>& offsets, const std::array<size_t, 3>& strides, size_t count) {
+            // long rows are split too; inside a shared range this runs inline
+            utils::forEachRange(count, unitBytes, [&](size_t rowBegin, size_t rowEnd) {
+                for (size_t i = rowBegin; i < rowEnd; i += kBlock) {
+                    block({offsets[0] + i * strides[0], offsets[1] + i * strides[1], offsets[2] + i * strides[2]},
+                          strides, std::min(kBlock, rowEnd - i));
+                }
+            });
+            return true;
+        }, begin, end);
+    });
+}
+
+} // namespace
+
+namespace arraymath {
+
+ArrayTypeId promoteTypes(ArrayTypeId a, ArrayTypeId b) {
+    checkNumeric(a, "arraymath::promoteTypes");
+    checkNumeric(b, "arraymath::promoteTypes");
+    if (a == b || b == ArrayTypeId::Bool) {
+        return a;
+    }
+    if (a == ArrayTypeId::Bool) {
+        return b;
+    }
+    const char aKind = kindOf(a);
+    const char bKind = kindOf(b);
+    const size_t aSize = sizeOf(a);
+    const size_t bSize = sizeOf(b);
+    if (aKind == bKind) {
+        return aSize >= bSize ? a : b;
+    }
+    if (aKind == 'f' || bKind == 'f') {
+        // float32 holds the integers of up to 16 bits exactly, float64 the others approximately
+        const size_t floatSize = aKind == 'f' ? aSize : bSize;
+        const size_t integerSize = aKind == 'f' ? bSize : aSize;
+        return typeOf('f', std::max<size_t>(floatSize, integerSize <= 2 ? 4 : 8));
+    }
+    const size_t signedSize = aKind == 'i' ? aSize : bSize;
+    const size_t unsignedSize = aKind == 'i' ? bSize : aSize;
+    if (signedSize > unsignedSize) {
+        return typeOf('i', signedSize);
+    }
+    return unsignedSize < 8 ? typeOf('i', 2 * unsignedSize) : ArrayTypeId::Float64;
+}
+
+ArrayTypeId resultType(Operation operation, ArrayTypeId a, ArrayTypeId b) {
+    const ArrayTypeId promoted = promoteTypes(a, b);
+    if (compares(operation)) {
+        return ArrayTypeId::Bool;
+    }
+    if (operation == Operation::Divide) {
+        return kindOf(promoted) == 'f' ? promoted : ArrayTypeId::Float64;
+    }
+    if (operation == Operation::Subtract && promoted == ArrayTypeId::Bool) {
+        throw std::invalid_argument("arraymath::subtract: cannot subtract bool arrays, use notEqual instead");
+    }
+    return promoted;
+}
+
+std::vector<size_t> broadcastShapes(const std::vector<size_t>& a, const std::vector<size_t>& b) {
+    const size_t dimensions = std::max(a.size(), b.size());
+    std::vector<size_t> shape(dimensions);
+    for (size_t i = 0; i < dimensions; ++i) {
+        const size_t aExtent = i < a.size() ? a[a.size() - 1 - i] : 1;
+        const size_t bExtent = i < b.size() ? b[b.size() - 1 - i] : 1;
+        if (aExtent != bExtent && aExtent != 1 && bExtent != 1) {
+            throw std::invalid_argument("arraymath: operands of shapes " + shapeString(a) + " and "
+                + shapeString(b) + " cannot be broadcast together");
+        }
+        shape[dimensions - 1 - i] = aExtent == 1 ? bExtent : aExtent;
+    }
+    return shape;
+}
+
+Array apply(Operation operation, const Array& a, const Array& b) {
+    const std::string context = "arraymath::" + operationName(operation);
+    checkNumeric(a.typeId(), context.c_str());
+    checkNumeric(b.typeId(), context.c_str());
+    const ArrayTypeId type = resultType(operation, a.typeId(), b.typeId());
+    const std::vector<size_t> shape = resultShape(a, b);
+    // results laid out as the operand of their shape, as NumPy's order 'K' does for contiguous operands
+    const Array& model = a.shape() == shape ? a : b;
+    const char order = model.isContiguousInStyleFortran() && !model.isContiguousInStyleC() ? 'F' : 'C';
+    Array out = withType(type, [&]<typename T>(utils::TypeTag<T>) { return arrayfactory::empty<T>(shape, order); });
+    return apply(operation, a, b, out);
+}
+
+Array& apply(Operation operation, const Array& a, const Array& b, Array& out) {
+    const std::string context = "arraymath::" + operationName(operation);
+    checkNumeric(a.typeId(), context.c_str());
+    checkNumeric(b.typeId(), context.c_str());
+    const ArrayTypeId type = resultType(operation, a.typeId(), b.typeId());
+    const std::vector<size_t> shape = resultShape(a, b);
+    if (out.hasString() || out.typeId() == ArrayTypeId::None) {
+        throw std::invalid_argument(context + ": cannot write results to a "
+            + (out.hasString() ? "string" : "none") + " array");
+    }
+    if (out.shape() != shape) {
+        throw std::invalid_argument(context + ": output of shape " + shapeString(out.shape())
+            + " instead of the broadcast shape " + shapeString(shape));
+    }
+    if (rankOf(out.typeId()) < rankOf(type)) {
+        throw std::invalid_argument(context + ": cannot cast " + nameOf(type) + " results to a "
+            + out.dtype() + " output");
+    }
+    if (out.size() == 0) {
+        return out;
+    }
+
+    const Array x = operandFor(a, out);
+    const Array y = operandFor(b, out);
+    const ArrayTypeId computed = compares(operation) ? promoteTypes(a.typeId(), b.typeId()) : type;
+    withType(computed, [&]<typename C>(utils::TypeTag<C>) {
+        if (compares(operation)) {
+            combine<C, true>(operation, x, y, out);
+        } else {
+            combine<C, false>(operation, x, y, out);
+        }
+    });
+    return out;
+}
+
+Array add(const Array& a, const Array& b) { return apply(Operation::Add, a, b); }
+Array& add(const Array& a, const Array& b, Array& out) { return apply(Operation::Add, a, b, out); }
+Array subtract(const Array& a, const Array& b) { return apply(Operation::Subtract, a, b); }
+Array& subtract(const Array& a, const Array& b, Array& out) { return apply(Operation::Subtract, a, b, out); }
+Array multiply(const Array& a, const Array& b) { return apply(Operation::Multiply, a, b); }
+Array& multiply(const Array& a, const Array& b, Array& out) { return apply(Operation::Multiply, a, b, out); }
+Array divide(const Array& a, const Array& b) { return apply(Operation::Divide, a, b); }
+Array& divide(const Array& a, const Array& b, Array& out) { return apply(Operation::Divide, a, b, out); }
+Array minimum(const Array& a, const Array& b) { return apply(Operation::Minimum, a, b); }
+Array& minimum(const Array& a, const Array& b, Array& out) { return apply(Operation::Minimum, a, b, out); }
+Array maximum(const Array& a, const Array& b) { return apply(Operation::Maximum, a, b); }
+Array& maximum(const Array& a, const Array& b, Array& out) { return apply(Operation::Maximum, a, b, out); }
+Array equal(const Array& a, const Array& b) { return apply(Operation::Equal, a, b); }
+Array& equal(const Array& a, const Array& b, Array& out) { return apply(Operation::Equal, a, b, out); }
+Array notEqual(const Array& a, const Array& b) { return apply(Operation::NotEqual, a, b); }
+Array& notEqual(const Array& a, const Array& b, Array& out) { return apply(Operation::NotEqual, a, b, out); }
+Array less(const Array& a, const Array& b) { return apply(Operation::Less, a, b); }
+Array& less(const Array& a, const Array& b, Array& out) { return apply(Operation::Less, a, b, out); }
+Array lessEqual(const Array& a, const Array& b) { return apply(Operation::LessEqual, a, b); }
+Array& lessEqual(const Array& a, const Array& b, Array& out) { return apply(Operation::LessEqual, a, b, out); }
+Array greater(const Array& a, const Array& b) { return apply(Operation::Greater, a, b); }
+Array& greater(const Array& a, const Array& b, Array& out) { return apply(Operation::Greater, a, b, out); }
+Array greaterEqual(const Array& a, const Array& b) { return apply(Operation::GreaterEqual, a, b); }
+Array& greaterEqual(const Array& a, const Array& b, Array& out) { return apply(Operation::GreaterEqual, a, b, out); }
+
+} // namespace arraymath
+
+Array operator+(const Array& a, const Array& b) { return arraymath::add(a, b); }
+Array operator-(const Array& a, const Array& b) { return arraymath::subtract(a, b); }
+Array operator*(const Array& a, const Array& b) { return arraymath::multiply(a, b); }
+Array operator/(const Array& a, const Array& b) { return arraymath::divide(a, b); }
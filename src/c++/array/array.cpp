@@ -2,6 +2,8 @@
 #include "array/assertions.hpp"
 #include "array/factory/matrices.hpp"
 #include "array/factory/strings.hpp"
+#include "array/relayout.hpp"
+#include "utils/hash.hpp"
 
 #include <cctype>
 #include <codecvt>
@@ -92,54 +94,6 @@ std::vector<size_t> computeByteStrides(
     return strides;
 }
 
-std::vector<size_t> indicesFromFlatIndex(
-    size_t flatIndex,
-    const std::vector<size_t>& shape,
-    char order,
-    const char* context) {
-
-    const char normalizedOrder = normalizeOrder(order, context);
-    std::vector<size_t> indices(shape.size(), 0);
-
-    if (shape.empty()) {
-        return indices;
-    }
-
-    if (normalizedOrder == 'C') {
-        for (size_t j = 0; j < shape.size(); ++j) {
-            const size_t dim = shape.size() - 1 - j;
-            const size_t axisExtent = shape[dim];
-            indices[dim] = axisExtent == 0 ? 0 : flatIndex % axisExtent;
-            flatIndex = axisExtent == 0 ? 0 : flatIndex / axisExtent;
-        }
-        return indices;
-    }
-
-    for (size_t dim = 0; dim < shape.size(); ++dim) {
-        const size_t axisExtent = shape[dim];
-        indices[dim] = axisExtent == 0 ? 0 : flatIndex % axisExtent;
-        flatIndex = axisExtent == 0 ? 0 : flatIndex / axisExtent;
-    }
-    return indices;
-}
-
-size_t byteOffsetFromIndices(const Array& array, const std::vector<size_t>& indices) {
-    const std::vector<size_t> shape = array.shape();
-    const std::vector<size_t> strides = array.strides();
-    if (indices.size() != shape.size()) {
-        throw std::runtime_error("Array: wrong number of indices");
-    }
-
-    size_t offset = 0;
-    for (size_t i = 0; i < indices.size(); ++i) {
-        if (indices[i] >= shape[i]) {
-            throw std::runtime_error("Array: index out of bounds");
-        }
-        offset += indices[i] * strides[i];
-    }
-    return offset;
-}
-
 std::u32string u32StringFromRaw(const char32_t* data, size_t codePointCapacity) {
     std::u32string output;
     output.reserve(codePointCapacity);
@@ -209,34 +163,9 @@ std::shared_ptr<Data> fullFromDtype(
     throw std::invalid_argument(std::string(context) + ": unsupported dtype '" + dtypeName + "'");
 }
 
-template <typename T>
-Array makeDeepCopyImpl(const Array& source, char order) {
-    const std::vector<size_t> strides = computeByteStrides(source.shape(), sizeof(T), order, "Array::copy");
-    const size_t byteCount = checkedByteCount(source.shape(), sizeof(T), "Array::copy");
-    auto owner = allocateBytes(byteCount, false);
-    Array copied(Array::typeIdFor<T>(), sizeof(T), owner.get(), source.shape(), strides, owner);
-
-    if (source.size() == 0) {
-        return copied;
-    }
-
-    if ((order == 'C' && source.isContiguousInStyleC()) || (order == 'F' && source.isContiguousInStyleFortran())) {
-        std::memcpy(copied.rawData(), source.rawData(), byteCount);
-        return copied;
-    }
-
-    T* dst = copied.getPointerOfModifiableDataFast<T>();
-    for (size_t i = 0; i < source.size(); ++i) {
-        const std::vector<size_t> indices = indicesFromFlatIndex(i, source.shape(), order, "Array::copy");
-        const size_t sourceOffset = byteOffsetFromIndices(source, indices) / sizeof(T);
-        dst[i] = source.getPointerOfReadOnlyDataFast<T>()[sourceOffset];
-    }
-    return copied;
-}
-
-Array makeDeepCopyString(const Array& source, char order) {
-    const size_t byteCount = checkedByteCount(source.shape(), source.itemsize(), "Array::copy");
-    const std::vector<size_t> strides = computeByteStrides(source.shape(), source.itemsize(), order, "Array::copy");
+Array makeDeepCopy(const Array& source, char order, size_t threads) {
+    const size_t byteCount = checkedByteCount(source.shape(), source.itemsize(), "Array::copyWithOrder");
+    const std::vector<size_t> strides = computeByteStrides(source.shape(), source.itemsize(), order, "Array::copyWithOrder");
     auto owner = allocateBytes(byteCount, false);
 
     Array copied(
@@ -246,23 +175,7 @@ Array makeDeepCopyString(const Array& source, char order) {
         source.shape(),
         strides,
         owner);
-
-    if (source.size() == 0) {
-        return copied;
-    }
-
-    if ((order == 'C' && source.isContiguousInStyleC()) || (order == 'F' && source.isContiguousInStyleFortran())) {
-        std::memcpy(copied.rawData(), source.rawData(), byteCount);
-        return copied;
-    }
-
-    auto* destination = static_cast<std::uint8_t*>(copied.rawData());
-    const auto* sourceBytes = static_cast<const std::uint8_t*>(source.rawData());
-    for (size_t i = 0; i < source.size(); ++i) {
-        const std::vector<size_t> indices = indicesFromFlatIndex(i, source.shape(), order, "Array::copy");
-        const size_t sourceOffset = byteOffsetFromIndices(source, indices);
-        std::memcpy(destination + i * source.itemsize(), sourceBytes + sourceOffset, source.itemsize());
-    }
+    arraylayout::copyToContiguous(source, copied.rawData(), order, threads);
     return copied;
 }
 
@@ -437,52 +350,20 @@ std::shared_ptr<Data> Array::copy(bool deep) const {
     if (!deep) {
         return this->clone();
     }
+    return std::make_shared<Array>(this->copyWithOrder('A'));
+}
 
+Array Array::copyWithOrder(char order, size_t threads) const {
     if (this->isNone()) {
-        return std::make_shared<Array>();
-    }
-
-    const char order = this->isContiguousInStyleFortran() && !this->isContiguousInStyleC() ? 'F' : 'C';
-
-    if (this->hasString()) {
-        return std::make_shared<Array>(makeDeepCopyString(*this, order));
+        return Array();
     }
 
-    if (this->hasDataOfType<bool>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<bool>(*this, order));
-    }
-    if (this->hasDataOfType<int8_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<int8_t>(*this, order));
-    }
-    if (this->hasDataOfType<int16_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<int16_t>(*this, order));
-    }
-    if (this->hasDataOfType<int32_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<int32_t>(*this, order));
-    }
-    if (this->hasDataOfType<int64_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<int64_t>(*this, order));
-    }
-    if (this->hasDataOfType<uint8_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<uint8_t>(*this, order));
-    }
-    if (this->hasDataOfType<uint16_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<uint16_t>(*this, order));
-    }
-    if (this->hasDataOfType<uint32_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<uint32_t>(*this, order));
-    }
-    if (this->hasDataOfType<uint64_t>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<uint64_t>(*this, order));
-    }
-    if (this->hasDataOfType<float>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<float>(*this, order));
-    }
-    if (this->hasDataOfType<double>()) {
-        return std::make_shared<Array>(makeDeepCopyImpl<double>(*this, order));
+    char normalizedOrder = static_cast<char>(std::toupper(static_cast<unsigned char>(order)));
+    if (normalizedOrder == 'A') {
+        normalizedOrder = this->isContiguousInStyleFortran() && !this->isContiguousInStyleC() ? 'F' : 'C';
     }
-
-    throw std::runtime_error("Array::copy unsupported dtype");
+    normalizedOrder = normalizeOrder(normalizedOrder, "Array::copyWithOrder");
+    return makeDeepCopy(*this, normalizedOrder, threads);
 }
 
 bool Array::hasString() const {
@@ -507,6 +388,51 @@ std::string Array::dtype() const {
     return this->_dtype.name();
 }
 
+std::uint64_t Array::fingerprint() const {
+    utils::Hasher hasher;
+    if (this->hasString()) {
+        std::string buffer;
+        hasher.update(std::string_view("str"));
+        hasher.update(this->stringView(buffer));
+        return hasher.digest();
+    }
+
+    hasher.update(this->dtype());
+    hasher.update(this->_dimensions);
+    for (size_t extent : this->_shape) {
+        hasher.update(extent);
+    }
+    const size_t itemsize = this->itemsize();
+    if (this->isContiguousInStyleC()) {
+        hasher.update(this->_data, this->_size * itemsize);
+        return hasher.digest();
+    }
+
+    // other layouts: gather the elements in C order, a block at a time
+    constexpr size_t kBlockBytes = 1 << 16;
+    std::vector<std::uint8_t> block;
+    block.reserve(kBlockBytes + itemsize);
+    std::vector<size_t> position(this->_dimensions, 0);
+    size_t offset = 0;
+    for (size_t i = 0; i < this->_size; ++i) {
+        block.insert(block.end(), this->_data + offset, this->_data + offset + itemsize);
+        if (block.size() >= kBlockBytes) {
+            hasher.update(block.data(), block.size());
+            block.clear();
+        }
+        for (size_t dim = this->_dimensions; dim-- > 0;) {
+            offset += this->_strides[dim];
+            if (++position[dim] < this->_shape[dim]) {
+                break;
+            }
+            offset -= position[dim] * this->_strides[dim];
+            position[dim] = 0;
+        }
+    }
+    hasher.update(block.data(), block.size());
+    return hasher.digest();
+}
+
 std::shared_ptr<Data> Array::full(
     const std::vector<size_t>& shape,
     double value,
@@ -581,14 +507,7 @@ std::shared_ptr<Data> Array::ravel(const std::string& order) const {
     auto owner = allocateBytes(byteCount, false);
     Array flattened(this->_dtype.id, this->_dtype.itemsize, owner.get(), {this->_size}, {this->_dtype.itemsize}, owner);
 
-    auto* destination = static_cast<std::uint8_t*>(flattened.rawData());
-    const auto* source = static_cast<const std::uint8_t*>(this->rawData());
-    for (size_t i = 0; i < this->_size; ++i) {
-        const auto indices = indicesFromFlatIndex(i, this->_shape, normalizedOrder, "Array::ravel");
-        const size_t sourceOffset = this->getByteOffsetFromIndices(indices);
-        std::memcpy(destination + i * this->_dtype.itemsize, source + sourceOffset, this->_dtype.itemsize);
-    }
-
+    arraylayout::copyToContiguous(*this, flattened.rawData(), normalizedOrder);
     return std::make_shared<Array>(flattened);
 }
 
@@ -652,6 +571,25 @@ int64_t Array::itemAsInt64(const std::vector<size_t>& indices) const {
     throw std::runtime_error("Array::itemAsInt64: unsupported dtype");
 }
 
+double Array::itemAsDouble(const std::vector<size_t>& indices) const {
+    const size_t byteOffset = this->dimensions() == 0 ? 0 : this->getByteOffsetFromIndices(indices);
+    const auto* bytes = static_cast<const std::uint8_t*>(this->rawData()) + byteOffset;
+
+    if (this->hasDataOfType<bool>()) return static_cast<double>(*reinterpret_cast<const bool*>(bytes));
+    if (this->hasDataOfType<int8_t>()) return static_cast<double>(*reinterpret_cast<const int8_t*>(bytes));
+    if (this->hasDataOfType<int16_t>()) return static_cast<double>(*reinterpret_cast<const int16_t*>(bytes));
+    if (this->hasDataOfType<int32_t>()) return static_cast<double>(*reinterpret_cast<const int32_t*>(bytes));
+    if (this->hasDataOfType<int64_t>()) return static_cast<double>(*reinterpret_cast<const int64_t*>(bytes));
+    if (this->hasDataOfType<uint8_t>()) return static_cast<double>(*bytes);
+    if (this->hasDataOfType<uint16_t>()) return static_cast<double>(*reinterpret_cast<const uint16_t*>(bytes));
+    if (this->hasDataOfType<uint32_t>()) return static_cast<double>(*reinterpret_cast<const uint32_t*>(bytes));
+    if (this->hasDataOfType<uint64_t>()) return static_cast<double>(*reinterpret_cast<const uint64_t*>(bytes));
+    if (this->hasDataOfType<float>()) return static_cast<double>(*reinterpret_cast<const float*>(bytes));
+    if (this->hasDataOfType<double>()) return *reinterpret_cast<const double*>(bytes);
+
+    throw std::runtime_error("Array::itemAsDouble: unsupported dtype");
+}
+
 void Array::setItemFromInt64(const std::vector<size_t>& indices, int64_t value) {
     const size_t byteOffset = this->dimensions() == 0 ? 0 : this->getByteOffsetFromIndices(indices);
     auto* bytes = static_cast<std::uint8_t*>(this->rawData()) + byteOffset;
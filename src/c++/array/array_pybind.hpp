@@ -1,10 +1,227 @@
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
 #include "array/array.hpp"
+#include "array/arithmetic.hpp"
 #include "array/array_numpy_bridge.hpp"
 #include "array/factory/factory_pybind.hpp"
 
+namespace {
+
+template <typename T>
+Array weakScalarOfType(const py::object& value, const char* typeName) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return Array(static_cast<T>(value.cast<double>()));
+    } else {
+        using Wide = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+        const std::string outOfBounds =
+            "Python integer " + py::str(value).cast<std::string>() + " out of bounds for " + typeName;
+        Wide item{};
+        try {
+            item = value.cast<Wide>();
+        } catch (const py::cast_error&) {
+            throw std::overflow_error(outOfBounds);
+        }
+        if (item < static_cast<Wide>(std::numeric_limits<T>::min()) ||
+            item > static_cast<Wide>(std::numeric_limits<T>::max())) {
+            throw std::overflow_error(outOfBounds);
+        }
+        return Array(static_cast<T>(item));
+    }
+}
+
+/*
+    Operand of an operation with `array`. As in NumPy 2, Python ints and
+    floats are weakly typed: they take the type of the array when it is of
+    the same kind or a wider one, instead of promoting it to int64 or float64.
+*/
+Array operandWith(const Array& array, const py::object& value) {
+    // exact checks leave out bools, and NumPy float64 scalars which subclass float
+    const bool isInt = PyLong_CheckExact(value.ptr());
+    const bool isFloat = PyFloat_CheckExact(value.ptr());
+    if (!isInt && !isFloat) {
+        return arraybridge::arrayFromPyObject(value);
+    }
+
+    switch (array.typeId()) {
+        case ArrayTypeId::Float32: return weakScalarOfType<float>(value, "float32");
+        case ArrayTypeId::Float64: return weakScalarOfType<double>(value, "float64");
+        default: break;
+    }
+    if (isFloat) {
+        return weakScalarOfType<double>(value, "float64");
+    }
+    switch (array.typeId()) {
+        case ArrayTypeId::Int8: return weakScalarOfType<int8_t>(value, "int8");
+        case ArrayTypeId::Int16: return weakScalarOfType<int16_t>(value, "int16");
+        case ArrayTypeId::Int32: return weakScalarOfType<int32_t>(value, "int32");
+        case ArrayTypeId::UInt8: return weakScalarOfType<uint8_t>(value, "uint8");
+        case ArrayTypeId::UInt16: return weakScalarOfType<uint16_t>(value, "uint16");
+        case ArrayTypeId::UInt32: return weakScalarOfType<uint32_t>(value, "uint32");
+        case ArrayTypeId::UInt64: return weakScalarOfType<uint64_t>(value, "uint64");
+        default: return weakScalarOfType<int64_t>(value, "int64");
+    }
+}
+
+py::object applyOperation(arraymath::Operation operation,
+                          const Array& self,
+                          const py::object& other,
+                          const py::object& out,
+                          bool reflected = false) {
+    const Array operand = operandWith(self, other);
+    const Array& a = reflected ? operand : self;
+    const Array& b = reflected ? self : operand;
+
+    if (out.is_none()) {
+        auto compute = [&]() {
+            py::gil_scoped_release release;
+            return arraymath::apply(operation, a, b);
+        };
+        return py::cast(compute());
+    }
+
+    Array outArray = arraybridge::arrayFromPyObject(out);
+    {
+        py::gil_scoped_release release;
+        arraymath::apply(operation, a, b, outArray);
+    }
+    return out;
+}
+
+void bindArrayOperation(py::class_<Array, Data, std::shared_ptr<Array>>& cls,
+                        const char* name,
+                        arraymath::Operation operation,
+                        const char* doc) {
+    cls.def(name, [operation](const Array& self, const py::object& other, const py::object& out) {
+        return applyOperation(operation, self, other, out);
+    }, py::arg("other"), py::arg("out") = py::none(), doc);
+}
+
+void bindArrayOperations(py::class_<Array, Data, std::shared_ptr<Array>>& cls) {
+    using arraymath::Operation;
+
+    bindArrayOperation(cls, "add", Operation::Add, R"doc(
+Add another operand item by item, as ``numpy.add``.
+
+Operands of any numeric types and broadcastable shapes are accepted. The
+result type is promoted as by NumPy 2: Python ints and floats take the type
+of this array when they fit it, other operands are converted to arrays with
+their own type. Items are converted by blocks and combined by vectorized
+kernels, with the GIL released.
+
+Parameters
+----------
+other : Array, numpy.ndarray, int or float
+    Second operand.
+out : Array or numpy.ndarray, optional
+    Array of the broadcast shape receiving the results, instead of a new
+    array. Its type may be wider than the result type, or of a smaller size
+    of the same kind (``same_kind`` casting). It may overlap the operands,
+    so that ``a.add(b, out=a)`` updates ``a`` in place.
+
+Returns
+-------
+Array
+    The results, or ``out`` when given.
+
+Raises
+------
+ValueError
+    For string and None operands, shapes that do not broadcast, and outputs
+    of another shape or of a narrower kind.
+OverflowError
+    For Python ints out of the bounds of the integer type of this array.
+
+Example
+-------
+.. literalinclude:: ../../../tests/python/array/test_arithmetic.py
+   :language: python
+   :pyobject: test_operationsWithOutput
+)doc");
+    bindArrayOperation(cls, "subtract", Operation::Subtract, R"doc(
+Subtract another operand item by item, as ``numpy.subtract``.
+
+Same operands and ``out`` as :py:meth:`add`. Bool arrays cannot be subtracted.
+)doc");
+    bindArrayOperation(cls, "multiply", Operation::Multiply, R"doc(
+Multiply by another operand item by item, as ``numpy.multiply``.
+
+Same operands and ``out`` as :py:meth:`add`.
+)doc");
+    bindArrayOperation(cls, "divide", Operation::Divide, R"doc(
+Divide by another operand item by item, as ``numpy.true_divide``.
+
+Same operands and ``out`` as :py:meth:`add`. Integers are divided as float64.
+)doc");
+    bindArrayOperation(cls, "minimum", Operation::Minimum, R"doc(
+Smaller of the items of this array and another operand, as ``numpy.minimum``.
+
+Same operands and ``out`` as :py:meth:`add`. NaN items are propagated.
+)doc");
+    bindArrayOperation(cls, "maximum", Operation::Maximum, R"doc(
+Larger of the items of this array and another operand, as ``numpy.maximum``.
+
+Same operands and ``out`` as :py:meth:`add`. NaN items are propagated.
+)doc");
+    bindArrayOperation(cls, "equal", Operation::Equal, R"doc(
+Test the items of this array and another operand for equality, as ``numpy.equal``.
+
+Same operands and ``out`` as :py:meth:`add`. Results are bool, one per
+item; ``out`` may also be numeric.
+)doc");
+    bindArrayOperation(cls, "notEqual", Operation::NotEqual, R"doc(
+Test the items of this array and another operand for inequality, as ``numpy.not_equal``.
+
+Same operands and ``out`` as :py:meth:`equal`.
+)doc");
+    bindArrayOperation(cls, "less", Operation::Less, R"doc(
+Compare the items of this array to another operand, as ``numpy.less``.
+
+Same operands and ``out`` as :py:meth:`equal`.
+
+Example
+-------
+.. literalinclude:: ../../../tests/python/array/test_arithmetic.py
+   :language: python
+   :pyobject: test_comparisons
+)doc");
+    bindArrayOperation(cls, "lessEqual", Operation::LessEqual, R"doc(
+Compare the items of this array to another operand, as ``numpy.less_equal``.
+
+Same operands and ``out`` as :py:meth:`equal`.
+)doc");
+    bindArrayOperation(cls, "greater", Operation::Greater, R"doc(
+Compare the items of this array to another operand, as ``numpy.greater``.
+
+Same operands and ``out`` as :py:meth:`equal`.
+)doc");
+    bindArrayOperation(cls, "greaterEqual", Operation::GreaterEqual, R"doc(
+Compare the items of this array to another operand, as ``numpy.greater_equal``.
+
+Same operands and ``out`` as :py:meth:`equal`.
+)doc");
+
+    const auto bindOperator = [&cls](const char* name, Operation operation, bool reflected) {
+        cls.def(name, [operation, reflected](const Array& self, const py::object& other) {
+            return applyOperation(operation, self, other, py::none(), reflected);
+        }, py::is_operator());
+    };
+    bindOperator("__add__", Operation::Add, false);
+    bindOperator("__radd__", Operation::Add, true);
+    bindOperator("__sub__", Operation::Subtract, false);
+    bindOperator("__rsub__", Operation::Subtract, true);
+    bindOperator("__mul__", Operation::Multiply, false);
+    bindOperator("__rmul__", Operation::Multiply, true);
+    bindOperator("__truediv__", Operation::Divide, false);
+    bindOperator("__rtruediv__", Operation::Divide, true);
+}
+
+} // namespace
+
 void bindArray(py::module_& m) {
 
-    py::class_<Array, Data, std::shared_ptr<Array>>(
+    auto array = py::class_<Array, Data, std::shared_ptr<Array>>(
         m,
         "Array",
         R"doc(
@@ -45,6 +262,26 @@ Pure C++ array payload exposed to Python through a NumPy bridge.
         .def("getPyArray", [](const Array& self) -> py::array {
             return arraybridge::toPyArray(self);
         })
+        .def("copy", [](const Array& self, const std::string& order, size_t threads) {
+            if (order.size() != 1) {
+                throw py::value_error("Array.copy: order must be 'C', 'F' or 'A'");
+            }
+            return self.copyWithOrder(order[0], threads);
+        }, R"doc(
+Return a deep copy stored contiguously in the requested order.
+
+Parameters
+----------
+order : str, optional
+    ``"C"``, ``"F"`` or ``"A"`` (Fortran order when this array is Fortran- but
+    not C-contiguous, C order otherwise). Defaults to ``"A"``.
+threads : int, optional
+    Maximum number of threads of the shared thread pool sharing large copies;
+    0 uses all of them. Defaults to 0. The GIL is released during the copy.
+)doc",
+             py::arg("order")="A",
+             py::arg("threads")=size_t{0},
+             py::call_guard<py::gil_scoped_release>())
         .def("isNone", &Array::isNone)
         .def("isScalar", &Array::isScalar)
         .def("isContiguous", &Array::isContiguous)
@@ -61,5 +298,6 @@ Pure C++ array payload exposed to Python through a NumPy bridge.
             return repr.str();
         });
 
+    bindArrayOperations(array);
     bindFactoryOfArrays(m);
 }
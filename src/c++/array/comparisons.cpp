@@ -1,4 +1,10 @@
 # include "array/array.hpp"
+# include "array/simd.hpp"
+# include "array/strided_loop.hpp"
+
+# include <algorithm>
+# include <cmath>
+# include <functional>
 
 
 bool Array::operator==(const Array& other) const {
@@ -21,46 +27,16 @@ bool Array::operator==(const Array& other) const {
 
 template <typename T>
 bool Array::hasAllItemsEqualToThoseIn(const Array& other) const {
-    bool thisIsScalar = this->isScalar();
-    bool otherIsScalar = other.isScalar();
-
-    size_t thisSize = this->size();
-    size_t otherSize = other.size();
-
-    if (thisIsScalar) {
-        auto thisValue = this->getItemAtIndex<T>(0);
-        if (otherIsScalar) {
-            auto otherValue = this->getItemAtIndex<T>(0);
-            return utils::approxEqual(thisValue, otherValue);
-        } else {
-            for (size_t i = 0; i < otherSize; i++) {
-                auto otherValue = other.getItemAtIndex<T>(i);
-                if (!utils::approxEqual(thisValue, otherValue)) {
-                    return false;
-                }
-            }
-            return true;
-        }
-
-    } else if (otherIsScalar) {
-        auto otherValue = other.getItemAtIndex<T>(0);
-        for (size_t i = 0; i < thisSize; i++) {
-            auto thisValue = this->getItemAtIndex<T>(i);
-            if (!utils::approxEqual(thisValue, otherValue)) {
-                return false;
-            }
-        }
-        return true;
-
-    } else if (thisSize == otherSize) {
-        for (size_t i = 0; i < thisSize; i++) {
-            const T& thisValue = this->getItemAtIndex<T>(i);
-            const T& otherValue = other.getItemAtIndex<T>(i);
-            if (!utils::approxEqual(thisValue, otherValue)) {
-                return false;
-            }
-        }
-        return true;
+    if (this->isScalar()) {
+        return other.hasAllItemsEqualTo<T>(this->getItemAtIndex<T>(0));
+    } else if (other.isScalar()) {
+        return this->hasAllItemsEqualTo<T>(other.getItemAtIndex<T>(0));
+    } else if (this->size() == other.size()) {
+        return !arrayiter::anyPair<T>(*this, other,
+            [](const T& a, const T& b) { return !utils::approxEqual(a, b); },
+            [](const T* values, const T* otherValues, size_t count) {
+                return !arraysimd::allEqual(values, otherValues, count);
+            });
     }
     return false;
 }
@@ -83,21 +59,9 @@ bool Array::operator==(const char* otherString) const { return this->hasSameStri
 
 template <typename T>
 bool Array::hasAllItemsEqualTo(const T& other) const {
-    bool thisIsScalar = this->isScalar();
-
-    if (thisIsScalar) {
-        const T& thisValue = this->getItemAtIndex<T>(0);
-        return utils::approxEqual(thisValue, other);
-    } else {
-        for (size_t i = 0; i < this->size(); i++) {
-            const T& thisValue = this->getItemAtIndex<T>(i);
-            if (!utils::approxEqual(thisValue, other)) {
-                return false;
-            }
-        }
-        return true;
-    }
-    return false;
+    return !arrayiter::anyItem<T>(*this,
+        [&other](const T& thisValue) { return !utils::approxEqual(thisValue, other); },
+        [&other](const T* values, size_t count) { return !arraysimd::allEqualTo(values, other, count); });
 }
 
 
@@ -120,46 +84,18 @@ bool Array::operator!=(const Array& other) const {
 
 template <typename T>
 bool Array::hasAtLeastOneItemDifferentToThoseIn(const Array& other) const {
-    bool thisIsScalar = this->isScalar();
-    bool otherIsScalar = other.isScalar();
-
-    size_t thisSize = this->size();
-    size_t otherSize = other.size();
-
-    if (thisIsScalar) {
-        auto thisValue = this->getItemAtIndex<T>(0);
-        if (otherIsScalar) {
-            auto otherValue = this->getItemAtIndex<T>(0);
-            return !utils::approxEqual(thisValue, otherValue);
-        } else {
-            for (size_t i = 0; i < otherSize; i++) {
-                auto otherValue = other.getItemAtIndex<T>(i);
-                if (utils::approxEqual(thisValue, otherValue)) {
-                    return false;
-                }
-            }
-            return true;
-        }
-
-    } else if (otherIsScalar) {
-        auto otherValue = other.getItemAtIndex<T>(0);
-        for (size_t i = 0; i < thisSize; i++) {
-            auto thisValue = this->getItemAtIndex<T>(i);
-            if (utils::approxEqual(thisValue, otherValue)) {
-                return false;
-            }
-        }
-        return true;
-
-    } else if (thisSize == otherSize) {
-        for (size_t i = 0; i < thisSize; i++) {
-            auto thisValue = this->getItemAtIndex<T>(i);
-            auto otherValue = other.getItemAtIndex<T>(i);
-            if (utils::approxEqual(thisValue, otherValue)) {
-                return false;
-            }
-        }
-        return true;
+    auto equal = [](const T& a, const T& b) { return utils::approxEqual(a, b); };
+    if (this->isScalar()) {
+        const T& thisValue = this->getItemAtIndex<T>(0);
+        return !arrayiter::anyItem<T>(other, [&](const T& otherValue) { return equal(thisValue, otherValue); });
+    } else if (other.isScalar()) {
+        const T& otherValue = other.getItemAtIndex<T>(0);
+        return !arrayiter::anyItem<T>(*this, [&](const T& thisValue) { return equal(thisValue, otherValue); });
+    } else if (this->size() == other.size()) {
+        return !arrayiter::anyPair<T>(*this, other, equal,
+            [](const T* values, const T* otherValues, size_t count) {
+                return arraysimd::anyEqual(values, otherValues, count);
+            });
     }
     return true;
 }
@@ -181,20 +117,7 @@ bool Array::operator!=(const char* otherString) const { return this->hasDifferen
 
 template <typename T>
 bool Array::hasAtLeastOneItemDifferentTo(const T& other) const {
-    bool thisIsScalar = this->isScalar();
-
-    if (thisIsScalar) {
-        const T& thisValue = this->getItemAtIndex<T>(0);
-        return !utils::approxEqual(thisValue, other);
-    } else {
-        for (size_t i = 0; i < this->size(); i++) {
-            const T& thisValue = this->getItemAtIndex<T>(i);
-            if (!utils::approxEqual(thisValue, other)) {
-                return true;
-            }
-        }
-    }
-    return false;
+    return !this->hasAllItemsEqualTo<T>(other);
 }
 
 bool Array::hasSameStringAsThatIn(const Array& other) const {
@@ -215,12 +138,115 @@ bool Array::hasSameStringAs(const std::string& otherString) const {
     if ( !this->hasString() ) {
         return false;
     }
-    return this->extractString() == otherString;
+    std::string buffer;
+    return this->stringView(buffer) == otherString;
 }
 
 bool Array::hasDifferentStringTo(const std::string& otherString) const {
     if ( !this->hasString() ) {
         return true;
     }
-    return this->extractString() != otherString;
+    std::string buffer;
+    return this->stringView(buffer) != otherString;
+}
+
+namespace {
+
+template <typename T>
+bool satisfiesAs(const Array& array, const ValuePredicate& predicate) {
+    if (predicate.quantifier() == ValuePredicate::Quantifier::Any) {
+        return arrayiter::anyItem<T>(array, [&predicate](const T& value) noexcept {
+            return predicate.contains(static_cast<double>(value));
+        });
+    }
+    return !arrayiter::anyItem<T>(array, [&predicate](const T& value) noexcept {
+        return !predicate.contains(static_cast<double>(value));
+    });
+}
+
+} // namespace
+
+bool Array::satisfies(const ValuePredicate& predicate) const {
+    if (this->size() == 0) {
+        return false;
+    }
+    if      (hasDataOfType<int8_t>())   { return satisfiesAs<int8_t>(*this, predicate); }
+    else if (hasDataOfType<int16_t>())  { return satisfiesAs<int16_t>(*this, predicate); }
+    else if (hasDataOfType<int32_t>())  { return satisfiesAs<int32_t>(*this, predicate); }
+    else if (hasDataOfType<int64_t>())  { return satisfiesAs<int64_t>(*this, predicate); }
+    else if (hasDataOfType<uint8_t>())  { return satisfiesAs<uint8_t>(*this, predicate); }
+    else if (hasDataOfType<uint16_t>()) { return satisfiesAs<uint16_t>(*this, predicate); }
+    else if (hasDataOfType<uint32_t>()) { return satisfiesAs<uint32_t>(*this, predicate); }
+    else if (hasDataOfType<uint64_t>()) { return satisfiesAs<uint64_t>(*this, predicate); }
+    else if (hasDataOfType<float>())    { return satisfiesAs<float>(*this, predicate); }
+    else if (hasDataOfType<double>())   { return satisfiesAs<double>(*this, predicate); }
+    else if (hasDataOfType<bool>())     { return satisfiesAs<bool>(*this, predicate); }
+    return false;
+}
+
+template <typename T>
+bool Array::hasAllItemsCloseToThoseIn(
+    const Array& other,
+    double relativeTolerance,
+    double absoluteTolerance) const {
+
+    const bool exact = relativeTolerance <= 0.0 && absoluteTolerance <= 0.0;
+    auto close = [&](const T& a, const T& b) {
+        // exact equality first, as the vectorized kernel, so that infinities match
+        if (std::equal_to<>()(a, b)) {
+            return true;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(a) && std::isnan(b)) {
+                return true;
+            }
+        }
+        if (exact) {
+            return false;
+        }
+        const double x = static_cast<double>(a);
+        const double y = static_cast<double>(b);
+        return std::abs(x - y) <= absoluteTolerance + relativeTolerance * std::max(std::abs(x), std::abs(y));
+    };
+
+    return !arrayiter::anyPair<T>(*this, other,
+        [&close](const T& a, const T& b) { return !close(a, b); },
+        [&](const T* values, const T* otherValues, size_t count) {
+            return !arraysimd::allClose(values, otherValues, count, relativeTolerance, absoluteTolerance);
+        });
+}
+
+bool Array::isCloseTo(const Data& other, double relativeTolerance, double absoluteTolerance) const {
+    const auto* array = dynamic_cast<const Array*>(&other);
+    if (!array) {
+        // other payloads (deferred ones) load themselves and compare back
+        return other.isCloseTo(*this, relativeTolerance, absoluteTolerance);
+    }
+    if (array == this) {
+        return true;
+    }
+    if (this->hasString() || array->hasString()) {
+        std::string buffer;
+        std::string otherBuffer;
+        return this->hasString() && array->hasString()
+            && this->stringView(buffer) == array->stringView(otherBuffer);
+    }
+    if (this->typeId() != array->typeId() || this->_shape != array->_shape) {
+        return false;
+    }
+    if (this->size() == 0) {
+        return true;
+    }
+    if      (hasDataOfType<int8_t>())   { return this->hasAllItemsCloseToThoseIn<int8_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<int16_t>())  { return this->hasAllItemsCloseToThoseIn<int16_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<int32_t>())  { return this->hasAllItemsCloseToThoseIn<int32_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<int64_t>())  { return this->hasAllItemsCloseToThoseIn<int64_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<uint8_t>())  { return this->hasAllItemsCloseToThoseIn<uint8_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<uint16_t>()) { return this->hasAllItemsCloseToThoseIn<uint16_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<uint32_t>()) { return this->hasAllItemsCloseToThoseIn<uint32_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<uint64_t>()) { return this->hasAllItemsCloseToThoseIn<uint64_t>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<float>())    { return this->hasAllItemsCloseToThoseIn<float>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<double>())   { return this->hasAllItemsCloseToThoseIn<double>(*array, relativeTolerance, absoluteTolerance); }
+    else if (hasDataOfType<bool>())     { return this->hasAllItemsCloseToThoseIn<bool>(*array, relativeTolerance, absoluteTolerance); }
+    throw std::runtime_error("Array::isCloseTo: unsupported array data type");
 }
@@ -29,7 +29,8 @@ Example
 .. literalinclude:: ../../../tests/python/array/factory/test_matrices.py
    :language: python
    :pyobject: test_full
-)doc"
+)doc",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     utils::bindForScalarTypes(m, "empty", 
@@ -95,7 +96,8 @@ Example
 .. literalinclude:: ../../../tests/python/array/factory/test_matrices.py
    :language: python
    :pyobject: test_zeros
-)doc"
+)doc",
+        py::call_guard<py::gil_scoped_release>()
     );
 
     utils::bindForScalarTypes(m, "ones",
@@ -116,7 +118,8 @@ Example
 .. literalinclude:: ../../../tests/python/array/factory/test_matrices.py
    :language: python
    :pyobject: test_ones
-)doc"
+)doc",
+        py::call_guard<py::gil_scoped_release>()
     );
 
 }
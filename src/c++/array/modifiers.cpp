@@ -1,4 +1,6 @@
 # include "array/array.hpp"
+# include "array/simd.hpp"
+# include "array/strided_loop.hpp"
 
 
 
@@ -68,99 +70,16 @@ Array& Array::operator=(const Array& other) {
 template <typename T>
 Array& Array::setElementsAs(const T& scalar) {
     this->must().haveValidDataTypeForSettingScalar<T>();
-    T* data = this->getPointerOfModifiableDataFast<T>();
-    
-    if (this->isContiguous()) {
-        for (size_t i = 0; i < this->_size; i++) {
-            data[i] = scalar;
-        }
-    } else {
-        size_t offset;
-        for (size_t i = 0; i < this->_size; i++) {
-            offset = this->getOffsetFromFlatIndex<T>(i);
-            data[offset] = scalar;
-        }
-    }
+    arrayiter::forEachItem<T>(*this, [&scalar](T& item) noexcept { item = scalar; });
     return *this;
 }
 
 
 template <typename T>
 Array& Array::setElementsFrom(const Array& other) {
-   this->must().haveSameSizeAs<Array>(other);
-   other.must().haveDataOfType<T>();
-        
-    if (this->isContiguous()) {
-        if (other.isContiguous()) {
-            return this->setElementsOfThisContiguousUsingContiguous<T>(other);
-        } else {
-            return this->setElementsOfThisContiguousUsingNonContiguous<T>(other);
-        }
-    
-    } else {
-        if (other.isContiguous()) {
-            return this->setElementsOfThisNonContiguousUsingContiguous<T>(other);
-        } else {
-            return this->setElementsOfThisNonContiguousUsingNonContiguous<T>(other);
-        }
-    }
-
-    throw std::runtime_error("theoretically unreachable, bad conditioning");
-}
-
-template <typename T>
-Array& Array::setElementsOfThisContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    for (size_t i = 0; i < this->_size; i++) {
-        thisData[i] = otherData[i];
-    }
-    
-    return *this;
-}
-
-template <typename T>
-Array& Array::setElementsOfThisContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[i] = otherData[offset];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::setElementsOfThisNonContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = this->getOffsetFromFlatIndex<T>(i);
-        thisData[offset] = otherData[i];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::setElementsOfThisNonContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t thisOffset;
-    size_t otherOffset;
-    for (size_t i = 0; i < this->_size; i++) {
-        thisOffset = this->getOffsetFromFlatIndex<T>(i);
-        otherOffset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[thisOffset] = otherData[otherOffset];
-    }
-
+    this->must().haveSameSizeAs<Array>(other);
+    other.must().haveDataOfType<T>();
+    arrayiter::forEachPair<T>(*this, other, [](T& item, const T& otherItem) noexcept { item = otherItem; });
     return *this;
 }
 
@@ -189,19 +108,11 @@ Array& Array::operator+=(const double& scalar) { return this->increaseElementsBy
 template <typename T>
 Array& Array::increaseElementsBy(const T& scalar) {
     this->must().haveValidDataTypeForSettingScalar<T>();
-    T* data = this->getPointerOfModifiableDataFast<T>();
-    
-    if (this->isContiguous()) {
-        for (size_t i = 0; i < this->_size; i++) {
-            data[i] += scalar;
-        }
-    } else {
-        size_t offset;
-        for (size_t i = 0; i < this->_size; i++) {
-            offset = this->getOffsetFromFlatIndex<T>(i);
-            data[offset] += scalar;
-        }
-    }
+    arrayiter::forEachItem<T>(*this,
+        [&scalar](T& item) { item += scalar; },
+        [&scalar](T* values, size_t count) {
+            arraysimd::applyScalar(arraysimd::Operation::Add, values, scalar, count);
+        });
     return *this;
 }
 
@@ -223,80 +134,13 @@ Array& Array::operator+=(const Array& other) {
 
 template <typename T>
 Array& Array::increaseElementsFrom(const Array& other) {
-   this->must().haveSameSizeAs<Array>(other);
-   other.must().haveDataOfType<T>();
-        
-    if (this->isContiguous()) {
-        if (other.isContiguous()) {
-            return this->increaseElementsOfThisContiguousUsingContiguous<T>(other);
-        } else {
-            return this->increaseElementsOfThisContiguousUsingNonContiguous<T>(other);
-        }
-    
-    } else {
-        if (other.isContiguous()) {
-            return this->increaseElementsOfThisNonContiguousUsingContiguous<T>(other);
-        } else {
-            return this->increaseElementsOfThisNonContiguousUsingNonContiguous<T>(other);
-        }
-    }
-
-    throw std::runtime_error("theoretically unreachable, bad conditioning");
-}
-
-template <typename T>
-Array& Array::increaseElementsOfThisContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    for (size_t i = 0; i < this->_size; i++) {
-        thisData[i] += otherData[i];
-    }
-    
-    return *this;
-}
-
-template <typename T>
-Array& Array::increaseElementsOfThisContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[i] += otherData[offset];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::increaseElementsOfThisNonContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = this->getOffsetFromFlatIndex<T>(i);
-        thisData[offset] += otherData[i];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::increaseElementsOfThisNonContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t thisOffset;
-    size_t otherOffset;
-    for (size_t i = 0; i < this->_size; i++) {
-        thisOffset = this->getOffsetFromFlatIndex<T>(i);
-        otherOffset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[thisOffset] += otherData[otherOffset];
-    }
-
+    this->must().haveSameSizeAs<Array>(other);
+    other.must().haveDataOfType<T>();
+    arrayiter::forEachPair<T>(*this, other,
+        [](T& item, const T& otherItem) { item += otherItem; },
+        [](T* values, const T* otherValues, size_t count) {
+            arraysimd::apply(arraysimd::Operation::Add, values, otherValues, count);
+        });
     return *this;
 }
 
@@ -338,80 +182,13 @@ Array& Array::operator-=(const Array& other) {
 
 template <typename T>
 Array& Array::decreaseElementsFrom(const Array& other) {
-   this->must().haveSameSizeAs<Array>(other);
-   other.must().haveDataOfType<T>();
-        
-    if (this->isContiguous()) {
-        if (other.isContiguous()) {
-            return this->decreaseElementsOfThisContiguousUsingContiguous<T>(other);
-        } else {
-            return this->decreaseElementsOfThisContiguousUsingNonContiguous<T>(other);
-        }
-    
-    } else {
-        if (other.isContiguous()) {
-            return this->decreaseElementsOfThisNonContiguousUsingContiguous<T>(other);
-        } else {
-            return this->decreaseElementsOfThisNonContiguousUsingNonContiguous<T>(other);
-        }
-    }
-
-    throw std::runtime_error("theoretically unreachable, bad conditioning");
-}
-
-template <typename T>
-Array& Array::decreaseElementsOfThisContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    for (size_t i = 0; i < this->_size; i++) {
-        thisData[i] -= otherData[i];
-    }
-    
-    return *this;
-}
-
-template <typename T>
-Array& Array::decreaseElementsOfThisContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[i] -= otherData[offset];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::decreaseElementsOfThisNonContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = this->getOffsetFromFlatIndex<T>(i);
-        thisData[offset] -= otherData[i];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::decreaseElementsOfThisNonContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t thisOffset;
-    size_t otherOffset;
-    for (size_t i = 0; i < this->_size; i++) {
-        thisOffset = this->getOffsetFromFlatIndex<T>(i);
-        otherOffset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[thisOffset] -= otherData[otherOffset];
-    }
-
+    this->must().haveSameSizeAs<Array>(other);
+    other.must().haveDataOfType<T>();
+    arrayiter::forEachPair<T>(*this, other,
+        [](T& item, const T& otherItem) { item -= otherItem; },
+        [](T* values, const T* otherValues, size_t count) {
+            arraysimd::apply(arraysimd::Operation::Subtract, values, otherValues, count);
+        });
     return *this;
 }
 
@@ -454,80 +231,13 @@ Array& Array::operator*=(const Array& other) {
 
 template <typename T>
 Array& Array::multiplyElementsFrom(const Array& other) {
-   this->must().haveSameSizeAs<Array>(other);
-   other.must().haveDataOfType<T>();
-        
-    if (this->isContiguous()) {
-        if (other.isContiguous()) {
-            return this->multiplyElementsOfThisContiguousUsingContiguous<T>(other);
-        } else {
-            return this->multiplyElementsOfThisContiguousUsingNonContiguous<T>(other);
-        }
-    
-    } else {
-        if (other.isContiguous()) {
-            return this->multiplyElementsOfThisNonContiguousUsingContiguous<T>(other);
-        } else {
-            return this->multiplyElementsOfThisNonContiguousUsingNonContiguous<T>(other);
-        }
-    }
-
-    throw std::runtime_error("theoretically unreachable, bad conditioning");
-}
-
-template <typename T>
-Array& Array::multiplyElementsOfThisContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    for (size_t i = 0; i < this->_size; i++) {
-        thisData[i] *= otherData[i];
-    }
-    
-    return *this;
-}
-
-template <typename T>
-Array& Array::multiplyElementsOfThisContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[i] *= otherData[offset];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::multiplyElementsOfThisNonContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = this->getOffsetFromFlatIndex<T>(i);
-        thisData[offset] *= otherData[i];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::multiplyElementsOfThisNonContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t thisOffset;
-    size_t otherOffset;
-    for (size_t i = 0; i < this->_size; i++) {
-        thisOffset = this->getOffsetFromFlatIndex<T>(i);
-        otherOffset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[thisOffset] *= otherData[otherOffset];
-    }
-
+    this->must().haveSameSizeAs<Array>(other);
+    other.must().haveDataOfType<T>();
+    arrayiter::forEachPair<T>(*this, other,
+        [](T& item, const T& otherItem) { item *= otherItem; },
+        [](T* values, const T* otherValues, size_t count) {
+            arraysimd::apply(arraysimd::Operation::Multiply, values, otherValues, count);
+        });
     return *this;
 }
 
@@ -535,19 +245,11 @@ Array& Array::multiplyElementsOfThisNonContiguousUsingNonContiguous(const Array&
 template <typename T>
 Array& Array::multiplyElementsBy(const T& scalar) {
     this->must().haveValidDataTypeForSettingScalar<T>();
-    T* data = this->getPointerOfModifiableDataFast<T>();
-    
-    if (this->isContiguous()) {
-        for (size_t i = 0; i < this->_size; i++) {
-            data[i] *= scalar;
-        }
-    } else {
-        size_t offset;
-        for (size_t i = 0; i < this->_size; i++) {
-            offset = this->getOffsetFromFlatIndex<T>(i);
-            data[offset] *= scalar;
-        }
-    }
+    arrayiter::forEachItem<T>(*this,
+        [&scalar](T& item) { item *= scalar; },
+        [&scalar](T* values, size_t count) {
+            arraysimd::applyScalar(arraysimd::Operation::Multiply, values, scalar, count);
+        });
     return *this;
 }
 
@@ -555,19 +257,11 @@ Array& Array::multiplyElementsBy(const T& scalar) {
 template <typename T>
 Array& Array::divideElementsBy(const T& scalar) {
     this->must().haveValidDataTypeForSettingScalar<T>();
-    T* data = this->getPointerOfModifiableDataFast<T>();
-    
-    if (this->isContiguous()) {
-        for (size_t i = 0; i < this->_size; i++) {
-            data[i] /= scalar;
-        }
-    } else {
-        size_t offset;
-        for (size_t i = 0; i < this->_size; i++) {
-            offset = this->getOffsetFromFlatIndex<T>(i);
-            data[offset] /= scalar;
-        }
-    }
+    arrayiter::forEachItem<T>(*this,
+        [&scalar](T& item) { item /= scalar; },
+        [&scalar](T* values, size_t count) {
+            arraysimd::applyScalar(arraysimd::Operation::Divide, values, scalar, count);
+        });
     return *this;
 }
 
@@ -622,80 +316,13 @@ Array& Array::operator/=(const Array& other) {
 
 template <typename T>
 Array& Array::divideElementsFrom(const Array& other) {
-   this->must().haveSameSizeAs<Array>(other);
-   other.must().haveDataOfType<T>();
-        
-    if (this->isContiguous()) {
-        if (other.isContiguous()) {
-            return this->divideElementsOfThisContiguousUsingContiguous<T>(other);
-        } else {
-            return this->divideElementsOfThisContiguousUsingNonContiguous<T>(other);
-        }
-    
-    } else {
-        if (other.isContiguous()) {
-            return this->divideElementsOfThisNonContiguousUsingContiguous<T>(other);
-        } else {
-            return this->divideElementsOfThisNonContiguousUsingNonContiguous<T>(other);
-        }
-    }
-
-    throw std::runtime_error("theoretically unreachable, bad conditioning");
-}
-
-template <typename T>
-Array& Array::divideElementsOfThisContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    for (size_t i = 0; i < this->_size; i++) {
-        thisData[i] /= otherData[i];
-    }
-    
-    return *this;
-}
-
-template <typename T>
-Array& Array::divideElementsOfThisContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[i] /= otherData[offset];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::divideElementsOfThisNonContiguousUsingContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t offset;
-    for (size_t i = 0; i < this->_size; i++) {
-        offset = this->getOffsetFromFlatIndex<T>(i);
-        thisData[offset] /= otherData[i];
-    }
-
-    return *this;
-}
-
-template <typename T>
-Array& Array::divideElementsOfThisNonContiguousUsingNonContiguous(const Array& other) {    
-    T* thisData = this->getPointerOfModifiableDataFast<T>();
-    const T* otherData = other.getPointerOfReadOnlyDataFast<T>();
-
-    size_t thisOffset;
-    size_t otherOffset;
-    for (size_t i = 0; i < this->_size; i++) {
-        thisOffset = this->getOffsetFromFlatIndex<T>(i);
-        otherOffset = other.getOffsetFromFlatIndex<T>(i);
-        thisData[thisOffset] /= otherData[otherOffset];
-    }
-
+    this->must().haveSameSizeAs<Array>(other);
+    other.must().haveDataOfType<T>();
+    arrayiter::forEachPair<T>(*this, other,
+        [](T& item, const T& otherItem) { item /= otherItem; },
+        [](T* values, const T* otherValues, size_t count) {
+            arraysimd::apply(arraysimd::Operation::Divide, values, otherValues, count);
+        });
     return *this;
 }
 
@@ -0,0 +1,574 @@
+# include "array/array.hpp"
+# include "array/simd.hpp"
+# include "array/strided_loop.hpp"
+
+# include <algorithm>
+# include <cmath>
+# include <cstring>
+# include <functional>
+# include <limits>
+# include <map>
+# include <mutex>
+# include <stdexcept>
+# include <string>
+# include <type_traits>
+# include <vector>
+
+namespace {
+
+using Reduction = Data::Reduction;
+
+constexpr size_t kNoIndex = std::numeric_limits<size_t>::max();
+
+// output items reduced together when slices along the axis are walked in memory order
+constexpr size_t kSliceBlock = 256;
+
+/** Type of the means and norms of @p T items. */
+template <typename T>
+using FloatOf = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+bool takesExtremum(Reduction reduction) {
+    return reduction == Reduction::Min || reduction == Reduction::Max
+        || reduction == Reduction::ArgMin || reduction == Reduction::ArgMax;
+}
+
+bool takesLargest(Reduction reduction) {
+    return reduction == Reduction::Max || reduction == Reduction::ArgMax;
+}
+
+bool takesIndex(Reduction reduction) {
+    return reduction == Reduction::ArgMin || reduction == Reduction::ArgMax;
+}
+
+/** Whether @p reduction needs the number of items reduced. */
+bool countsItems(Reduction reduction) {
+    return reduction == Reduction::Mean || reduction == Reduction::Any
+        || reduction == Reduction::All || reduction == Reduction::Count;
+}
+
+std::string reductionName(Reduction reduction) {
+    switch (reduction) {
+        case Reduction::Sum: return "sum";
+        case Reduction::Min: return "min";
+        case Reduction::Max: return "max";
+        case Reduction::Mean: return "mean";
+        case Reduction::Norm: return "norm";
+        case Reduction::ArgMin: return "argmin";
+        case Reduction::ArgMax: return "argmax";
+        case Reduction::Any: return "any";
+        case Reduction::All: return "all";
+        case Reduction::Count: return "count";
+    }
+    return "reduction";
+}
+
+/**
+ * Sum compensated by the Kahan-Neumaier algorithm for floating point, in
+ * double precision since the compensation of a float sum drifts too; integers
+ * wrap around.
+ */
+template <typename S>
+struct CompensatedSum {
+    using Accumulator = std::conditional_t<std::is_floating_point_v<S>, double, S>;
+
+    Accumulator sum = 0;
+    Accumulator compensation = 0;
+
+    void add(Accumulator value) {
+        if constexpr (std::is_floating_point_v<S>) {
+            const double total = sum + value;
+            // infinite sums keep their sign, not the NaN their compensation would turn into
+            if (std::isfinite(total)) {
+                compensation += std::abs(sum) >= std::abs(value) ? (sum - total) + value : (value - total) + sum;
+            }
+            sum = total;
+        } else {
+            sum = static_cast<S>(static_cast<std::uint64_t>(sum) + static_cast<std::uint64_t>(value));
+        }
+    }
+
+    void merge(const CompensatedSum& later) {
+        this->add(later.sum);
+        if constexpr (std::is_floating_point_v<S>) {
+            compensation += later.compensation;
+        }
+    }
+
+    S value() const {
+        if constexpr (std::is_floating_point_v<S>) {
+            return static_cast<S>(std::isfinite(sum) ? sum + compensation : sum);
+        } else {
+            return sum;
+        }
+    }
+};
+
+/**
+ * Reduction of some items of an array, given in increasing index order by
+ * runs or one at a time, and merged with the partial reduction of the
+ * items after them.
+ */
+template <typename T>
+class Partial {
+
+public:
+    /** With @p counted, items() counts the items of every reduction, not only of those needing it. */
+    Partial(Reduction reduction, bool skipNaN, bool counted = false)
+        : _reduction(reduction), _skipNaN(skipNaN), _counted(counted) {}
+
+    /** Items values[0], ..., values[count - 1], of indices first, ..., first + count - 1. */
+    void addRun(const T* values, size_t count, size_t first) {
+        switch (_reduction) {
+            case Reduction::Sum:
+                _sum.add(arraysimd::sum(values, count, _skipNaN));
+                break;
+            case Reduction::Mean:
+                _sum.add(arraysimd::sum(values, count, _skipNaN));
+                _items += count - this->skippedNaN(values, count);
+                break;
+            case Reduction::Norm:
+                _squares.add(arraysimd::sumOfSquares(values, count, _skipNaN));
+                break;
+            case Reduction::Min:
+            case Reduction::Max:
+            case Reduction::ArgMin:
+            case Reduction::ArgMax:
+                this->addExtremum(values, count, first);
+                break;
+            case Reduction::Any:
+            case Reduction::All:
+                _zeros += arraysimd::countZeros(values, count);
+                _items += count - this->skippedNaN(values, count);
+                break;
+            case Reduction::Count:
+                _items += count - this->skippedNaN(values, count);
+                break;
+        }
+        if (_counted && !countsItems(_reduction)) {
+            _items += count - this->skippedNaN(values, count);
+        }
+    }
+
+    void addItem(const T& value, size_t index) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(value)) {
+                if (_skipNaN) {
+                    return;
+                }
+                if (takesExtremum(_reduction)) {
+                    if (_counted) {
+                        ++_items;
+                    }
+                    _nanIndex = std::min(_nanIndex, index);
+                    return;
+                }
+            }
+        }
+        if (_counted || countsItems(_reduction)) {
+            ++_items;
+        }
+        switch (_reduction) {
+            case Reduction::Sum:
+            case Reduction::Mean:
+                _sum.add(static_cast<arraysimd::SumOf<T>>(value));
+                break;
+            case Reduction::Norm:
+                _squares.add(static_cast<double>(value) * static_cast<double>(value));
+                break;
+            case Reduction::Min:
+            case Reduction::Max:
+            case Reduction::ArgMin:
+            case Reduction::ArgMax:
+                if (_bestIndex == kNoIndex || this->better(value, _best)) {
+                    _best = value;
+                    _bestIndex = index;
+                }
+                break;
+            case Reduction::Any:
+            case Reduction::All:
+            case Reduction::Count:
+                if (std::equal_to<T>()(value, T(0))) {
+                    ++_zeros;
+                }
+                break;
+        }
+    }
+
+    void merge(const Partial& later) {
+        _sum.merge(later._sum);
+        _squares.merge(later._squares);
+        _items += later._items;
+        _zeros += later._zeros;
+        _nanIndex = std::min(_nanIndex, later._nanIndex);
+        if (later._bestIndex != kNoIndex && (_bestIndex == kNoIndex || this->better(later._best, _best))) {
+            _best = later._best;
+            _bestIndex = later._bestIndex;
+        }
+    }
+
+    /** Number of items reduced, NaN excluded when they are skipped; see the constructor. */
+    size_t items() const {
+        return _items;
+    }
+
+    /** Write the result to @p item, typed as Data::reduce describes. */
+    void write(std::uint8_t* item) const {
+        switch (_reduction) {
+            case Reduction::Sum:
+                store<arraysimd::SumOf<T>>(item, _sum.value());
+                return;
+            case Reduction::Mean:
+                store<FloatOf<T>>(item, static_cast<FloatOf<T>>(_items == 0
+                    ? std::numeric_limits<double>::quiet_NaN()
+                    : static_cast<double>(_sum.value()) / static_cast<double>(_items)));
+                return;
+            case Reduction::Norm:
+                store<FloatOf<T>>(item, static_cast<FloatOf<T>>(std::sqrt(_squares.value())));
+                return;
+            case Reduction::Min:
+            case Reduction::Max:
+                if constexpr (std::is_floating_point_v<T>) {
+                    if (_nanIndex != kNoIndex || _bestIndex == kNoIndex) {
+                        store<T>(item, std::numeric_limits<T>::quiet_NaN());
+                        return;
+                    }
+                }
+                store<T>(item, _best);
+                return;
+            case Reduction::ArgMin:
+            case Reduction::ArgMax: {
+                const size_t index = _nanIndex != kNoIndex ? _nanIndex : _bestIndex;
+                if (index == kNoIndex) {
+                    throw std::invalid_argument("Array::reduce: cannot compute the " + reductionName(_reduction)
+                        + " of items that are all skipped NaN");
+                }
+                store<int64_t>(item, static_cast<int64_t>(index));
+                return;
+            }
+            case Reduction::Any:
+                store<bool>(item, _items > _zeros);
+                return;
+            case Reduction::All:
+                store<bool>(item, _zeros == 0);
+                return;
+            case Reduction::Count:
+                store<int64_t>(item, static_cast<int64_t>(_items));
+                return;
+        }
+    }
+
+private:
+    Reduction _reduction;
+    bool _skipNaN;
+    bool _counted;
+    CompensatedSum<arraysimd::SumOf<T>> _sum;
+    CompensatedSum<double> _squares;
+    size_t _items = 0;
+    size_t _zeros = 0;
+    T _best{};
+    size_t _bestIndex = kNoIndex;
+    // first NaN met when NaN are not skipped, which then is the min, max, argmin or argmax
+    size_t _nanIndex = kNoIndex;
+
+    template <typename R>
+    static void store(std::uint8_t* item, R value) {
+        std::memcpy(item, &value, sizeof(R));
+    }
+
+    bool better(const T& value, const T& best) const {
+        return takesLargest(_reduction) ? best < value : value < best;
+    }
+
+    size_t skippedNaN(const T* values, size_t count) const {
+        return _skipNaN ? arraysimd::countNaN(values, count) : 0;
+    }
+
+    void addExtremum(const T* values, size_t count, size_t first) {
+        if (_nanIndex != kNoIndex) {
+            return;
+        }
+        const T candidate = takesLargest(_reduction)
+            ? arraysimd::maximum(values, count, _skipNaN)
+            : arraysimd::minimum(values, count, _skipNaN);
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(candidate)) {
+                _nanIndex = first + arraysimd::find(values, count, candidate);
+                return;
+            }
+        }
+        if (_bestIndex != kNoIndex && !this->better(candidate, _best)) {
+            return;
+        }
+        // the kernels return an infinity when every item is a skipped NaN
+        bool located = !takesIndex(_reduction);
+        if constexpr (std::is_floating_point_v<T>) {
+            located = located && !std::isinf(candidate);
+        }
+        const size_t at = located ? 0 : arraysimd::find(values, count, candidate);
+        if (at < count) {
+            _best = candidate;
+            _bestIndex = first + at;
+        }
+    }
+};
+
+/**
+ * Partial reduction of [0, @p count), @p range(partial, begin, end) adding
+ * the units in [begin, end) to an empty partial. Large ranges are shared
+ * between the threads of the pool and merged back in index order.
+ */
+template <typename T, typename Range>
+Partial<T> reduceRanges(const Partial<T>& empty, size_t count, size_t unitBytes, Range&& range) {
+    Partial<T> total = empty;
+    if (count * unitBytes < 2 * utils::kMinBytesPerTask) {
+        range(total, size_t{0}, count);
+        return total;
+    }
+    std::mutex mutex;
+    std::map<size_t, Partial<T>> partials;
+    utils::forEachRange(count, unitBytes, [&](size_t begin, size_t end) {
+        Partial<T> partial = empty;
+        range(partial, begin, end);
+        std::lock_guard<std::mutex> lock(mutex);
+        partials.emplace(begin, partial);
+    });
+    for (const auto& entry : partials) {
+        total.merge(entry.second);
+    }
+    return total;
+}
+
+/** Partial reduction of @p count items starting at @p first, @p stride bytes apart. */
+template <typename T>
+Partial<T> reduceColumn(const Partial<T>& empty, const std::uint8_t* first, size_t count, size_t stride) {
+    if (stride == sizeof(T)) {
+        const T* values = reinterpret_cast<const T*>(first);
+        return reduceRanges(empty, count, sizeof(T), [values](Partial<T>& partial, size_t begin, size_t end) {
+            partial.addRun(values + begin, end - begin, begin);
+        });
+    }
+    Partial<T> partial = empty;
+    for (size_t i = 0; i < count; ++i, first += stride) {
+        partial.addItem(*reinterpret_cast<const T*>(first), i);
+    }
+    return partial;
+}
+
+/** Partial reduction of every item of @p array, counting its items with @p counted. */
+template <typename T>
+Partial<T> reduceItems(const Array& array, Reduction reduction, bool skipNaN, bool counted) {
+    const Partial<T> empty(reduction, skipNaN, counted);
+    const auto* bytes = static_cast<const std::uint8_t*>(array.rawData());
+    // argmin and argmax need the items in flat index order, the others take them in memory order
+    const bool flatOrder = takesIndex(reduction);
+    if (array.size() == 0) {
+        return empty;
+    }
+    if (flatOrder ? array.isContiguousInStyleC() : array.isContiguous()) {
+        return reduceColumn(empty, bytes, array.size(), sizeof(T));
+    }
+    const arrayiter::StridedLoop<1> loop({&array}, !flatOrder);
+    const size_t outerRows = loop.outerRows();
+    if (outerRows == 0) {
+        // every axis has extent 1
+        return reduceColumn(empty, bytes, 1, sizeof(T));
+    }
+    const size_t rowItems = array.size() / outerRows;
+    return reduceRanges(empty, outerRows, rowItems * sizeof(T), [&](Partial<T>& partial, size_t begin, size_t end) {
+        size_t index = begin * rowItems;
+        loop.forEachRow([&](const std::array<size_t, 1>& offsets, const std::array<size_t, 1>& strides, size_t count) {
+            const std::uint8_t* item = bytes + offsets[0];
+            if (strides[0] == sizeof(T)) {
+                partial.addRun(reinterpret_cast<const T*>(item), count, index);
+            } else {
+                for (size_t i = 0; i < count; ++i, item += strides[0]) {
+                    partial.addItem(*reinterpret_cast<const T*>(item), index + i);
+                }
+            }
+            index += count;
+            return true;
+        }, begin, end);
+    });
+}
+
+/** Array of the result type of @p reduction over @p T items. */
+template <typename T>
+Array emptyResult(Reduction reduction, const std::vector<size_t>& shape, char order) {
+    switch (reduction) {
+        case Reduction::Sum:
+            return arrayfactory::empty<arraysimd::SumOf<T>>(shape, order);
+        case Reduction::Min:
+        case Reduction::Max:
+            return arrayfactory::empty<T>(shape, order);
+        case Reduction::Mean:
+        case Reduction::Norm:
+            return arrayfactory::empty<FloatOf<T>>(shape, order);
+        case Reduction::ArgMin:
+        case Reduction::ArgMax:
+        case Reduction::Count:
+            return arrayfactory::empty<int64_t>(shape, order);
+        case Reduction::Any:
+        case Reduction::All:
+            return arrayfactory::empty<bool>(shape, order);
+    }
+    throw std::invalid_argument("Array::reduce: unknown reduction");
+}
+
+/** Reduction of every item of @p array, with the number of items reduced when @p items is given. */
+template <typename T>
+std::shared_ptr<Data> reduceAs(const Array& array, Reduction reduction, bool skipNaN, size_t* items) {
+    Array result = emptyResult<T>(reduction, {1}, 'C');
+    const Partial<T> partial = reduceItems<T>(array, reduction, skipNaN, items != nullptr);
+    partial.write(static_cast<std::uint8_t*>(result.rawData()));
+    if (items) {
+        *items = partial.items();
+    }
+    return std::make_shared<Array>(result);
+}
+
+template <typename T>
+std::shared_ptr<Data> reduceAlongAs(const Array& array, size_t axis, Reduction reduction, bool skipNaN) {
+    std::vector<size_t> shape = array.shape();
+    const size_t extent = shape[axis];
+    const size_t axisStride = array.strides()[axis];
+    shape.erase(shape.begin() + static_cast<std::ptrdiff_t>(axis));
+    if (shape.empty()) {
+        shape = {1};
+    }
+    const char order = array.isContiguousInStyleFortran() && !array.isContiguousInStyleC() ? 'F' : 'C';
+    Array result = emptyResult<T>(reduction, shape, order);
+    auto* output = static_cast<std::uint8_t*>(result.rawData());
+    const Partial<T> empty(reduction, skipNaN);
+    if (result.size() == 0) {
+        return std::make_shared<Array>(result);
+    }
+    if (extent == 0) {
+        for (size_t i = 0; i < result.size(); ++i) {
+            empty.write(output + i * result.itemsize());
+        }
+        return std::make_shared<Array>(result);
+    }
+
+    const auto* bytes = static_cast<const std::uint8_t*>(array.rawData());
+    const auto slice = std::static_pointer_cast<Array>(array.take(0, axis));
+    const arrayiter::StridedLoop<2> loop({slice.get(), &result}, true);
+    const size_t outerRows = loop.outerRows();
+    if (outerRows == 0) {
+        reduceColumn(empty, bytes, extent, axisStride).write(output);
+        return std::make_shared<Array>(result);
+    }
+
+    // output items [begin, end) of a row of the slice, whose items are inputStride bytes apart
+    auto reduceRow = [&](const std::uint8_t* first, std::uint8_t* out, size_t inputStride, size_t outputStride,
+                         size_t begin, size_t end) {
+        if (axisStride <= inputStride) {
+            // the axis is the faster one in memory: each output item from its own run
+            for (size_t j = begin; j < end; ++j) {
+                reduceColumn(empty, first + j * inputStride, extent, axisStride).write(out + j * outputStride);
+            }
+            return;
+        }
+        // whole slices walked in memory order, into a block of output items
+        std::vector<Partial<T>> partials;
+        for (size_t block = begin; block < end; block += kSliceBlock) {
+            const size_t blockItems = std::min(kSliceBlock, end - block);
+            partials.assign(blockItems, empty);
+            for (size_t k = 0; k < extent; ++k) {
+                const std::uint8_t* item = first + k * axisStride + block * inputStride;
+                for (size_t j = 0; j < blockItems; ++j, item += inputStride) {
+                    partials[j].addItem(*reinterpret_cast<const T*>(item), k);
+                }
+            }
+            for (size_t j = 0; j < blockItems; ++j) {
+                partials[j].write(out + (block + j) * outputStride);
+            }
+        }
+    };
+
+    const size_t columnBytes = extent * sizeof(T);
+    utils::forEachRange(outerRows, result.size() / outerRows * columnBytes, [&](size_t begin, size_t end) {
+        loop.forEachRow([&](const std::array<size_t, 2>& offsets, const std::array<size_t, 2>& strides, size_t count) {
+            // rows of a few long columns are split too; inside a shared range this runs inline
+            utils::forEachRange(count, columnBytes, [&](size_t rowBegin, size_t rowEnd) {
+                reduceRow(bytes + offsets[0], output + offsets[1], strides[0], strides[1], rowBegin, rowEnd);
+            });
+            return true;
+        }, begin, end);
+    });
+    return std::make_shared<Array>(result);
+}
+
+void checkReducible(const Array& array, Reduction reduction, const char* context) {
+    // isNone() also holds for empty arrays, whose reductions are defined
+    if (!array.hasString() && array.typeId() != ArrayTypeId::None) {
+        return;
+    }
+    throw std::invalid_argument(std::string(context) + ": cannot compute the " + reductionName(reduction)
+        + " of a " + (array.hasString() ? "string" : "none") + " array");
+}
+
+void checkNotEmpty(size_t count, Reduction reduction, const char* context) {
+    if (count == 0 && takesExtremum(reduction)) {
+        throw std::invalid_argument(std::string(context) + ": cannot compute the " + reductionName(reduction)
+            + " of no items");
+    }
+}
+
+/** Array::reduce, with the number of items reduced when @p items is given. */
+std::shared_ptr<Data> reduceArray(const Array& array, Reduction reduction, bool skipNaN, size_t* items) {
+    checkReducible(array, reduction, "Array::reduce");
+    checkNotEmpty(array.size(), reduction, "Array::reduce");
+
+    if      (array.hasDataOfType<int8_t>())   { return reduceAs<int8_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<int16_t>())  { return reduceAs<int16_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<int32_t>())  { return reduceAs<int32_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<int64_t>())  { return reduceAs<int64_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<uint8_t>())  { return reduceAs<uint8_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<uint16_t>()) { return reduceAs<uint16_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<uint32_t>()) { return reduceAs<uint32_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<uint64_t>()) { return reduceAs<uint64_t>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<float>())    { return reduceAs<float>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<double>())   { return reduceAs<double>(array, reduction, skipNaN, items); }
+    else if (array.hasDataOfType<bool>())     { return reduceAs<bool>(array, reduction, skipNaN, items); }
+    else { throw std::runtime_error("Array::reduce unsupported array data type"); }
+}
+
+} // namespace
+
+std::shared_ptr<Data> Array::reduce(Reduction reduction, bool skipNaN) const {
+    return reduceArray(*this, reduction, skipNaN, nullptr);
+}
+
+Data::CountedReduction Array::reduceCounted(Reduction reduction, bool skipNaN) const {
+    CountedReduction counted;
+    counted.value = reduceArray(*this, reduction, skipNaN, &counted.items);
+    return counted;
+}
+
+std::shared_ptr<Data> Array::reduceAlong(size_t axis, Reduction reduction, bool skipNaN) const {
+    checkReducible(*this, reduction, "Array::reduceAlong");
+    if (axis >= this->dimensions()) {
+        throw std::invalid_argument("Array::reduceAlong: axis " + std::to_string(axis)
+            + " out of range for " + std::to_string(this->dimensions()) + " dimensions");
+    }
+    size_t outputItems = 1;
+    for (size_t dim = 0; dim < this->dimensions(); ++dim) {
+        outputItems *= dim == axis ? 1 : this->_shape[dim];
+    }
+    if (outputItems > 0) {
+        checkNotEmpty(this->_shape[axis], reduction, "Array::reduceAlong");
+    }
+
+    if      (hasDataOfType<int8_t>())   { return reduceAlongAs<int8_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<int16_t>())  { return reduceAlongAs<int16_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<int32_t>())  { return reduceAlongAs<int32_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<int64_t>())  { return reduceAlongAs<int64_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<uint8_t>())  { return reduceAlongAs<uint8_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<uint16_t>()) { return reduceAlongAs<uint16_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<uint32_t>()) { return reduceAlongAs<uint32_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<uint64_t>()) { return reduceAlongAs<uint64_t>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<float>())    { return reduceAlongAs<float>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<double>())   { return reduceAlongAs<double>(*this, axis, reduction, skipNaN); }
+    else if (hasDataOfType<bool>())     { return reduceAlongAs<bool>(*this, axis, reduction, skipNaN); }
+    else { throw std::runtime_error("Array::reduceAlong unsupported array data type"); }
+}
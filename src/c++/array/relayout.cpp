@@ -0,0 +1,234 @@
+#include "array/relayout.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "utils/thread_pool.hpp"
+
+namespace {
+
+// tiles of 32x32 items keep both sides of a transposed tile within L1 for items up to 8 bytes
+constexpr size_t kTileEdge = 32;
+// copies are only shared between threads when each one gets at least this many bytes
+constexpr size_t kMinBytesPerThread = size_t{1} << 20;
+
+struct Axis {
+    size_t extent;
+    size_t sourceStride;
+    size_t destinationStride;
+};
+
+template <size_t Size>
+struct FixedItem {
+    size_t size() const { return Size; }
+    void copy(std::uint8_t* destination, const std::uint8_t* source) const {
+        std::memcpy(destination, source, Size);
+    }
+};
+
+struct AnyItem {
+    size_t itemsize;
+    size_t size() const { return itemsize; }
+    void copy(std::uint8_t* destination, const std::uint8_t* source) const {
+        std::memcpy(destination, source, itemsize);
+    }
+};
+
+template <typename Item>
+void copyRow(const std::uint8_t* source, std::uint8_t* destination, const Axis& axis, Item item) {
+    if (axis.sourceStride == item.size() && axis.destinationStride == item.size()) {
+        std::memcpy(destination, source, axis.extent * item.size());
+        return;
+    }
+    for (size_t i = 0; i < axis.extent; ++i) {
+        item.copy(destination + i * axis.destinationStride, source + i * axis.sourceStride);
+    }
+}
+
+/**
+ * Copy a 2D block whose source is fastest along @p rows and whose destination
+ * is fastest along @p columns, one square tile at a time.
+ */
+template <typename Item>
+void transposeTiles(const std::uint8_t* source, std::uint8_t* destination,
+                    const Axis& rows, const Axis& columns, Item item) {
+    for (size_t row0 = 0; row0 < rows.extent; row0 += kTileEdge) {
+        const size_t rowEnd = std::min(rows.extent, row0 + kTileEdge);
+        for (size_t column0 = 0; column0 < columns.extent; column0 += kTileEdge) {
+            const size_t columnEnd = std::min(columns.extent, column0 + kTileEdge);
+            for (size_t row = row0; row < rowEnd; ++row) {
+                const std::uint8_t* sourceRow = source + row * rows.sourceStride;
+                std::uint8_t* destinationRow = destination + row * rows.destinationStride;
+                for (size_t column = column0; column < columnEnd; ++column) {
+                    item.copy(destinationRow + column * columns.destinationStride,
+                              sourceRow + column * columns.sourceStride);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Copy the block described by @p axes, outermost axis first. The last axis is
+ * the destination-fastest one; when @p transpose is set, the one before it is
+ * the source-fastest one and both are copied by transposeTiles.
+ */
+template <typename Item>
+void copyAxes(const std::uint8_t* source, std::uint8_t* destination,
+              const std::vector<Axis>& axes, bool transpose, Item item) {
+    const size_t kernelAxes = transpose ? 2 : 1;
+    const size_t outerAxes = axes.size() - kernelAxes;
+    size_t outerCount = 1;
+    for (size_t dim = 0; dim < outerAxes; ++dim) {
+        outerCount *= axes[dim].extent;
+    }
+
+    std::vector<size_t> position(outerAxes, 0);
+    size_t sourceOffset = 0;
+    size_t destinationOffset = 0;
+    for (size_t n = 0; n < outerCount; ++n) {
+        if (transpose) {
+            transposeTiles(source + sourceOffset, destination + destinationOffset,
+                           axes[outerAxes], axes[outerAxes + 1], item);
+        } else {
+            copyRow(source + sourceOffset, destination + destinationOffset, axes[outerAxes], item);
+        }
+        for (size_t dim = outerAxes; dim-- > 0;) {
+            sourceOffset += axes[dim].sourceStride;
+            destinationOffset += axes[dim].destinationStride;
+            if (++position[dim] < axes[dim].extent) {
+                break;
+            }
+            sourceOffset -= position[dim] * axes[dim].sourceStride;
+            destinationOffset -= position[dim] * axes[dim].destinationStride;
+            position[dim] = 0;
+        }
+    }
+}
+
+template <typename Item>
+void copyAxesShared(const std::uint8_t* source, std::uint8_t* destination,
+                    const std::vector<Axis>& axes, bool transpose, Item item, size_t threads) {
+    size_t totalBytes = item.size();
+    for (const Axis& axis : axes) {
+        totalBytes *= axis.extent;
+    }
+    if (threads == 1 || totalBytes == 0) {
+        copyAxes(source, destination, axes, transpose, item);
+        return;
+    }
+
+    // each task copies a contiguous range of the outermost axis
+    const size_t extent = axes.front().extent;
+    const size_t bytesPerSlice = totalBytes / extent;
+    utils::ThreadPool::shared().parallelFor(extent, (kMinBytesPerThread + bytesPerSlice - 1) / bytesPerSlice,
+        [&](size_t begin, size_t end) {
+            std::vector<Axis> part = axes;
+            part.front().extent = end - begin;
+            copyAxes(source + begin * axes.front().sourceStride,
+                     destination + begin * axes.front().destinationStride, part, transpose, item);
+        }, threads);
+}
+
+} // namespace
+
+namespace arraylayout {
+
+std::vector<size_t> contiguousStrides(const std::vector<size_t>& shape, size_t itemsize, char order) {
+    const char normalizedOrder = static_cast<char>(std::toupper(static_cast<unsigned char>(order)));
+    if (normalizedOrder != 'C' && normalizedOrder != 'F') {
+        throw std::invalid_argument("arraylayout::contiguousStrides: order must be 'C' or 'F'");
+    }
+    std::vector<size_t> strides(shape.size(), 0);
+    size_t stride = itemsize;
+    for (size_t j = 0; j < shape.size(); ++j) {
+        const size_t dim = normalizedOrder == 'F' ? j : shape.size() - 1 - j;
+        strides[dim] = stride;
+        stride *= shape[dim];
+    }
+    return strides;
+}
+
+void copyStrided(
+    const void* source,
+    const std::vector<size_t>& sourceStrides,
+    void* destination,
+    const std::vector<size_t>& destinationStrides,
+    const std::vector<size_t>& shape,
+    size_t itemsize,
+    size_t threads) {
+
+    if (sourceStrides.size() != shape.size() || destinationStrides.size() != shape.size()) {
+        throw std::invalid_argument("arraylayout::copyStrided: strides and shape must have the same length");
+    }
+
+    std::vector<Axis> axes;
+    for (size_t dim = 0; dim < shape.size(); ++dim) {
+        if (shape[dim] == 0 || itemsize == 0) {
+            return;
+        }
+        if (shape[dim] > 1) {
+            axes.push_back({shape[dim], sourceStrides[dim], destinationStrides[dim]});
+        }
+    }
+    const auto* sourceBytes = static_cast<const std::uint8_t*>(source);
+    auto* destinationBytes = static_cast<std::uint8_t*>(destination);
+    if (axes.empty()) {
+        std::memcpy(destinationBytes, sourceBytes, itemsize);
+        return;
+    }
+
+    // walk the destination sequentially, merging axes contiguous on both sides
+    std::stable_sort(axes.begin(), axes.end(), [](const Axis& a, const Axis& b) {
+        return a.destinationStride > b.destinationStride;
+    });
+    std::vector<Axis> merged;
+    for (size_t dim = axes.size(); dim-- > 0;) {
+        const Axis& axis = axes[dim];
+        if (!merged.empty()) {
+            Axis& inner = merged.back();
+            if (axis.sourceStride == inner.sourceStride * inner.extent
+                && axis.destinationStride == inner.destinationStride * inner.extent) {
+                inner.extent *= axis.extent;
+                continue;
+            }
+        }
+        merged.push_back(axis);
+    }
+    std::reverse(merged.begin(), merged.end());
+
+    // the source-fastest axis goes right before the destination-fastest one
+    const auto sourceFastest = std::min_element(merged.begin(), merged.end(), [](const Axis& a, const Axis& b) {
+        return a.sourceStride < b.sourceStride;
+    });
+    const bool transpose = sourceFastest != merged.end() - 1
+        && sourceFastest->sourceStride < merged.back().sourceStride;
+    if (transpose) {
+        const Axis axis = *sourceFastest;
+        merged.erase(sourceFastest);
+        merged.insert(merged.end() - 1, axis);
+    }
+
+    switch (itemsize) {
+        case 1: return copyAxesShared(sourceBytes, destinationBytes, merged, transpose, FixedItem<1>{}, threads);
+        case 2: return copyAxesShared(sourceBytes, destinationBytes, merged, transpose, FixedItem<2>{}, threads);
+        case 4: return copyAxesShared(sourceBytes, destinationBytes, merged, transpose, FixedItem<4>{}, threads);
+        case 8: return copyAxesShared(sourceBytes, destinationBytes, merged, transpose, FixedItem<8>{}, threads);
+        default: return copyAxesShared(sourceBytes, destinationBytes, merged, transpose, AnyItem{itemsize}, threads);
+    }
+}
+
+void copyToContiguous(const Array& source, void* destination, char order, size_t threads) {
+    if (source.size() == 0) {
+        return;
+    }
+    const std::vector<size_t> shape = source.shape();
+    copyStrided(source.rawData(), source.strides(), destination,
+                contiguousStrides(shape, source.itemsize(), order), shape, source.itemsize(), threads);
+}
+
+} // namespace arraylayout
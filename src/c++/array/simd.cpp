@@ -0,0 +1,1043 @@
+#include "array/simd.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "utils/comparator.hpp"
+
+#if defined(__GNUC__)
+    // GCC and Clang vector extensions: the same kernel source is compiled for
+    // each vector width, inlined into functions targeting each instruction set
+    #define NODER_SIMD_VECTORS 1
+    #define NODER_SIMD_INLINE inline __attribute__((always_inline))
+    #if defined(__x86_64__) || defined(__i386__)
+        #define NODER_SIMD_X86 1
+        #define NODER_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+        #define NODER_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+    #endif
+    #if !defined(__clang__)
+        // wide vectors are only passed between inlined functions, never across the ABI
+        #pragma GCC diagnostic ignored "-Wpsabi"
+    #endif
+    // the kernels compare items exactly, as the operators and NumPy do, and
+    // test vector lanes for NaN with x != x, which std::isnan cannot take
+    #pragma GCC diagnostic ignored "-Wfloat-equal"
+#else
+    #define NODER_SIMD_INLINE inline
+#endif
+
+namespace {
+
+using arraysimd::Level;
+using arraysimd::Operation;
+
+struct Add {
+    template <typename V> NODER_SIMD_INLINE V operator()(V a, V b) const { return static_cast<V>(a + b); }
+};
+struct Subtract {
+    template <typename V> NODER_SIMD_INLINE V operator()(V a, V b) const { return static_cast<V>(a - b); }
+};
+struct Multiply {
+    template <typename V> NODER_SIMD_INLINE V operator()(V a, V b) const { return static_cast<V>(a * b); }
+};
+struct Divide {
+    template <typename V> NODER_SIMD_INLINE V operator()(V a, V b) const { return static_cast<V>(a / b); }
+};
+// NaN propagates from either operand, as in np.minimum and np.maximum
+struct Minimum {
+    template <typename V> NODER_SIMD_INLINE V operator()(V a, V b) const { return (a < b) | (a != a) ? a : b; }
+};
+struct Maximum {
+    template <typename V> NODER_SIMD_INLINE V operator()(V a, V b) const { return (a > b) | (a != a) ? a : b; }
+};
+
+struct Equal {
+    template <typename V> NODER_SIMD_INLINE auto operator()(V a, V b) const { return a == b; }
+};
+struct NotEqual {
+    template <typename V> NODER_SIMD_INLINE auto operator()(V a, V b) const { return a != b; }
+};
+struct Less {
+    template <typename V> NODER_SIMD_INLINE auto operator()(V a, V b) const { return a < b; }
+};
+struct LessEqual {
+    template <typename V> NODER_SIMD_INLINE auto operator()(V a, V b) const { return a <= b; }
+};
+struct Greater {
+    template <typename V> NODER_SIMD_INLINE auto operator()(V a, V b) const { return a > b; }
+};
+struct GreaterEqual {
+    template <typename V> NODER_SIMD_INLINE auto operator()(V a, V b) const { return a >= b; }
+};
+
+/** Close items as Array::isCloseTo compares them, one at a time. */
+template <typename T>
+NODER_SIMD_INLINE bool closeItems(const T& a, const T& b, bool exact, double relativeTolerance, double absoluteTolerance) {
+    if (a == b) {
+        return true;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(a) && std::isnan(b)) {
+            return true;
+        }
+    }
+    if (exact) {
+        return false;
+    }
+    const double x = static_cast<double>(a);
+    const double y = static_cast<double>(b);
+    return std::abs(x - y) <= absoluteTolerance + relativeTolerance * std::max(std::abs(x), std::abs(y));
+}
+
+struct IsNaN {
+    template <typename X> NODER_SIMD_INLINE auto operator()(X x) const { return x != x; }
+};
+struct IsZero {
+    template <typename X> NODER_SIMD_INLINE auto operator()(X x) const { return x == X{}; }
+};
+
+// floating-point sums add blocks of this many items pairwise
+constexpr size_t kSumBlock = 256;
+
+/**
+ * Sum of blocks of kSumBlock items, each one summed by @p Level::blockSum,
+ * added pairwise: the error grows with the logarithm of the number of blocks
+ * instead of the number of items.
+ */
+template <typename A, typename Level, bool Square, bool SkipNaN, typename T>
+NODER_SIMD_INLINE A pairwiseSum(const T* values, size_t count) {
+    A partials[64];
+    size_t depth = 0;
+    size_t blocks = 0;
+    size_t i = 0;
+    for (; i + kSumBlock <= count; i += kSumBlock) {
+        A partial = Level::template blockSum<A, Square, SkipNaN>(values + i, kSumBlock);
+        for (size_t b = ++blocks; (b & 1) == 0; b >>= 1) {
+            partial = partials[--depth] + partial;
+        }
+        partials[depth++] = partial;
+    }
+    A total = Level::template blockSum<A, Square, SkipNaN>(values + i, count - i);
+    while (depth > 0) {
+        total = partials[--depth] + total;
+    }
+    return total;
+}
+
+/** Highest value of @p T, or its lowest one when @p Largest: the start of minimum() or maximum(). */
+template <typename T, bool Largest>
+constexpr T extremumStart() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return Largest ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    } else {
+        return Largest ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+    }
+}
+
+/** The current loops, also used for the items left over by the vector loops. */
+struct Portable {
+    template <typename T, typename Op>
+    static void apply(T* values, const T* others, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = Op{}(values[i], others[i]);
+        }
+    }
+
+    template <typename T, typename Op>
+    static void applyScalar(T* values, T scalar, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = Op{}(values[i], scalar);
+        }
+    }
+
+    template <typename T, typename Test>
+    static void compare(const T* values, const T* others, bool* results, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = Test{}(values[i], others[i]);
+        }
+    }
+
+    template <typename T>
+    static bool allEqual(const T* values, const T* others, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            if (!utils::approxEqual(values[i], others[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    static bool allEqualTo(const T* values, T scalar, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            if (!utils::approxEqual(values[i], scalar)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    static bool anyEqual(const T* values, const T* others, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            if (utils::approxEqual(values[i], others[i])) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename T>
+    static bool allClose(const T* values, const T* others, size_t count, double relativeTolerance, double absoluteTolerance) {
+        const bool exact = relativeTolerance == 0.0 && absoluteTolerance == 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            if (!closeItems(values[i], others[i], exact, relativeTolerance, absoluteTolerance)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename A, bool Square, bool SkipNaN, typename T>
+    static A blockSum(const T* values, size_t count) {
+        A total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const A x = static_cast<A>(values[i]);
+            if constexpr (SkipNaN && std::is_floating_point_v<T>) {
+                if (x != x) {
+                    continue;
+                }
+            }
+            total += Square ? x * x : x;
+        }
+        return total;
+    }
+
+    template <typename T>
+    static arraysimd::SumOf<T> sum(const T* values, size_t count, bool skipNaN) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return skipNaN ? pairwiseSum<T, Portable, false, true>(values, count)
+                           : pairwiseSum<T, Portable, false, false>(values, count);
+        } else {
+            // unsigned, so that signed sums wrap around without overflowing
+            std::uint64_t total = 0;
+            for (size_t i = 0; i < count; ++i) {
+                total += static_cast<std::uint64_t>(static_cast<arraysimd::SumOf<T>>(values[i]));
+            }
+            return static_cast<arraysimd::SumOf<T>>(total);
+        }
+    }
+
+    template <typename T>
+    static double sumOfSquares(const T* values, size_t count, bool skipNaN) {
+        return skipNaN ? pairwiseSum<double, Portable, true, true>(values, count)
+                       : pairwiseSum<double, Portable, true, false>(values, count);
+    }
+
+    template <typename T, bool Largest>
+    static T extremum(const T* values, size_t count, bool skipNaN) {
+        T best = extremumStart<T, Largest>();
+        for (size_t i = 0; i < count; ++i) {
+            const T x = values[i];
+            if constexpr (std::is_floating_point_v<T>) {
+                if (x != x) {
+                    if (!skipNaN) {
+                        return x;
+                    }
+                    continue;
+                }
+            }
+            if (Largest ? best < x : x < best) {
+                best = x;
+            }
+        }
+        return best;
+    }
+
+    template <typename T, typename Test>
+    static size_t countItems(const T* values, size_t count) {
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (Test{}(values[i])) {
+                ++total;
+            }
+        }
+        return total;
+    }
+
+    template <typename T>
+    static size_t find(const T* values, size_t count, T value) {
+        const bool nan = value != value;
+        for (size_t i = 0; i < count; ++i) {
+            if (nan ? values[i] != values[i] : values[i] == value) {
+                return i;
+            }
+        }
+        return count;
+    }
+};
+
+#if defined(NODER_SIMD_VECTORS)
+
+/** Vector of @p Bytes bytes of @p T items (a member typedef, so that both may be template parameters). */
+template <typename T, size_t Bytes>
+struct Vector {
+    typedef T type __attribute__((vector_size(Bytes)));
+};
+
+template <typename V, typename T>
+NODER_SIMD_INLINE V load(const T* items) {
+    V vector;
+    std::memcpy(&vector, items, sizeof(V));
+    return vector;
+}
+
+template <typename T, typename V>
+NODER_SIMD_INLINE void store(T* items, V vector) {
+    std::memcpy(items, &vector, sizeof(V));
+}
+
+template <typename To, typename From>
+NODER_SIMD_INLINE To bitCast(From vector) {
+    static_assert(sizeof(To) == sizeof(From));
+    To result;
+    std::memcpy(&result, &vector, sizeof(To));
+    return result;
+}
+
+/** True when some lane of a comparison mask is set. */
+template <typename M>
+NODER_SIMD_INLINE bool anyLane(M mask) {
+    std::uint64_t words[sizeof(M) / sizeof(std::uint64_t)];
+    std::memcpy(words, &mask, sizeof(M));
+    std::uint64_t any = 0;
+    for (std::uint64_t word : words) {
+        any |= word;
+    }
+    return any != 0;
+}
+
+/** Lanes of @p a where @p mask is set, lanes of @p b elsewhere. */
+template <typename V, typename M>
+NODER_SIMD_INLINE V select(M mask, V a, V b) {
+    return bitCast<V>((bitCast<M>(a) & mask) | (bitCast<M>(b) & ~mask));
+}
+
+/**
+ * Lanes of a comparison mask as bytes, 1 where it is set: lanes are halved
+ * one width at a time, which GCC packs in registers, whereas a direct
+ * conversion to bytes is expanded one lane at a time.
+ */
+template <typename M>
+NODER_SIMD_INLINE auto maskBytes(M mask) {
+    using Lane = std::remove_cv_t<std::remove_reference_t<decltype(mask[0])>>;
+    if constexpr (sizeof(Lane) == 1) {
+        return -mask;
+    } else {
+        using Half = std::conditional_t<sizeof(Lane) == 8, std::int32_t,
+            std::conditional_t<sizeof(Lane) == 4, std::int16_t, std::int8_t>>;
+        return maskBytes(__builtin_convertvector(mask, typename Vector<Half, sizeof(M) / 2>::type));
+    }
+}
+
+/** Lanes where utils::approxEqual holds: |a - b| < epsilon for floating-point items. */
+template <typename T, typename V>
+NODER_SIMD_INLINE auto equalLanes(V a, V b) {
+    if constexpr (std::is_floating_point_v<T>) {
+        constexpr T epsilon = std::numeric_limits<T>::epsilon();
+        const V difference = a - b;
+        return (difference < epsilon) & (difference > -epsilon);
+    } else {
+        return a == b;
+    }
+}
+
+/** Kernels over vectors of @p Bytes bytes, finishing with Portable. */
+template <size_t Bytes>
+struct Vectors {
+    template <typename T, typename Op>
+    static NODER_SIMD_INLINE void apply(T* values, const T* others, size_t count) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        size_t i = 0;
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            const V first = Op{}(load<V>(values + i), load<V>(others + i));
+            const V second = Op{}(load<V>(values + i + lanes), load<V>(others + i + lanes));
+            store(values + i, first);
+            store(values + i + lanes, second);
+        }
+        for (; i + lanes <= count; i += lanes) {
+            store(values + i, Op{}(load<V>(values + i), load<V>(others + i)));
+        }
+        Portable::apply<T, Op>(values + i, others + i, count - i);
+    }
+
+    template <typename T, typename Op>
+    static NODER_SIMD_INLINE void applyScalar(T* values, T scalar, size_t count) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        const V scalars = V{} + scalar;
+        size_t i = 0;
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            store(values + i, Op{}(load<V>(values + i), scalars));
+            store(values + i + lanes, Op{}(load<V>(values + i + lanes), scalars));
+        }
+        for (; i + lanes <= count; i += lanes) {
+            store(values + i, Op{}(load<V>(values + i), scalars));
+        }
+        Portable::applyScalar<T, Op>(values + i, scalar, count - i);
+    }
+
+    template <typename T, typename Test>
+    static NODER_SIMD_INLINE void compare(const T* values, const T* others, bool* results, size_t count) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        size_t i = 0;
+        for (; i + lanes <= count; i += lanes) {
+            store(results + i, maskBytes(Test{}(load<V>(values + i), load<V>(others + i))));
+        }
+        Portable::compare<T, Test>(values + i, others + i, results + i, count - i);
+    }
+
+    template <typename T>
+    static NODER_SIMD_INLINE bool allEqual(const T* values, const T* others, size_t count) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        size_t i = 0;
+        for (; i + 4 * lanes <= count; i += 4 * lanes) {
+            const auto equal = equalLanes<T>(load<V>(values + i), load<V>(others + i))
+                & equalLanes<T>(load<V>(values + i + lanes), load<V>(others + i + lanes))
+                & equalLanes<T>(load<V>(values + i + 2 * lanes), load<V>(others + i + 2 * lanes))
+                & equalLanes<T>(load<V>(values + i + 3 * lanes), load<V>(others + i + 3 * lanes));
+            if (anyLane(~equal)) {
+                return false;
+            }
+        }
+        for (; i + lanes <= count; i += lanes) {
+            if (anyLane(~equalLanes<T>(load<V>(values + i), load<V>(others + i)))) {
+                return false;
+            }
+        }
+        return Portable::allEqual(values + i, others + i, count - i);
+    }
+
+    template <typename T>
+    static NODER_SIMD_INLINE bool allEqualTo(const T* values, T scalar, size_t count) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        const V scalars = V{} + scalar;
+        size_t i = 0;
+        for (; i + 4 * lanes <= count; i += 4 * lanes) {
+            const auto equal = equalLanes<T>(load<V>(values + i), scalars)
+                & equalLanes<T>(load<V>(values + i + lanes), scalars)
+                & equalLanes<T>(load<V>(values + i + 2 * lanes), scalars)
+                & equalLanes<T>(load<V>(values + i + 3 * lanes), scalars);
+            if (anyLane(~equal)) {
+                return false;
+            }
+        }
+        for (; i + lanes <= count; i += lanes) {
+            if (anyLane(~equalLanes<T>(load<V>(values + i), scalars))) {
+                return false;
+            }
+        }
+        return Portable::allEqualTo(values + i, scalar, count - i);
+    }
+
+    template <typename T>
+    static NODER_SIMD_INLINE bool anyEqual(const T* values, const T* others, size_t count) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        size_t i = 0;
+        for (; i + 4 * lanes <= count; i += 4 * lanes) {
+            const auto equal = equalLanes<T>(load<V>(values + i), load<V>(others + i))
+                | equalLanes<T>(load<V>(values + i + lanes), load<V>(others + i + lanes))
+                | equalLanes<T>(load<V>(values + i + 2 * lanes), load<V>(others + i + 2 * lanes))
+                | equalLanes<T>(load<V>(values + i + 3 * lanes), load<V>(others + i + 3 * lanes));
+            if (anyLane(equal)) {
+                return true;
+            }
+        }
+        for (; i + lanes <= count; i += lanes) {
+            if (anyLane(equalLanes<T>(load<V>(values + i), load<V>(others + i)))) {
+                return true;
+            }
+        }
+        return Portable::anyEqual(values + i, others + i, count - i);
+    }
+
+    /**
+     * Vectors of equal items (or NaN pairs) are skipped; the items of the
+     * other vectors are compared by closeBlock().
+     */
+    template <typename T>
+    static NODER_SIMD_INLINE bool allClose(const T* values, const T* others, size_t count,
+                                           double relativeTolerance, double absoluteTolerance) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        size_t i = 0;
+        for (; i + lanes <= count; i += lanes) {
+            const V a = load<V>(values + i);
+            const V b = load<V>(others + i);
+            auto same = a == b;
+            if constexpr (std::is_floating_point_v<T>) {
+                same |= (a != a) & (b != b);
+            }
+            if (anyLane(~same) && !closeBlock(values + i, others + i, lanes, relativeTolerance, absoluteTolerance)) {
+                return false;
+            }
+        }
+        return Portable::allClose(values + i, others + i, count - i, relativeTolerance, absoluteTolerance);
+    }
+
+    /**
+     * Items widened to double lanes, as closeItems compares them. Narrow
+     * items or vectors would need more conversions than the loop saves, so
+     * they are compared one at a time.
+     */
+    template <typename T>
+    static NODER_SIMD_INLINE bool closeBlock(const T* values, const T* others, size_t count,
+                                             double relativeTolerance, double absoluteTolerance) {
+        constexpr size_t lanes = Bytes / sizeof(double);
+        if constexpr (sizeof(T) < sizeof(float) || Bytes < 32) {
+            return Portable::allClose(values, others, count, relativeTolerance, absoluteTolerance);
+        } else {
+            using V = typename Vector<T, lanes * sizeof(T)>::type;
+            using D = typename Vector<double, Bytes>::type;
+            using M = typename Vector<std::int64_t, Bytes>::type;
+            const bool exact = relativeTolerance == 0.0 && absoluteTolerance == 0.0;
+            const D relative = D{} + relativeTolerance;
+            const D absolute = D{} + absoluteTolerance;
+            const M magnitudeBits = M{} + std::numeric_limits<std::int64_t>::max();
+            for (size_t i = 0; i < count; i += lanes) {
+                const V a = load<V>(values + i);
+                const V b = load<V>(others + i);
+                M close = __builtin_convertvector(a == b, M);
+                const D x = __builtin_convertvector(a, D);
+                const D y = __builtin_convertvector(b, D);
+                if constexpr (std::is_floating_point_v<T>) {
+                    close |= (x != x) & (y != y);
+                }
+                if (!exact) {
+                    const D distance = bitCast<D>(bitCast<M>(x - y) & magnitudeBits);
+                    const M xMagnitude = bitCast<M>(x) & magnitudeBits;
+                    const M yMagnitude = bitCast<M>(y) & magnitudeBits;
+                    const M xLarger = bitCast<D>(xMagnitude) > bitCast<D>(yMagnitude);
+                    const D larger = bitCast<D>((xMagnitude & xLarger) | (yMagnitude & ~xLarger));
+                    close |= distance <= absolute + relative * larger;
+                }
+                if (anyLane(~close)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /** Items converted to lanes of @p A, the accumulator type, and summed by a few vectors. */
+    template <typename A, bool Square, bool SkipNaN, typename T>
+    static NODER_SIMD_INLINE A blockSum(const T* values, size_t count) {
+        constexpr size_t lanes = Bytes / sizeof(A);
+        using V = typename Vector<T, lanes * sizeof(T)>::type;
+        using W = typename Vector<A, Bytes>::type;
+        constexpr bool Skip = SkipNaN && std::is_floating_point_v<T>;
+        W first{};
+        W second{};
+        size_t i = 0;
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            first += term<W, Square, Skip>(load<V>(values + i));
+            second += term<W, Square, Skip>(load<V>(values + i + lanes));
+        }
+        for (; i + lanes <= count; i += lanes) {
+            first += term<W, Square, Skip>(load<V>(values + i));
+        }
+        first += second;
+        A total = 0;
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            total += first[lane];
+        }
+        return total + Portable::blockSum<A, Square, SkipNaN>(values + i, count - i);
+    }
+
+    template <typename W, bool Square, bool SkipNaN, typename V>
+    static NODER_SIMD_INLINE W term(V items) {
+        W x = __builtin_convertvector(items, W);
+        if constexpr (SkipNaN) {
+            x = select(x == x, x, W{});
+        }
+        if constexpr (Square) {
+            x *= x;
+        }
+        return x;
+    }
+
+    template <typename T>
+    static NODER_SIMD_INLINE arraysimd::SumOf<T> sum(const T* values, size_t count, bool skipNaN) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return skipNaN ? pairwiseSum<T, Vectors, false, true>(values, count)
+                           : pairwiseSum<T, Vectors, false, false>(values, count);
+        } else if constexpr (sizeof(T) <= 2) {
+            // narrow items widened to 32-bit lanes, flushed to 64 bits before they could overflow;
+            // bytes go through 16-bit lanes, compilers splitting wider conversions into single items
+            using H = std::conditional_t<std::is_signed_v<T>, std::int16_t, std::uint16_t>;
+            using N = std::conditional_t<std::is_signed_v<T>, std::int32_t, std::uint32_t>;
+            constexpr size_t lanes = Bytes / sizeof(T);
+            constexpr size_t halfBlock = 128;
+            constexpr size_t flushEvery = size_t{1} << 15;
+            using V = typename Vector<T, Bytes>::type;
+            using HV = typename Vector<H, lanes * sizeof(H)>::type;
+            using W = typename Vector<N, lanes * sizeof(N)>::type;
+            std::uint64_t result = 0;
+            size_t i = 0;
+            while (i + lanes <= count) {
+                W partial{};
+                for (size_t block = 0; block < flushEvery && i + lanes <= count; ++block) {
+                    if constexpr (sizeof(T) == 1) {
+                        HV half{};
+                        const size_t end = i + std::min(count - i, halfBlock * lanes) / lanes * lanes;
+                        for (; i < end; i += lanes) {
+                            half += __builtin_convertvector(load<V>(values + i), HV);
+                        }
+                        partial += __builtin_convertvector(half, W);
+                    } else {
+                        partial += __builtin_convertvector(load<V>(values + i), W);
+                        i += lanes;
+                    }
+                }
+                for (size_t lane = 0; lane < lanes; ++lane) {
+                    result += static_cast<std::uint64_t>(static_cast<arraysimd::SumOf<T>>(partial[lane]));
+                }
+            }
+            result += static_cast<std::uint64_t>(Portable::sum(values + i, count - i, false));
+            return static_cast<arraysimd::SumOf<T>>(result);
+        } else {
+            // items widened to 64-bit lanes, four vectors at a time
+            constexpr size_t lanes = 4 * Bytes / sizeof(std::uint64_t);
+            using V = typename Vector<T, lanes * sizeof(T)>::type;
+            using W = typename Vector<arraysimd::SumOf<T>, 4 * Bytes>::type;
+            using U = typename Vector<std::uint64_t, 4 * Bytes>::type;
+            U total{};
+            size_t i = 0;
+            for (; i + lanes <= count; i += lanes) {
+                total += bitCast<U>(__builtin_convertvector(load<V>(values + i), W));
+            }
+            std::uint64_t result = static_cast<std::uint64_t>(Portable::sum(values + i, count - i, false));
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                result += total[lane];
+            }
+            return static_cast<arraysimd::SumOf<T>>(result);
+        }
+    }
+
+    template <typename T>
+    static NODER_SIMD_INLINE double sumOfSquares(const T* values, size_t count, bool skipNaN) {
+        return skipNaN ? pairwiseSum<double, Vectors, true, true>(values, count)
+                       : pairwiseSum<double, Vectors, true, false>(values, count);
+    }
+
+    /** Smallest or largest item of each lane, NaN items being ignored and flagged. */
+    template <typename T, bool Largest>
+    static NODER_SIMD_INLINE T extremum(const T* values, size_t count, bool skipNaN) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        V first = V{} + extremumStart<T, Largest>();
+        V second = first;
+        auto nan = first != first;
+        size_t i = 0;
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            const V a = load<V>(values + i);
+            const V b = load<V>(values + i + lanes);
+            if constexpr (Largest) {
+                first = select(first < a, a, first);
+                second = select(second < b, b, second);
+            } else {
+                first = select(a < first, a, first);
+                second = select(b < second, b, second);
+            }
+            if constexpr (std::is_floating_point_v<T>) {
+                nan |= (a != a) | (b != b);
+            }
+        }
+        for (; i + lanes <= count; i += lanes) {
+            const V a = load<V>(values + i);
+            first = Largest ? select(first < a, a, first) : select(a < first, a, first);
+            if constexpr (std::is_floating_point_v<T>) {
+                nan |= a != a;
+            }
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (!skipNaN && anyLane(nan)) {
+                return std::numeric_limits<T>::quiet_NaN();
+            }
+        }
+        first = Largest ? select(first < second, second, first) : select(second < first, second, first);
+        T best = Portable::extremum<T, Largest>(values + i, count - i, skipNaN);
+        if (best != best) {
+            return best;
+        }
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            if (Largest ? best < first[lane] : first[lane] < best) {
+                best = first[lane];
+            }
+        }
+        return best;
+    }
+
+    template <typename T, typename Test>
+    static NODER_SIMD_INLINE size_t countItems(const T* values, size_t count) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        size_t total = 0;
+        size_t i = 0;
+        while (i + lanes <= count) {
+            // set lanes are -1: 127 vectors at most fit in 8-bit lanes
+            decltype(Test{}(V{})) counted{};
+            for (size_t n = 0; n < 127 && i + lanes <= count; ++n, i += lanes) {
+                counted -= Test{}(load<V>(values + i));
+            }
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                total += static_cast<size_t>(counted[lane]);
+            }
+        }
+        return total + Portable::countItems<T, Test>(values + i, count - i);
+    }
+
+    template <typename T>
+    static NODER_SIMD_INLINE size_t find(const T* values, size_t count, T value) {
+        using V = typename Vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        const V wanted = V{} + value;
+        const bool nan = value != value;
+        size_t i = 0;
+        for (; i + lanes <= count; i += lanes) {
+            const V x = load<V>(values + i);
+            if (anyLane(nan ? x != x : x == wanted)) {
+                break;
+            }
+        }
+        return i + Portable::find(values + i, count - i, value);
+    }
+};
+
+/**
+ * Vectors<Bytes> compiled for the instruction set of @p TARGET, and
+ * Vectors<CompareBytes> for the comparisons and reductions: GCC expands comparisons of
+ * 512-bit vectors one lane at a time, since AVX-512 writes their result to a
+ * mask register, so that level compares 256-bit vectors instead.
+ */
+#define NODER_SIMD_LEVEL(Name, Bytes, CompareBytes, TARGET)                                       \
+    struct Name {                                                                                 \
+        template <typename T, typename Op>                                                        \
+        TARGET static void apply(T* values, const T* others, size_t count) {                      \
+            Vectors<Bytes>::apply<T, Op>(values, others, count);                                  \
+        }                                                                                         \
+        template <typename T, typename Op>                                                        \
+        TARGET static void applyScalar(T* values, T scalar, size_t count) {                       \
+            Vectors<Bytes>::applyScalar<T, Op>(values, scalar, count);                            \
+        }                                                                                         \
+        template <typename T, typename Test>                                                      \
+        TARGET static void compare(const T* values, const T* others, bool* results, size_t count) {\
+            Vectors<CompareBytes>::compare<T, Test>(values, others, results, count);              \
+        }                                                                                         \
+        template <typename T>                                                                     \
+        TARGET static bool allEqual(const T* values, const T* others, size_t count) {             \
+            return Vectors<CompareBytes>::allEqual(values, others, count);                        \
+        }                                                                                         \
+        template <typename T>                                                                     \
+        TARGET static bool allEqualTo(const T* values, T scalar, size_t count) {                  \
+            return Vectors<CompareBytes>::allEqualTo(values, scalar, count);                      \
+        }                                                                                         \
+        template <typename T>                                                                     \
+        TARGET static bool anyEqual(const T* values, const T* others, size_t count) {             \
+            return Vectors<CompareBytes>::anyEqual(values, others, count);                        \
+        }                                                                                         \
+        template <typename T>                                                                     \
+        TARGET static bool allClose(const T* values, const T* others, size_t count,               \
+                                    double relativeTolerance, double absoluteTolerance) {         \
+            return Vectors<CompareBytes>::allClose(values, others, count,                         \
+                relativeTolerance, absoluteTolerance);                                            \
+        }                                                                                         \
+        template <typename T>                                                                     \
+        TARGET static arraysimd::SumOf<T> sum(const T* values, size_t count, bool skipNaN) {      \
+            return Vectors<CompareBytes>::sum(values, count, skipNaN);                            \
+        }                                                                                         \
+        template <typename T>                                                                     \
+        TARGET static double sumOfSquares(const T* values, size_t count, bool skipNaN) {          \
+            return Vectors<CompareBytes>::sumOfSquares(values, count, skipNaN);                   \
+        }                                                                                         \
+        template <typename T, bool Largest>                                                       \
+        TARGET static T extremum(const T* values, size_t count, bool skipNaN) {                   \
+            return Vectors<CompareBytes>::extremum<T, Largest>(values, count, skipNaN);           \
+        }                                                                                         \
+        template <typename T, typename Test>                                                      \
+        TARGET static size_t countItems(const T* values, size_t count) {                          \
+            return Vectors<CompareBytes>::countItems<T, Test>(values, count);                     \
+        }                                                                                         \
+        template <typename T>                                                                     \
+        TARGET static size_t find(const T* values, size_t count, T value) {                       \
+            return Vectors<CompareBytes>::find(values, count, value);                             \
+        }                                                                                         \
+    };
+
+NODER_SIMD_LEVEL(Vector128, 16, 16, )
+#if defined(NODER_SIMD_X86)
+NODER_SIMD_LEVEL(AVX2, 32, 32, NODER_SIMD_TARGET_AVX2)
+NODER_SIMD_LEVEL(AVX512, 64, 32, NODER_SIMD_TARGET_AVX512)
+#else
+using AVX2 = Vector128;
+using AVX512 = Vector128;
+#endif
+
+#else
+using Vector128 = Portable;
+using AVX2 = Portable;
+using AVX512 = Portable;
+#endif
+
+// bool items are compared as their byte
+template <typename T>
+using Item = std::conditional_t<std::is_same_v<T, bool>, std::uint8_t, T>;
+
+template <typename T>
+struct Kernels {
+    void (*apply[6])(T*, const T*, size_t);
+    void (*applyScalar[6])(T*, T, size_t);
+    void (*compare[6])(const T*, const T*, bool*, size_t);
+    bool (*allEqual)(const T*, const T*, size_t);
+    bool (*allEqualTo)(const T*, T, size_t);
+    bool (*anyEqual)(const T*, const T*, size_t);
+    bool (*allClose)(const T*, const T*, size_t, double, double);
+    arraysimd::SumOf<T> (*sum)(const T*, size_t, bool);
+    double (*sumOfSquares)(const T*, size_t, bool);
+    T (*minimum)(const T*, size_t, bool);
+    T (*maximum)(const T*, size_t, bool);
+    size_t (*countNaN)(const T*, size_t);
+    size_t (*countZeros)(const T*, size_t);
+    size_t (*find)(const T*, size_t, T);
+};
+
+template <typename L, typename T>
+Kernels<T> kernelsOf() {
+    return {
+        {&L::template apply<T, Add>, &L::template apply<T, Subtract>,
+         &L::template apply<T, Multiply>, &L::template apply<T, Divide>,
+         &L::template apply<T, Minimum>, &L::template apply<T, Maximum>},
+        {&L::template applyScalar<T, Add>, &L::template applyScalar<T, Subtract>,
+         &L::template applyScalar<T, Multiply>, &L::template applyScalar<T, Divide>,
+         &L::template applyScalar<T, Minimum>, &L::template applyScalar<T, Maximum>},
+        {&L::template compare<T, Equal>, &L::template compare<T, NotEqual>,
+         &L::template compare<T, Less>, &L::template compare<T, LessEqual>,
+         &L::template compare<T, Greater>, &L::template compare<T, GreaterEqual>},
+        &L::template allEqual<T>,
+        &L::template allEqualTo<T>,
+        &L::template anyEqual<T>,
+        &L::template allClose<T>,
+        &L::template sum<T>,
+        &L::template sumOfSquares<T>,
+        &L::template extremum<T, false>,
+        &L::template extremum<T, true>,
+        &L::template countItems<T, IsNaN>,
+        &L::template countItems<T, IsZero>,
+        &L::template find<T>};
+}
+
+Level detectedLevel() {
+#if defined(NODER_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return Level::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return Level::AVX2;
+    }
+    return Level::Vector128;
+#elif defined(NODER_SIMD_VECTORS)
+    return Level::Vector128;
+#else
+    return Level::Portable;
+#endif
+}
+
+std::atomic<Level>& currentLevel() {
+    static std::atomic<Level> level{arraysimd::supportedLevel()};
+    return level;
+}
+
+/** Kernels of the active level for items of type @p T. */
+template <typename T>
+const Kernels<T>& kernels() {
+    static const Kernels<T> byLevel[4] = {
+        kernelsOf<Portable, T>(), kernelsOf<Vector128, T>(), kernelsOf<AVX2, T>(), kernelsOf<AVX512, T>()};
+    return byLevel[static_cast<size_t>(currentLevel().load(std::memory_order_relaxed))];
+}
+
+size_t operationIndex(Operation operation) {
+    return static_cast<size_t>(operation);
+}
+
+} // namespace
+
+namespace arraysimd {
+
+Level supportedLevel() {
+    static const Level level = detectedLevel();
+    return level;
+}
+
+Level activeLevel() {
+    return currentLevel().load(std::memory_order_relaxed);
+}
+
+void useLevel(Level level) {
+    if (static_cast<int>(level) > static_cast<int>(supportedLevel())) {
+        throw std::invalid_argument(std::string("arraysimd::useLevel: level '") + levelName(level)
+            + "' is not supported, the widest one is '" + levelName(supportedLevel()) + "'");
+    }
+    currentLevel().store(level, std::memory_order_relaxed);
+}
+
+const char* levelName(Level level) {
+    switch (level) {
+        case Level::Portable: return "portable";
+#if defined(__aarch64__) || defined(__arm__)
+        case Level::Vector128: return "neon";
+#else
+        case Level::Vector128: return "sse2";
+#endif
+        case Level::AVX2: return "avx2";
+        case Level::AVX512: return "avx512";
+    }
+    return "";
+}
+
+template <typename T>
+void apply(Operation operation, T* values, const T* others, size_t count) {
+    kernels<T>().apply[operationIndex(operation)](values, others, count);
+}
+
+template <typename T>
+void applyScalar(Operation operation, T* values, T scalar, size_t count) {
+    kernels<T>().applyScalar[operationIndex(operation)](values, scalar, count);
+}
+
+template <typename T>
+void compare(Comparison comparison, const T* values, const T* others, bool* results, size_t count) {
+    using I = Item<T>;
+    kernels<I>().compare[static_cast<size_t>(comparison)](
+        reinterpret_cast<const I*>(values), reinterpret_cast<const I*>(others), results, count);
+}
+
+template <typename T>
+bool allEqual(const T* values, const T* others, size_t count) {
+    using I = Item<T>;
+    return kernels<I>().allEqual(reinterpret_cast<const I*>(values), reinterpret_cast<const I*>(others), count);
+}
+
+template <typename T>
+bool allEqualTo(const T* values, T scalar, size_t count) {
+    using I = Item<T>;
+    return kernels<I>().allEqualTo(reinterpret_cast<const I*>(values), static_cast<I>(scalar), count);
+}
+
+template <typename T>
+bool anyEqual(const T* values, const T* others, size_t count) {
+    using I = Item<T>;
+    return kernels<I>().anyEqual(reinterpret_cast<const I*>(values), reinterpret_cast<const I*>(others), count);
+}
+
+template <typename T>
+bool allClose(const T* values, const T* others, size_t count, double relativeTolerance, double absoluteTolerance) {
+    using I = Item<T>;
+    return kernels<I>().allClose(reinterpret_cast<const I*>(values), reinterpret_cast<const I*>(others), count,
+                                 relativeTolerance, absoluteTolerance);
+}
+
+template <typename T>
+SumOf<T> sum(const T* values, size_t count, bool skipNaN) {
+    using I = Item<T>;
+    return static_cast<SumOf<T>>(kernels<I>().sum(reinterpret_cast<const I*>(values), count, skipNaN));
+}
+
+template <typename T>
+double sumOfSquares(const T* values, size_t count, bool skipNaN) {
+    using I = Item<T>;
+    return kernels<I>().sumOfSquares(reinterpret_cast<const I*>(values), count, skipNaN);
+}
+
+template <typename T>
+T minimum(const T* values, size_t count, bool skipNaN) {
+    using I = Item<T>;
+    return static_cast<T>(kernels<I>().minimum(reinterpret_cast<const I*>(values), count, skipNaN));
+}
+
+template <typename T>
+T maximum(const T* values, size_t count, bool skipNaN) {
+    using I = Item<T>;
+    return static_cast<T>(kernels<I>().maximum(reinterpret_cast<const I*>(values), count, skipNaN));
+}
+
+template <typename T>
+size_t countNaN(const T* values, size_t count) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return kernels<T>().countNaN(values, count);
+    } else {
+        (void)values;
+        (void)count;
+        return 0;
+    }
+}
+
+template <typename T>
+size_t countZeros(const T* values, size_t count) {
+    using I = Item<T>;
+    return kernels<I>().countZeros(reinterpret_cast<const I*>(values), count);
+}
+
+template <typename T>
+size_t find(const T* values, size_t count, T value) {
+    using I = Item<T>;
+    return kernels<I>().find(reinterpret_cast<const I*>(values), count, static_cast<I>(value));
+}
+
+#define NODER_SIMD_ARITHMETIC(T)                                            \
+    template void apply<T>(Operation, T*, const T*, size_t);                \
+    template void applyScalar<T>(Operation, T*, T, size_t);
+
+#define NODER_SIMD_COMPARISONS(T)                                           \
+    template void compare<T>(Comparison, const T*, const T*, bool*, size_t); \
+    template bool allEqual<T>(const T*, const T*, size_t);                  \
+    template bool allEqualTo<T>(const T*, T, size_t);                       \
+    template bool anyEqual<T>(const T*, const T*, size_t);                  \
+    template bool allClose<T>(const T*, const T*, size_t, double, double);
+
+#define NODER_SIMD_REDUCTIONS(T)                                            \
+    template SumOf<T> sum<T>(const T*, size_t, bool);                       \
+    template double sumOfSquares<T>(const T*, size_t, bool);                \
+    template T minimum<T>(const T*, size_t, bool);                          \
+    template T maximum<T>(const T*, size_t, bool);                          \
+    template size_t countNaN<T>(const T*, size_t);                          \
+    template size_t countZeros<T>(const T*, size_t);                        \
+    template size_t find<T>(const T*, size_t, T);
+
+#define NODER_SIMD_NUMERIC(T) NODER_SIMD_ARITHMETIC(T) NODER_SIMD_COMPARISONS(T) NODER_SIMD_REDUCTIONS(T)
+
+NODER_SIMD_NUMERIC(std::int8_t)
+NODER_SIMD_NUMERIC(std::int16_t)
+NODER_SIMD_NUMERIC(std::int32_t)
+NODER_SIMD_NUMERIC(std::int64_t)
+NODER_SIMD_NUMERIC(std::uint8_t)
+NODER_SIMD_NUMERIC(std::uint16_t)
+NODER_SIMD_NUMERIC(std::uint32_t)
+NODER_SIMD_NUMERIC(std::uint64_t)
+NODER_SIMD_NUMERIC(float)
+NODER_SIMD_NUMERIC(double)
+NODER_SIMD_COMPARISONS(bool)
+NODER_SIMD_REDUCTIONS(bool)
+
+} // namespace arraysimd
@@ -0,0 +1,142 @@
+#include "array/strided_loop.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+/** Axes of one operand, innermost first, without unit axes and with contiguous ones merged. */
+std::vector<std::pair<size_t, size_t>> mergedAxes(const Array& array) {
+    const std::vector<size_t> shape = array.shape();
+    const std::vector<size_t> strides = array.strides();
+    std::vector<std::pair<size_t, size_t>> axes;
+    for (size_t dim = shape.size(); dim-- > 0;) {
+        if (shape[dim] == 1) {
+            continue;
+        }
+        if (!axes.empty() && strides[dim] == axes.back().second * axes.back().first) {
+            axes.back().first *= shape[dim];
+            continue;
+        }
+        axes.push_back({shape[dim], strides[dim]});
+    }
+    return axes;
+}
+
+} // namespace
+
+namespace arrayiter {
+
+template <size_t Operands>
+StridedLoop<Operands>::StridedLoop(const std::array<const Array*, Operands>& arrays, bool anyOrder) {
+    const size_t size = arrays[0]->size();
+    for (const Array* array : arrays) {
+        if (array->size() != size) {
+            throw std::invalid_argument("arrayiter::StridedLoop: operands must have the same size");
+        }
+    }
+    if (size == 0) {
+        return;
+    }
+
+    // split the axes of the operands into common ones, innermost first: an
+    // axis of extent e and stride s is the same as axes (e / g, g) of strides
+    // (s * g, s) whenever g divides e
+    std::array<std::vector<std::pair<size_t, size_t>>, Operands> operandAxes;
+    std::array<size_t, Operands> next{};
+    std::array<std::pair<size_t, size_t>, Operands> current;
+    for (size_t k = 0; k < Operands; ++k) {
+        operandAxes[k] = mergedAxes(*arrays[k]);
+        current[k] = operandAxes[k].empty() ? std::pair<size_t, size_t>{1, 0} : operandAxes[k][0];
+    }
+    std::vector<Axis<Operands>> axes;
+    while (next[0] < operandAxes[0].size()) {
+        size_t extent = current[0].first;
+        for (size_t k = 1; k < Operands; ++k) {
+            extent = std::gcd(extent, current[k].first);
+        }
+        if (extent == 1) {
+            _paired = false;
+            return;
+        }
+        Axis<Operands> axis{extent, {}};
+        for (size_t k = 0; k < Operands; ++k) {
+            axis.strides[k] = current[k].second;
+            current[k].first /= extent;
+            current[k].second *= extent;
+            if (current[k].first == 1 && ++next[k] < operandAxes[k].size()) {
+                current[k] = operandAxes[k][next[k]];
+            }
+        }
+        axes.push_back(axis);
+    }
+    if (axes.empty()) {
+        _axes.push_back({1, {}});
+        return;
+    }
+
+    if (anyOrder) {
+        std::stable_sort(axes.begin(), axes.end(), [](const Axis<Operands>& a, const Axis<Operands>& b) {
+            return a.strides[0] < b.strides[0];
+        });
+    }
+    for (const Axis<Operands>& axis : axes) {
+        if (!_axes.empty()) {
+            Axis<Operands>& inner = _axes.back();
+            bool contiguous = true;
+            for (size_t k = 0; k < Operands; ++k) {
+                contiguous = contiguous && axis.strides[k] == inner.strides[k] * inner.extent;
+            }
+            if (contiguous) {
+                inner.extent *= axis.extent;
+                continue;
+            }
+        }
+        _axes.push_back(axis);
+    }
+    std::reverse(_axes.begin(), _axes.end());
+
+    // the axis along which the second operand is fastest goes right before the innermost one
+    if (anyOrder && Operands > 1 && _axes.size() > 1) {
+        const auto secondFastest = std::min_element(_axes.begin(), _axes.end() - 1,
+            [](const Axis<Operands>& a, const Axis<Operands>& b) {
+                return a.strides[Operands - 1] < b.strides[Operands - 1];
+            });
+        if (secondFastest->strides[Operands - 1] < _axes.back().strides[Operands - 1]) {
+            const Axis<Operands> axis = *secondFastest;
+            _axes.erase(secondFastest);
+            _axes.insert(_axes.end() - 1, axis);
+            _tiled = true;
+        }
+    }
+}
+
+template class StridedLoop<1>;
+template class StridedLoop<2>;
+template class StridedLoop<3>;
+
+bool overlap(const Array& a, const Array& b) {
+    auto span = [](const Array& array) {
+        const auto* begin = static_cast<const std::uint8_t*>(array.rawData());
+        if (array.size() == 0) {
+            return std::pair<const std::uint8_t*, const std::uint8_t*>{begin, begin};
+        }
+        const std::vector<size_t> shape = array.shape();
+        const std::vector<size_t> strides = array.strides();
+        size_t last = 0;
+        for (size_t dim = 0; dim < shape.size(); ++dim) {
+            last += (shape[dim] - 1) * strides[dim];
+        }
+        return std::pair<const std::uint8_t*, const std::uint8_t*>{begin, begin + last + array.itemsize()};
+    };
+    const auto [aBegin, aEnd] = span(a);
+    const auto [bBegin, bEnd] = span(b);
+    return aBegin < bEnd && bBegin < aEnd;
+}
+
+std::shared_ptr<Array> flattened(const Array& other) {
+    return std::static_pointer_cast<Array>(other.ravel("C"));
+}
+
+} // namespace arrayiter
@@ -180,6 +180,15 @@ Base::ZoneNamedDataList Base::allFields(
     return output;
 }
 
+double Base::reduceField(
+    const std::string& fieldName,
+    Data::Reduction reduction,
+    const std::string& container,
+    bool skipNaN) const {
+
+    return reduceFieldOverZones(this->zones(), fieldName, reduction, container, skipNaN);
+}
+
 void Base::assertFieldsSizeCoherency() const {
     for (const auto& zone : this->zones()) {
         zone->assertFieldsSizeCoherency();
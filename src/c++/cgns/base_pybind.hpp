@@ -100,6 +100,14 @@ This class provides treelab-inspired zone aggregation helpers.
             py::arg("return_type") = "dict",
             py::arg("ravel") = false,
             py::arg("append_container_to_field_name") = false)
+        .def(
+            "reduce_field",
+            &Base::reduceField,
+            py::arg("field_name"),
+            py::arg("reduction"),
+            py::arg("container") = "FlowSolution",
+            py::arg("skip_nan") = false,
+            py::call_guard<py::gil_scoped_release>())
         .def("assert_fields_size_coherency", &Base::assertFieldsSizeCoherency)
         .def("remove_empty_zones", &Base::removeEmptyZones)
         .def("update_dimensions_from_zones", &Base::updateDimensionsFromZones);
@@ -222,6 +222,15 @@ Tree::ZoneNamedDataList Tree::allFields(
     return output;
 }
 
+double Tree::reduceField(
+    const std::string& fieldName,
+    Data::Reduction reduction,
+    const std::string& container,
+    bool skipNaN) const {
+
+    return reduceFieldOverZones(this->zones(), fieldName, reduction, container, skipNaN);
+}
+
 void Tree::assertFieldsSizeCoherency() const {
     for (const auto& base : this->bases()) {
         base->assertFieldsSizeCoherency();
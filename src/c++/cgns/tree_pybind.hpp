@@ -104,6 +104,14 @@ This class provides treelab-inspired base and zone aggregation helpers.
             py::arg("return_type") = "dict",
             py::arg("ravel") = false,
             py::arg("append_container_to_field_name") = false)
+        .def(
+            "reduce_field",
+            &Tree::reduceField,
+            py::arg("field_name"),
+            py::arg("reduction"),
+            py::arg("container") = "FlowSolution",
+            py::arg("skip_nan") = false,
+            py::call_guard<py::gil_scoped_release>())
         .def("assert_fields_size_coherency", &Tree::assertFieldsSizeCoherency)
         .def("remove_empty_zones", &Tree::removeEmptyZones);
 }
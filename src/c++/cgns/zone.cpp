@@ -1,6 +1,7 @@
 #include "cgns/zone.hpp"
 
 #include <cctype>
+#include <cmath>
 #include <limits>
 #include <set>
 #include <stdexcept>
@@ -300,8 +301,7 @@ std::vector<size_t> Zone::shape() const {
 std::vector<size_t> Zone::shapeOfCoordinates() const {
     const auto coord = this->pick().byNameGlob("Coordinate*");
     if (!coord) throw std::runtime_error(std::string("shapeOfCoordinates: zone ")+this->path()+std::string(" did not have coordinates"));
-    const auto data = requireData(coord->dataPtr(), "shape");
-    return data->shape();
+    return coord->data().shape();
 }
 
 size_t Zone::numberOfPoints() const {
@@ -536,11 +536,9 @@ void Zone::assertFieldsSizeCoherency() const {
             continue;
         }
 
-        const size_t expectedSize = requireData(
-            fieldsInContainer.front()->dataPtr(),
-            "assertFieldsSizeCoherency")->size();
+        const size_t expectedSize = fieldsInContainer.front()->data().size();
         for (const auto& fieldNode : fieldsInContainer) {
-            const size_t fieldSize = requireData(fieldNode->dataPtr(), "assertFieldsSizeCoherency")->size();
+            const size_t fieldSize = fieldNode->data().size();
             if (fieldSize != expectedSize) {
                 throw std::runtime_error(
                     "assertFieldsSizeCoherency: not all fields have same size in " + container->path());
@@ -594,7 +592,7 @@ std::string Zone::inferLocation(const std::string& container) const {
         return defaultGridLocationFor(container);
     }
 
-    const size_t fieldSize = requireData(dataChild->dataPtr(), "inferLocation")->size();
+    const size_t fieldSize = dataChild->data().size();
     if (fieldSize == this->numberOfPoints()) {
         return "Vertex";
     }
@@ -610,6 +608,27 @@ bool Zone::hasFields() const {
     return !this->directChildrenByType("FlowSolution_t").empty();
 }
 
+std::shared_ptr<Data> Zone::existingField(const std::string& fieldName, const std::string& container) const {
+    const auto flowSolution = this->containerNode(container);
+    if (!flowSolution) {
+        throw std::runtime_error("existingField: container '" + container + "' not found in " + this->name());
+    }
+    const auto fieldNode = flowSolution->pick().childByName(fieldName);
+    if (!fieldNode) {
+        throw std::runtime_error("existingField: '" + fieldName + "' not found in container " + flowSolution->path());
+    }
+    return fieldNode->dataPtr();
+}
+
+double Zone::reduceField(
+    const std::string& fieldName,
+    Data::Reduction reduction,
+    const std::string& container,
+    bool skipNaN) const {
+
+    return this->existingField(fieldName, container)->reduce(reduction, skipNaN)->itemAsDouble({0});
+}
+
 Zone::ShapePair Zone::getArrayShapes() const {
     std::vector<size_t> shapeVertex;
     std::vector<size_t> shapeCellCenter;
@@ -631,7 +650,7 @@ Zone::ShapePair Zone::getArrayShapes() const {
     auto gridCoordinates = this->pick().childByName("GridCoordinates");
     if (gridCoordinates) {
         for (const auto& dataNode : gridCoordinates->pick().allByType("DataArray_t", 2)) {
-            updateShape(shapeVertex, requireData(dataNode->dataPtr(), "getArrayShapes")->shape(), dataNode->path());
+            updateShape(shapeVertex, dataNode->data().shape(), dataNode->path());
         }
     }
 
@@ -645,7 +664,7 @@ Zone::ShapePair Zone::getArrayShapes() const {
         }
 
         for (const auto& dataNode : flowSolution->pick().allByType("DataArray_t", 2)) {
-            const auto candidate = requireData(dataNode->dataPtr(), "getArrayShapes")->shape();
+            const auto candidate = dataNode->data().shape();
             if (location == "Vertex") {
                 updateShape(shapeVertex, candidate, dataNode->path());
             } else if (location == "CellCenter") {
@@ -710,7 +729,7 @@ bool Zone::isEmpty() const {
         return true;
     }
 
-    return !firstCoordinate->dataPtr() || firstCoordinate->dataPtr()->isNone();
+    return firstCoordinate->noData();
 }
 
 Zone::ZoneList Zone::boundaries() {
@@ -762,7 +781,8 @@ std::shared_ptr<Zone> Zone::boundary(const std::string& index, const std::string
     const std::array<std::string, 3> coordinateNames = {"CoordinateX", "CoordinateY", "CoordinateZ"};
     for (size_t i = 0; i < coordinateNames.size(); ++i) {
         auto coord = std::make_shared<Node>(coordinateNames[i], "DataArray_t");
-        coord->setData(sliceBoundaryData(coords[i]->dataPtr(), axis, useMin, "boundary"));
+        // data() keeps payloads read lazily from file unloaded: only the boundary face is read
+        coord->setData(sliceBoundaryData(coords[i]->data().clone(), axis, useMin, "boundary"));
         coord->attachTo(gridCoordinates);
     }
 
@@ -781,7 +801,7 @@ std::shared_ptr<Zone> Zone::boundary(const std::string& index, const std::string
 
         for (const auto& fieldNode : flowSolution->pick().allByType("DataArray_t", 2)) {
             auto outputField = std::make_shared<Node>(fieldNode->name(), "DataArray_t");
-            outputField->setData(sliceBoundaryData(fieldNode->dataPtr(), axis, useMin, "boundary"));
+            outputField->setData(sliceBoundaryData(fieldNode->data().clone(), axis, useMin, "boundary"));
             outputField->attachTo(outputFlowSolution);
         }
     }
@@ -865,3 +885,86 @@ std::shared_ptr<Zone> newZoneFromArrays(
     zone->isStructured();
     return zone;
 }
+
+double reduceFieldOverZones(
+    const std::vector<std::shared_ptr<Zone>>& zones,
+    const std::string& fieldName,
+    Data::Reduction reduction,
+    const std::string& container,
+    bool skipNaN) {
+
+    using Reduction = Data::Reduction;
+    if (reduction == Reduction::ArgMin || reduction == Reduction::ArgMax) {
+        throw std::invalid_argument("reduceFieldOverZones: argmin and argmax are not defined over several zones");
+    }
+
+    double total = reduction == Reduction::All ? 1.0 : 0.0;
+    size_t items = 0;
+    bool hasExtremum = false;
+    bool hasItems = false;
+    for (const auto& zone : zones) {
+        const auto field = zone->existingField(fieldName, container);
+        const auto reduce = [&](Reduction zoneReduction) {
+            return field->reduce(zoneReduction, skipNaN)->itemAsDouble({0});
+        };
+        switch (reduction) {
+            case Reduction::Sum:
+            case Reduction::Count:
+                total += reduce(reduction);
+                break;
+            case Reduction::Mean: {
+                const Data::CountedReduction sum = field->reduceCounted(Reduction::Sum, skipNaN);
+                total += sum.value->itemAsDouble({0});
+                items += sum.items;
+                break;
+            }
+            case Reduction::Norm: {
+                const double norm = reduce(reduction);
+                total += norm * norm;
+                break;
+            }
+            case Reduction::Any:
+                total = std::max(total, reduce(reduction));
+                break;
+            case Reduction::All:
+                total = std::min(total, reduce(reduction));
+                break;
+            case Reduction::Min:
+            case Reduction::Max: {
+                if (field->size() == 0) {
+                    break;
+                }
+                hasItems = true;
+                const double value = reduce(reduction);
+                // with skipNaN, NaN only comes out of a zone whose items are all skipped
+                if (skipNaN && std::isnan(value)) {
+                    break;
+                }
+                if (!hasExtremum || std::isnan(value)) {
+                    total = value;
+                } else if (!std::isnan(total)) {
+                    total = reduction == Reduction::Min ? std::min(total, value) : std::max(total, value);
+                }
+                hasExtremum = true;
+                break;
+            }
+            case Reduction::ArgMin:
+            case Reduction::ArgMax:
+                break;
+        }
+    }
+
+    if (reduction == Reduction::Mean) {
+        return items == 0 ? std::numeric_limits<double>::quiet_NaN() : total / static_cast<double>(items);
+    }
+    if (reduction == Reduction::Norm) {
+        return std::sqrt(total);
+    }
+    if (reduction == Reduction::Min || reduction == Reduction::Max) {
+        if (!hasItems) {
+            throw std::invalid_argument("reduceFieldOverZones: cannot compute the extremum of no items");
+        }
+        return hasExtremum ? total : std::numeric_limits<double>::quiet_NaN();
+    }
+    return total;
+}
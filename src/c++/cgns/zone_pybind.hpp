@@ -388,6 +388,14 @@ Not implemented on purpose: ``save`` and ``useEquation``.
             py::arg("return_type") = "dict",
             py::arg("ravel") = false,
             py::arg("append_container_to_field_name") = false)
+        .def(
+            "reduce_field",
+            &Zone::reduceField,
+            py::arg("field_name"),
+            py::arg("reduction"),
+            py::arg("container") = "FlowSolution",
+            py::arg("skip_nan") = false,
+            py::call_guard<py::gil_scoped_release>())
         .def("assert_fields_size_coherency", &Zone::assertFieldsSizeCoherency)
         .def("infer_location", &Zone::inferLocation, py::arg("container"))
         .def("has_fields", &Zone::hasFields)
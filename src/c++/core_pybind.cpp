@@ -3,8 +3,14 @@
 # include "data/data_factory.hpp"
 # include "node/node_pybind.hpp"
 # include "node/navigation_pybind.hpp"
+# include "node/tree_diff_pybind.hpp"
 # include "io/cgns/node_pycgns_converter_pybind.hpp"
 # include "io/io.hpp"
+# include "utils/thread_pool.hpp"
+
+# include <optional>
+# include <string>
+# include <vector>
 
 #ifdef ENABLE_HDF5_IO
 #include "io/io_numpy.hpp"
@@ -24,6 +30,43 @@ Returns
 None
 )doc");
 
+    m.def(
+        "setThreadPoolSize",
+        [](size_t threads) {
+            py::gil_scoped_release release;
+            utils::ThreadPool::shared().setThreads(threads);
+        },
+        py::arg("threads"),
+        R"doc(
+Resize the thread pool shared by array operations, deep copies and fills.
+
+Loops over large arrays are split between the threads of the pool, with the
+GIL released. The initial size is given by the ``NODER_NUM_THREADS``
+environment variable, or the number of hardware threads when unset.
+
+Parameters
+----------
+threads : int
+    Number of threads, counting the calling one; 0 uses all hardware threads
+    and 1 runs every loop on the calling thread.
+
+Returns
+-------
+None
+)doc");
+
+    m.def(
+        "threadPoolSize",
+        []() { return utils::ThreadPool::shared().threads(); },
+        R"doc(
+Number of threads of the pool shared by array operations.
+
+Returns
+-------
+int
+    Threads counting the calling one.
+)doc");
+
     py::module_ io_m = m.def_submodule(
         "io",
         R"doc(
@@ -38,7 +81,24 @@ See C++ counterpart: :ref:`cpp-io-module`.
     #endif
     io_m.def(
         "read",
-        &io::read,
+        [](const std::string& filename,
+           const char order,
+           const bool lazy,
+           const std::vector<std::string>& include,
+           const std::vector<std::string>& exclude,
+           const std::optional<size_t>& max_depth,
+           const size_t threads) {
+            io::ReadOptions options;
+            options.order = order;
+            options.lazy = lazy;
+            options.includePatterns = include;
+            options.excludePatterns = exclude;
+            if (max_depth) {
+                options.maxDepth = *max_depth;
+            }
+            options.threads = threads;
+            return io::read(filename, options);
+        },
         R"doc(
 Read a Node hierarchy from file.
 
@@ -50,6 +110,29 @@ filename : str
     Input file path.
 order : str, optional
     Memory order of arrays when read (``"C"`` or ``"F"``). Defaults to ``"F"`` (CGNS/Fortran convention).
+lazy : bool, optional
+    If ``True``, only the hierarchy and array metadata are read upfront; each
+    array is read from disk the first time its values are accessed. The file
+    stays open until all deferred arrays are loaded. Only used for HDF5/CGNS
+    format. Defaults to ``False``.
+include : list[str], optional
+    Only read nodes whose path matches one of these patterns. Patterns are
+    ``/``-separated paths relative to the file root whose elements are globs
+    with the semantics of :py:meth:`noder.core.Navigation.by_name_glob`
+    (for example ``"Base/*/GridCoordinates"``). Matching nodes are read with
+    their subtree and their ancestors without payload. Only used for
+    HDF5/CGNS format. Defaults to reading every node.
+exclude : list[str], optional
+    Skip nodes matching one of these patterns, together with their subtree.
+    Takes precedence over ``include``. Only used for HDF5/CGNS format.
+max_depth : int or None, optional
+    Deepest level read, the file root being level 0. Only used for HDF5/CGNS
+    format. Defaults to no limit.
+threads : int, optional
+    Maximum number of threads of the shared thread pool reading and converting
+    arrays once the hierarchy is known; ``0`` uses all of them. The result does
+    not depend on the thread count. Ignored when ``lazy`` is ``True``. Only used
+    for HDF5/CGNS format. Defaults to ``1``.
 
 Returns
 -------
@@ -63,7 +146,12 @@ Example
    :pyobject: test_read
 )doc",
         py::arg("filename"),
-        py::arg("order")='F');
+        py::arg("order")='F',
+        py::arg("lazy")=false,
+        py::arg("include")=std::vector<std::string>{},
+        py::arg("exclude")=std::vector<std::string>{},
+        py::arg("max_depth")=py::none(),
+        py::arg("threads")=size_t{1});
     #ifdef ENABLE_HDF5_IO
     io_m.def(
         "write_numpy",
@@ -122,6 +210,180 @@ Example
         py::arg("filename"),
         py::arg("dataset_name")=std::string("numpy"),
         py::arg("order")=std::string("F"));
+    io_m.def(
+        "read_slab",
+        [](const std::string& filename,
+           const std::string& path,
+           const std::vector<size_t>& start,
+           const std::vector<size_t>& count,
+           const std::vector<size_t>& stride,
+           const char order) {
+            io::Hyperslab slab;
+            slab.start = start;
+            slab.count = count;
+            slab.stride = stride;
+            return arraybridge::toPyArray(io::read_data_slab(filename, path, slab, order));
+        },
+        R"doc(
+Read a strided block of a node payload from a CGNS/HDF5 file.
+
+Only the selected elements are read from disk.
+
+Parameters
+----------
+filename : str
+    Input file path.
+path : str
+    Path of the node relative to the file root (for example ``"Base/Zone/GridCoordinates/CoordinateX"``).
+start : list[int]
+    First selected index along each axis.
+count : list[int]
+    Number of selected indices along each axis.
+stride : list[int], optional
+    Step between selected indices along each axis. Defaults to 1 everywhere.
+order : str, optional
+    Memory order of returned array (``"C"`` or ``"F"``).
+
+Returns
+-------
+numpy.ndarray
+    Array of shape ``count``.
+
+Example
+-------
+.. literalinclude:: ../../../tests/python/io/test_io.py
+   :language: python
+   :pyobject: test_read_and_write_slab
+)doc",
+        py::arg("filename"),
+        py::arg("path"),
+        py::arg("start"),
+        py::arg("count"),
+        py::arg("stride")=std::vector<size_t>{},
+        py::arg("order")='F');
+    io_m.def(
+        "write_slab",
+        [](const py::object& array,
+           const std::string& filename,
+           const std::string& path,
+           const std::vector<size_t>& start,
+           const std::vector<size_t>& stride) {
+            io::Hyperslab slab;
+            slab.start = start;
+            slab.stride = stride;
+            io::write_data_slab(filename, path, arraybridge::arrayFromPyObject(array), slab);
+        },
+        R"doc(
+Overwrite a strided block of an existing node payload in a CGNS/HDF5 file.
+
+Parameters
+----------
+array : numpy.ndarray
+    Values to write; their shape gives the number of selected indices per axis.
+filename : str
+    Existing file path.
+path : str
+    Path of the node relative to the file root.
+start : list[int]
+    First selected index along each axis.
+stride : list[int], optional
+    Step between selected indices along each axis. Defaults to 1 everywhere.
+
+Returns
+-------
+None
+
+Example
+-------
+.. literalinclude:: ../../../tests/python/io/test_io.py
+   :language: python
+   :pyobject: test_read_and_write_slab
+)doc",
+        py::arg("array"),
+        py::arg("filename"),
+        py::arg("path"),
+        py::arg("start"),
+        py::arg("stride")=std::vector<size_t>{});
+    #ifdef ENABLE_MPI
+    // mpi4py communicators are converted through their Fortran handle
+    const auto mpiComm = [](const py::object& comm) {
+        return MPI_Comm_f2c(comm.attr("py2f")().cast<MPI_Fint>());
+    };
+    io_m.def(
+        "write_parallel",
+        [mpiComm](std::shared_ptr<Node> node, const std::string& filename, const py::object& comm, bool collective) {
+            io::WriteOptions options;
+            options.collectiveTransfers = collective;
+            io::write_node_parallel(filename, std::move(node), mpiComm(comm), options);
+        },
+        R"doc(
+Write into one file the trees held by all MPI ranks (collective call).
+
+Each rank passes its own tree, typically its bases holding only its zones.
+The file contains the union of the nodes of all ranks; a node held by several
+ranks must have the same label on each of them, and its payload is written by
+the first rank holding one.
+
+Parameters
+----------
+node : Node
+    Tree of the calling rank.
+filename : str
+    Output file path (HDF5/CGNS format only).
+comm : mpi4py.MPI.Comm
+    Communicator of the writing ranks.
+collective : bool, optional
+    Use collective MPI-IO transfers; independent transfers otherwise. Only
+    used when HDF5 is built with parallel support. Defaults to ``True``.
+
+Returns
+-------
+None
+
+See C++ counterpart: :ref:`cpp-io-module`.
+)doc",
+        py::arg("node"),
+        py::arg("filename"),
+        py::arg("comm"),
+        py::arg("collective")=true);
+    io_m.def(
+        "read_parallel",
+        [mpiComm](const std::string& filename, const py::object& comm, const char order, const bool lazy) {
+            io::ReadOptions options;
+            options.order = order;
+            options.lazy = lazy;
+            return io::read_parallel(filename, mpiComm(comm), options);
+        },
+        R"doc(
+Read on each MPI rank only the zones assigned to it; ranks read on their own,
+without collective calls.
+
+Zones are split in contiguous blocks, in read order: the k-th of n zones goes
+to rank ``k * size // n``. Nodes outside zones are read on every rank.
+
+Parameters
+----------
+filename : str
+    Input file path (HDF5/CGNS format only).
+comm : mpi4py.MPI.Comm
+    Communicator of the reading ranks.
+order : str, optional
+    Memory order of arrays when read (``"C"`` or ``"F"``). Defaults to ``"F"``.
+lazy : bool, optional
+    Defer array reads until first access, as in :py:func:`read`. Defaults to ``False``.
+
+Returns
+-------
+Node
+    Tree holding the zones of the calling rank.
+
+See C++ counterpart: :ref:`cpp-io-module`.
+)doc",
+        py::arg("filename"),
+        py::arg("comm"),
+        py::arg("order")='F',
+        py::arg("lazy")=false);
+    #endif
     #endif
 
     bindData(m);
@@ -129,6 +391,7 @@ Example
     bindNode(m);
     io_m.attr("Node") = m.attr("Node");
     bindNavigation(m);
+    bindTreePatch(m);
     bindNodePyCGNSConverter(m);
 
 }
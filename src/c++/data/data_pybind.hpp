@@ -4,11 +4,56 @@
 
 # include <pybind11/numpy.h>
 # include <pybind11/pybind11.h>
+# include <pybind11/stl.h>
+
+# include <optional>
 
 namespace py = pybind11;
 
 void bindData(py::module_ &m) {
-    py::class_<Data, std::shared_ptr<Data>>(
+    py::class_<ValuePredicate> valuePredicate(
+        m,
+        "ValuePredicate",
+        R"doc(
+Numeric test on the elements of a payload, evaluated on its typed buffer.
+
+A predicate is an interval and a quantifier: by default every element must
+lie in the interval, :py:meth:`any` makes one element enough. Elements are
+compared as float; None, empty and string payloads never satisfy a predicate.
+
+See C++ counterpart: :ref:`cpp-navigation-value-predicates`.
+
+Example
+-------
+.. literalinclude:: ../../../tests/python/node/test_navigation.py
+   :language: python
+   :start-after: # docs:start all_by_value_example
+   :end-before: # docs:end all_by_value_example
+   :dedent: 4
+)doc");
+    valuePredicate
+        .def_static("between", &ValuePredicate::between,
+            "Elements in [lower, upper].", py::arg("lower"), py::arg("upper"))
+        .def_static("near", &ValuePredicate::near,
+            "Elements within tolerance of value (bounds included).", py::arg("value"), py::arg("tolerance"))
+        .def_static("equal_to", &ValuePredicate::equalTo,
+            "Elements equal to value.", py::arg("value"))
+        .def_static("greater_than", &ValuePredicate::greaterThan,
+            "Elements strictly greater than value.", py::arg("value"))
+        .def_static("at_least", &ValuePredicate::atLeast,
+            "Elements greater than or equal to value.", py::arg("value"))
+        .def_static("less_than", &ValuePredicate::lessThan,
+            "Elements strictly less than value.", py::arg("value"))
+        .def_static("at_most", &ValuePredicate::atMost,
+            "Elements less than or equal to value.", py::arg("value"))
+        .def("any", &ValuePredicate::any,
+            "Same interval, satisfied when at least one element lies in it.")
+        .def("all", &ValuePredicate::all,
+            "Same interval, satisfied when every element lies in it.")
+        .def("contains", &ValuePredicate::contains,
+            "Whether value lies in the interval.", py::arg("value"));
+
+    py::class_<Data, std::shared_ptr<Data>> data(
         m,
         "Data",
         R"doc(
@@ -18,7 +63,28 @@ This class is normally returned by :py:meth:`noder.core.Node.data` and most
 concrete payloads are :py:class:`noder.core.Array`.
 
 See C++ counterpart: :ref:`cpp-data-class`.
+)doc");
+
+    py::enum_<Data::Reduction>(data, "Reduction", R"doc(
+Reduction computed by :py:meth:`Data.reduce`.
+
+``Sum``, ``Min``, ``Max``, ``Mean`` and ``Norm`` (Euclidean) are typed as in
+NumPy; ``ArgMin`` and ``ArgMax`` give the C-order flat index of the first
+extremum; ``Any`` and ``All`` test items against zero; ``Count`` gives the
+number of items, not counting NaN when they are skipped.
 )doc")
+        .value("Sum", Data::Reduction::Sum)
+        .value("Min", Data::Reduction::Min)
+        .value("Max", Data::Reduction::Max)
+        .value("Mean", Data::Reduction::Mean)
+        .value("Norm", Data::Reduction::Norm)
+        .value("ArgMin", Data::Reduction::ArgMin)
+        .value("ArgMax", Data::Reduction::ArgMax)
+        .value("Any", Data::Reduction::Any)
+        .value("All", Data::Reduction::All)
+        .value("Count", Data::Reduction::Count);
+
+    data
     .def("hasString", &Data::hasString, R"doc(
 Check whether this payload represents a string-like value.
 
@@ -75,6 +141,60 @@ Returns
 numpy.ndarray
     View/copy of the payload exposed through NumPy.
 )doc")
+    .def("satisfies", &Data::satisfies, py::arg("predicate"), R"doc(
+Test the numeric elements of this payload against a value predicate.
+
+The elements are read from the typed buffer, without conversion to text.
+
+Parameters
+----------
+predicate : ValuePredicate
+    Interval and quantifier to test.
+
+Returns
+-------
+bool
+    ``False`` for None, empty and string payloads.
+)doc",
+    py::call_guard<py::gil_scoped_release>())
+    .def("reduce", [](const Data& self, Data::Reduction reduction, std::optional<size_t> axis, bool skipNaN) {
+        return axis ? self.reduceAlong(*axis, reduction, skipNaN) : self.reduce(reduction, skipNaN);
+    }, py::arg("reduction"), py::arg("axis") = py::none(), py::arg("skipNaN") = false, R"doc(
+Reduce the numeric elements of this payload, or its slices along an axis.
+
+Contiguous runs go through vectorized kernels, floating-point sums are
+pairwise or compensated, and large payloads are shared between the threads
+of the shared pool (see :py:func:`noder.core.setThreadPoolSize`).
+
+Parameters
+----------
+reduction : Data.Reduction
+    Reduction to compute.
+axis : int, optional
+    Axis reduced away. Defaults to None, which reduces every element into a
+    payload of shape ``(1,)``.
+skipNaN : bool, optional
+    Ignore NaN elements, like ``numpy.nansum`` and its siblings, instead of
+    propagating them. Defaults to False.
+
+Returns
+-------
+Data
+    Result typed as in NumPy.
+
+Raises
+------
+ValueError
+    For string and None payloads, an out-of-range axis, and extrema of no
+    elements.
+
+Example
+-------
+.. literalinclude:: ../../../tests/python/array/test_reductions.py
+   :language: python
+   :pyobject: test_reduce
+)doc",
+    py::call_guard<py::gil_scoped_release>())
     .def("extractString", &Data::extractString, R"doc(
 Extract the payload as a Python string.
 
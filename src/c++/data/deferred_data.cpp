@@ -0,0 +1,243 @@
+// deferred_data.cpp
+
+#include "data/deferred_data.hpp"
+#include "data/data_factory.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+size_t sizeFromShape(const std::vector<size_t>& shape) {
+    size_t total = 1;
+    for (size_t dim : shape) {
+        total *= dim;
+    }
+    return total;
+}
+
+std::string shapeAsString(const std::vector<size_t>& shape) {
+    std::string txt = "(";
+    for (size_t dim = 0; dim < shape.size(); ++dim) {
+        if (dim > 0) {
+            txt += ",";
+        }
+        txt += std::to_string(shape[dim]);
+    }
+    return txt + ")";
+}
+
+} // namespace
+
+DeferredData::DeferredData(
+    Loader loader,
+    const std::vector<size_t>& shape,
+    const std::string& dtypeName,
+    bool isString) : _state(std::make_shared<State>()) {
+
+    if (!loader) {
+        throw std::invalid_argument("DeferredData: loader cannot be empty");
+    }
+    _state->loader = std::move(loader);
+    _state->shape = shape;
+    _state->dtype = dtypeName;
+    _state->isString = isString;
+}
+
+bool DeferredData::isLoaded() const {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    return _state->loaded != nullptr;
+}
+
+std::shared_ptr<Data> DeferredData::load() const {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    if (!_state->loaded) {
+        auto loaded = _state->loader();
+        if (!loaded) {
+            throw std::runtime_error("DeferredData: loader returned a null payload");
+        }
+        _state->loaded = std::move(loaded);
+        // release resources held by the loaders (e.g. open files)
+        _state->loader = nullptr;
+        _state->slabLoader = nullptr;
+    }
+    return _state->loaded;
+}
+
+void DeferredData::setSlabLoader(SlabLoader slabLoader) {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    _state->slabLoader = std::move(slabLoader);
+}
+
+std::shared_ptr<Data> DeferredData::clone() const {
+    return std::make_shared<DeferredData>(*this);
+}
+
+std::shared_ptr<Data> DeferredData::copy(bool deep) const {
+    if (!deep) {
+        return this->clone();
+    }
+    return this->load()->copy(true);
+}
+
+bool DeferredData::hasString() const {
+    return _state->isString;
+}
+
+bool DeferredData::isNone() const {
+    return !_state->isString && this->size() < 1;
+}
+
+bool DeferredData::isScalar() const {
+    return !this->isNone() && !_state->isString && this->size() == 1;
+}
+
+size_t DeferredData::dimensions() const {
+    return _state->shape.size();
+}
+
+size_t DeferredData::size() const {
+    return sizeFromShape(_state->shape);
+}
+
+std::vector<size_t> DeferredData::shape() const {
+    return _state->shape;
+}
+
+std::string DeferredData::dtype() const {
+    return _state->dtype;
+}
+
+std::shared_ptr<Data> DeferredData::full(
+    const std::vector<size_t>& shape,
+    double value,
+    const std::string& dtypeName,
+    char order) const {
+    // building a new payload does not depend on the deferred values
+    return datafactory::makeDefaultData()->full(shape, value, dtypeName, order);
+}
+
+std::shared_ptr<Data> DeferredData::ravel(const std::string& order) const {
+    return this->load()->ravel(order);
+}
+
+std::shared_ptr<Data> DeferredData::take(int64_t index, size_t axis) const {
+    const std::vector<size_t>& shape = _state->shape;
+    SlabLoader slabLoader;
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        if (!_state->loaded) {
+            slabLoader = _state->slabLoader;
+        }
+    }
+    if (!slabLoader || axis >= shape.size() || shape[axis] == 0) {
+        return this->load()->take(index, axis);
+    }
+
+    const int64_t axisLength = static_cast<int64_t>(shape[axis]);
+    const int64_t normalizedIndex = index < 0 ? index + axisLength : index;
+    if (normalizedIndex < 0 || normalizedIndex >= axisLength) {
+        throw std::runtime_error("DeferredData::take: index out of bounds");
+    }
+
+    std::vector<size_t> start(shape.size(), 0);
+    std::vector<size_t> count = shape;
+    start[axis] = static_cast<size_t>(normalizedIndex);
+    count[axis] = 1;
+    // the block keeps the taken axis with extent 1: take it to match the full-payload result
+    return slabLoader(start, count)->take(0, axis);
+}
+
+int64_t DeferredData::itemAsInt64(const std::vector<size_t>& indices) const {
+    return this->load()->itemAsInt64(indices);
+}
+
+void DeferredData::setItemFromInt64(const std::vector<size_t>& indices, int64_t value) {
+    this->load()->setItemFromInt64(indices, value);
+}
+
+double DeferredData::itemAsDouble(const std::vector<size_t>& indices) const {
+    return this->load()->itemAsDouble(indices);
+}
+
+std::string DeferredData::extractString() const {
+    return this->load()->extractString();
+}
+
+std::string_view DeferredData::stringView(std::string& buffer) const {
+    // the loaded payload is kept by the shared state, so views into it stay valid
+    return this->load()->stringView(buffer);
+}
+
+bool DeferredData::satisfies(const ValuePredicate& predicate) const {
+    if (_state->isString || this->size() < 1) {
+        return false;
+    }
+    return this->load()->satisfies(predicate);
+}
+
+bool DeferredData::isCloseTo(const Data& other, double relativeTolerance, double absoluteTolerance) const {
+    // copies of one deferred payload read the same dataset
+    const auto* deferred = dynamic_cast<const DeferredData*>(&other);
+    if (deferred && deferred->_state == _state) {
+        return true;
+    }
+    if (_state->isString != other.hasString()) {
+        return false;
+    }
+    if (!_state->isString && (_state->shape != other.shape() || _state->dtype != other.dtype())) {
+        return false;
+    }
+    return this->load()->isCloseTo(other, relativeTolerance, absoluteTolerance);
+}
+
+std::uint64_t DeferredData::fingerprint() const {
+    return this->load()->fingerprint();
+}
+
+std::shared_ptr<Data> DeferredData::reduce(Reduction reduction, bool skipNaN) const {
+    return this->load()->reduce(reduction, skipNaN);
+}
+
+Data::CountedReduction DeferredData::reduceCounted(Reduction reduction, bool skipNaN) const {
+    return this->load()->reduceCounted(reduction, skipNaN);
+}
+
+std::shared_ptr<Data> DeferredData::reduceAlong(size_t axis, Reduction reduction, bool skipNaN) const {
+    return this->load()->reduceAlong(axis, reduction, skipNaN);
+}
+
+std::string DeferredData::info() const {
+    return this->load()->info();
+}
+
+std::string DeferredData::shortInfo() const {
+    if (this->isLoaded()) {
+        return _state->loaded->shortInfo();
+    }
+    return "Array " + _state->dtype + " " + shapeAsString(_state->shape) + " (deferred)";
+}
+
+bool DeferredData::operator==(const int8_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const int16_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const int32_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const int64_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const uint8_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const uint16_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const uint32_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const uint64_t& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const float& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const double& scalar) const { return *this->load() == scalar; }
+bool DeferredData::operator==(const bool& scalar) const { return *this->load() == scalar; }
+
+bool DeferredData::operator!=(const int8_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const int16_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const int32_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const int64_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const uint8_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const uint16_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const uint32_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const uint64_t& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const float& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const double& scalar) const { return *this->load() != scalar; }
+bool DeferredData::operator!=(const bool& scalar) const { return *this->load() != scalar; }
@@ -5,16 +5,31 @@
 #include "array/array.hpp"
 #include "array/factory/matrices.hpp"
 #include "array/factory/strings.hpp"
+#include "array/relayout.hpp"
 #include "cgns/base.hpp"
 #include "cgns/tree.hpp"
 #include "cgns/zone.hpp"
+#include "data/deferred_data.hpp"
+#include "utils/hash.hpp"
+#include "utils/string.hpp"
+#include "utils/thread_pool.hpp"
 
 #include <hdf5.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstring>
+#include <exception>
+#include <filesystem>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <regex>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 
@@ -191,6 +206,10 @@ void add_string_attr_fixed_utf8(hid_t id, const std::string& key, const std::str
     std::vector<char> buffer(length, '\0');
     std::strncpy(buffer.data(), value.c_str(), length);
 
+    if (H5Aexists(id, key.c_str()) > 0) {
+        check_status(H5Adelete(id, key.c_str()), "delete attribute " + key);
+    }
+
     hid_t space = H5Screate(H5S_SCALAR);
     hid_t type = H5Tcopy(H5T_C_S1);
     H5Tset_size(type, length);
@@ -216,6 +235,9 @@ void add_cgns_type_attr(hid_t id, const std::string& value) {
 }
 
 void add_flags_attr(hid_t id, int32_t value = 1) {
+    if (H5Aexists(id, "flags") > 0) {
+        check_status(H5Adelete(id, "flags"), "delete attribute flags");
+    }
     hsize_t dims[1] = {1};
     hid_t space = H5Screate_simple(1, dims, nullptr);
     hid_t attr = H5Acreate2(id, "flags", H5T_NATIVE_INT32, space, H5P_DEFAULT, H5P_DEFAULT);
@@ -248,6 +270,56 @@ std::string read_string_attr(hid_t id, const std::string& key) {
     return result;
 }
 
+/** @brief Attribute recording, on the groups of incremental writes, what they were written from. */
+constexpr const char* kFingerprintAttr = "noder_fingerprint";
+
+/** @brief Fingerprints of the subtree a group was written from, and of its node alone. */
+struct StoredFingerprint {
+    std::uint64_t subtree = 0;
+    std::uint64_t node = 0;
+};
+
+/** @brief Hash of what the group of @p node holds apart from its children: name, label, link and payload. */
+std::uint64_t node_own_fingerprint(const Node& node) {
+    utils::Hasher hasher;
+    hasher.update(node.name());
+    hasher.update(node.type());
+    hasher.update(node.linkTargetFile());
+    hasher.update(node.linkTargetPath());
+    hasher.update(node.dataFingerprint());
+    return hasher.digest();
+}
+
+void delete_fingerprint_attr(hid_t id) {
+    if (H5Aexists(id, kFingerprintAttr) > 0) {
+        check_status(H5Adelete(id, kFingerprintAttr), "delete attribute " + std::string(kFingerprintAttr));
+    }
+}
+
+void add_fingerprint_attr(hid_t id, const Node& node) {
+    delete_fingerprint_attr(id);
+    hsize_t dims[1] = {2};
+    hid_t space = H5Screate_simple(1, dims, nullptr);
+    hid_t attr = H5Acreate2(id, kFingerprintAttr, H5T_STD_U64LE, space, H5P_DEFAULT, H5P_DEFAULT);
+    std::uint64_t values[2] = {node.fingerprint(), node_own_fingerprint(node)};
+    check_status(H5Awrite(attr, H5T_NATIVE_UINT64, values), "H5Awrite fingerprint");
+    H5Aclose(attr);
+    H5Sclose(space);
+}
+
+std::optional<StoredFingerprint> read_fingerprint_attr(hid_t id) {
+    if (H5Aexists(id, kFingerprintAttr) <= 0) return std::nullopt;
+    hid_t attr = H5Aopen(id, kFingerprintAttr, H5P_DEFAULT);
+    hid_t space = H5Aget_space(attr);
+    const bool hasTwoValues = H5Sget_simple_extent_npoints(space) == 2;
+    H5Sclose(space);
+    std::uint64_t values[2] = {0, 0};
+    const bool read = hasTwoValues && H5Aread(attr, H5T_NATIVE_UINT64, values) >= 0;
+    H5Aclose(attr);
+    if (!read) return std::nullopt;
+    return StoredFingerprint{values[0], values[1]};
+}
+
 void write_int8_string_dataset(hid_t file, const std::string& dataset_path, const std::string& value) {
     std::vector<int8_t> buffer(value.begin(), value.end());
     buffer.push_back('\0');
@@ -323,6 +395,10 @@ bool is_link_group(hid_t group) {
     return read_string_attr(group, "type") == "LK";
 }
 
+bool is_reserved_child_name(const std::string& name) {
+    return name == " data" || name == " file" || name == " path" || name == " link";
+}
+
 char normalize_order(const char order, const char* context) {
     const char normalized = static_cast<char>(std::toupper(static_cast<unsigned char>(order)));
     if (normalized != 'C' && normalized != 'F') {
@@ -339,67 +415,251 @@ size_t flat_size(const std::vector<size_t>& shape) {
     return totalSize;
 }
 
-std::vector<size_t> indices_from_fortran_flat(size_t flatIndex, const std::vector<size_t>& shape) {
-    std::vector<size_t> indices(shape.size(), 0);
-    for (size_t dim = 0; dim < shape.size(); ++dim) {
-        const size_t extent = shape[dim];
-        indices[dim] = extent == 0 ? 0 : flatIndex % extent;
-        flatIndex = extent == 0 ? 0 : flatIndex / extent;
+/**
+ * @brief Chunk shape, in disk axis order, of a chunked dataset holding an array of shape @p shape.
+ *
+ * Auto chunks keep the fastest-varying axes whole and halve the slowest ones
+ * until a chunk fits in ``options.chunkBytes``.
+ */
+std::vector<hsize_t> chunk_dims_for(
+    const std::vector<size_t>& shape,
+    const size_t itemsize,
+    const io::WriteOptions& options) {
+
+    std::vector<size_t> diskShape = shape;
+    std::reverse(diskShape.begin(), diskShape.end());
+    std::vector<hsize_t> chunk(diskShape.begin(), diskShape.end());
+
+    if (options.chunkPolicy == io::ChunkPolicy::Fixed && options.chunkShape.size() == diskShape.size()) {
+        for (size_t axis = 0; axis < diskShape.size(); ++axis) {
+            const size_t diskAxis = diskShape.size() - 1 - axis;
+            const size_t extent = std::clamp<size_t>(options.chunkShape[axis], 1, diskShape[diskAxis]);
+            chunk[diskAxis] = static_cast<hsize_t>(extent);
+        }
+        return chunk;
+    }
+
+    const hsize_t targetBytes = static_cast<hsize_t>(std::max<size_t>(options.chunkBytes, 1));
+    const auto chunkBytes = [&chunk, itemsize]() {
+        hsize_t bytes = static_cast<hsize_t>(itemsize);
+        for (hsize_t extent : chunk) {
+            bytes *= extent;
+        }
+        return bytes;
+    };
+    for (size_t diskAxis = 0; diskAxis < chunk.size(); ++diskAxis) {
+        while (chunk[diskAxis] > 1 && chunkBytes() > targetBytes) {
+            chunk[diskAxis] = (chunk[diskAxis] + 1) / 2;
+        }
+    }
+    return chunk;
+}
+
+/**
+ * @brief Dataset creation property list for an array of shape @p shape, or H5P_DEFAULT for contiguous storage.
+ */
+hid_t make_dataset_creation_plist(
+    const std::vector<size_t>& shape,
+    const size_t itemsize,
+    const io::WriteOptions& options) {
+
+    const bool useFilters = options.deflateLevel > 0 || options.shuffle;
+    const bool wantsChunks = useFilters || options.chunkPolicy == io::ChunkPolicy::Fixed;
+    const size_t size = flat_size(shape);
+    if (!wantsChunks || options.chunkPolicy == io::ChunkPolicy::Contiguous
+        || shape.empty() || size == 0 || size * itemsize < options.minChunkedBytes) {
+        return H5P_DEFAULT;
+    }
+
+    hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    if (dcpl < 0) {
+        throw std::runtime_error("HDF5 error: cannot create dataset creation property list");
+    }
+    try {
+        const std::vector<hsize_t> chunk = chunk_dims_for(shape, itemsize, options);
+        check_status(H5Pset_chunk(dcpl, static_cast<int>(chunk.size()), chunk.data()), "set chunk shape");
+        if (options.shuffle) {
+            check_status(H5Pset_shuffle(dcpl), "set shuffle filter");
+        }
+        if (options.deflateLevel > 0) {
+            check_status(H5Pset_deflate(dcpl, options.deflateLevel), "set deflate filter");
+        }
+    } catch (...) {
+        H5Pclose(dcpl);
+        throw;
     }
-    return indices;
+    return dcpl;
 }
 
-size_t c_flat_from_indices(const std::vector<size_t>& indices, const std::vector<size_t>& shape) {
-    size_t index = 0;
-    size_t stride = 1;
-    for (size_t dim = indices.size(); dim-- > 0;) {
-        index += indices[dim] * stride;
-        stride *= shape[dim];
+void check_write_options(const io::WriteOptions& options) {
+    if (options.deflateLevel > 9) {
+        throw std::invalid_argument("CGNS/HDF5 write: deflate level must be between 0 and 9");
+    }
+    const bool useFilters = options.deflateLevel > 0 || options.shuffle;
+    if (useFilters && options.chunkPolicy == io::ChunkPolicy::Contiguous) {
+        throw std::invalid_argument("CGNS/HDF5 write: compression filters require chunked storage");
+    }
+    if (options.chunkPolicy == io::ChunkPolicy::Fixed && options.chunkShape.empty()) {
+        throw std::invalid_argument("CGNS/HDF5 write: the Fixed chunk policy requires a chunk shape");
+    }
+    if (options.deflateLevel > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) {
+        throw std::runtime_error("CGNS/HDF5 write: deflate filter is not available in this HDF5 build");
+    }
+    if (options.shuffle && H5Zfilter_avail(H5Z_FILTER_SHUFFLE) <= 0) {
+        throw std::runtime_error("CGNS/HDF5 write: shuffle filter is not available in this HDF5 build");
     }
-    return index;
 }
 
+/**
+ * @brief Entries of a dataset receiving an array, as a strided hyperslab in disk axis order.
+ *
+ * An empty start selects the whole dataset.
+ */
+struct DiskSlab {
+    std::vector<hsize_t> start;
+    std::vector<hsize_t> stride;
+};
+
+/**
+ * @brief Write the payload of @p array into the entries @p target of the dataset @p dset.
+ *
+ * Fortran-contiguous arrays are handed to HDF5 as they are. Other layouts are
+ * gathered into Fortran order one tile at a time, each tile holding at most
+ * ``stagingBytes`` bytes (or a single element of the slowest disk axes), so the
+ * write never stages a full copy of the array.
+ */
 template <typename T>
-std::vector<T> copy_array_to_fortran_buffer(const Array& array) {
+void write_numeric_dataset(hid_t dset, const Array& array, const hid_t dtype, size_t stagingBytes,
+                           const DiskSlab& target = DiskSlab(), hid_t dxpl = H5P_DEFAULT) {
     const std::vector<size_t> shape = array.shape();
-    const size_t totalSize = flat_size(shape);
-    std::vector<T> buffer(totalSize);
-
-    if (totalSize == 0) {
-        return buffer;
+    if (flat_size(shape) == 0) {
+        return;
     }
-
-    if (array.isContiguousInStyleFortran()) {
-        std::memcpy(buffer.data(), array.rawData(), totalSize * sizeof(T));
-        return buffer;
+    const bool inDiskOrder = shape.empty() || array.isContiguousInStyleFortran();
+    if (inDiskOrder && target.start.empty()) {
+        check_status(H5Dwrite(dset, dtype, H5S_ALL, H5S_ALL, dxpl, array.rawData()), "write numeric");
+        return;
     }
 
-    const auto* sourceData = static_cast<const std::uint8_t*>(array.rawData());
+    const size_t rank = shape.size();
     const std::vector<size_t> strides = array.strides();
-    for (size_t fIndex = 0; fIndex < totalSize; ++fIndex) {
-        const std::vector<size_t> indices = indices_from_fortran_flat(fIndex, shape);
-        size_t byteOffset = 0;
-        for (size_t dim = 0; dim < indices.size(); ++dim) {
-            byteOffset += indices[dim] * strides[dim];
+    std::vector<hsize_t> diskShape(rank);
+    std::vector<size_t> diskStrides(rank);
+    for (size_t dim = 0; dim < rank; ++dim) {
+        diskShape[dim] = static_cast<hsize_t>(shape[rank - 1 - dim]);
+        diskStrides[dim] = strides[rank - 1 - dim];
+    }
+
+    hid_t fileSpace = H5Dget_space(dset);
+    std::vector<hsize_t> fileStart(rank);
+    const auto writeTile = [&](const std::vector<hsize_t>& start, const std::vector<hsize_t>& count,
+                               const void* data) {
+        for (size_t dim = 0; dim < rank; ++dim) {
+            fileStart[dim] = target.start.empty() ? start[dim] : target.start[dim] + start[dim] * target.stride[dim];
+        }
+        hsize_t memCount = 1;
+        for (hsize_t extent : count) {
+            memCount *= extent;
+        }
+        hid_t memSpace = H5Screate_simple(1, &memCount, nullptr);
+        herr_t status = H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, fileStart.data(),
+                                            target.stride.empty() ? nullptr : target.stride.data(),
+                                            count.data(), nullptr);
+        if (status >= 0) {
+            status = H5Dwrite(dset, dtype, memSpace, fileSpace, dxpl, data);
         }
-        buffer[fIndex] = *reinterpret_cast<const T*>(sourceData + byteOffset);
+        H5Sclose(memSpace);
+        check_status(status, "write numeric tile");
+    };
+
+    try {
+        if (inDiskOrder) {
+            writeTile(std::vector<hsize_t>(rank, 0), diskShape, array.rawData());
+            H5Sclose(fileSpace);
+            return;
+        }
+
+        // tiles span whole trailing disk axes, `rows` entries of the split axis
+        // and a single entry of the axes before it
+        const size_t maxItems = std::max<size_t>(1, stagingBytes / sizeof(T));
+        size_t splitAxis = rank - 1;
+        size_t trailing = 1;
+        while (splitAxis > 0 && trailing * diskShape[splitAxis] <= maxItems) {
+            trailing *= diskShape[splitAxis];
+            --splitAxis;
+        }
+        const hsize_t rows = std::min<hsize_t>(diskShape[splitAxis], std::max<size_t>(1, maxItems / trailing));
+        std::vector<T> buffer(static_cast<size_t>(rows) * trailing);
+
+        const auto* sourceData = static_cast<const std::uint8_t*>(array.rawData());
+        std::vector<hsize_t> start(rank, 0);
+        std::vector<hsize_t> count(rank, 1);
+        for (size_t dim = splitAxis + 1; dim < rank; ++dim) {
+            count[dim] = diskShape[dim];
+        }
+        while (true) {
+            count[splitAxis] = std::min(rows, diskShape[splitAxis] - start[splitAxis]);
+
+            size_t offset = 0;
+            std::vector<size_t> tileShape(rank);
+            for (size_t dim = 0; dim < rank; ++dim) {
+                offset += static_cast<size_t>(start[dim]) * diskStrides[dim];
+                tileShape[rank - 1 - dim] = static_cast<size_t>(count[dim]);
+            }
+            arraylayout::copyStrided(sourceData + offset, strides, buffer.data(),
+                                     arraylayout::contiguousStrides(tileShape, sizeof(T), 'F'), tileShape, sizeof(T));
+            writeTile(start, count, buffer.data());
+
+            start[splitAxis] += count[splitAxis];
+            if (start[splitAxis] < diskShape[splitAxis]) {
+                continue;
+            }
+            start[splitAxis] = 0;
+            size_t dim = splitAxis;
+            while (dim > 0) {
+                --dim;
+                if (++start[dim] < diskShape[dim]) {
+                    break;
+                }
+                start[dim] = 0;
+            }
+            if (dim == 0 && start[0] == 0) {
+                break;
+            }
+        }
+    } catch (...) {
+        H5Sclose(fileSpace);
+        throw;
     }
-    return buffer;
+    H5Sclose(fileSpace);
 }
 
 template <typename T>
-void write_numeric_array(hid_t loc, const std::string& name, const Array& array, const hid_t dtype) {
+void write_numeric_array(hid_t loc, const std::string& name, const Array& array, const hid_t dtype,
+                         const io::WriteOptions& options) {
     std::vector<size_t> diskShape = array.shape();
     std::reverse(diskShape.begin(), diskShape.end());
     hid_t space = make_dataspace(diskShape);
-    hid_t dset = H5Dcreate2(loc, name.c_str(), dtype, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-    std::vector<T> buffer = copy_array_to_fortran_buffer<T>(array);
-    check_status(H5Dwrite(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data()), "write numeric");
-    H5Dclose(dset);
+    hid_t dcpl = make_dataset_creation_plist(array.shape(), array.itemsize(), options);
+    hid_t dset = H5Dcreate2(loc, name.c_str(), dtype, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    if (dcpl != H5P_DEFAULT) {
+        H5Pclose(dcpl);
+    }
     H5Sclose(space);
+    if (dset < 0) {
+        throw std::runtime_error("HDF5 error: cannot create dataset " + name);
+    }
+    try {
+        write_numeric_dataset<T>(dset, array, dtype, options.stagingBytes);
+    } catch (...) {
+        H5Dclose(dset);
+        throw;
+    }
+    H5Dclose(dset);
 }
 
-void write_array(hid_t loc, const std::string& name, const Array& array, const std::string& cgnsType) {
+void write_array(hid_t loc, const std::string& name, const Array& array, const std::string& cgnsType,
+                 const io::WriteOptions& options = io::WriteOptions()) {
     if (cgnsType == "C1") {
         std::string str = array.extractString();
         std::vector<int8_t> buffer(str.begin(), str.end());
@@ -412,21 +672,39 @@ void write_array(hid_t loc, const std::string& name, const Array& array, const s
         return;
     }
 
-    if (cgnsType == "I1") return write_numeric_array<int8_t>(loc, name, array, H5T_NATIVE_INT8);
-    if (cgnsType == "I2") return write_numeric_array<int16_t>(loc, name, array, H5T_NATIVE_INT16);
-    if (cgnsType == "I4") return write_numeric_array<int32_t>(loc, name, array, H5T_NATIVE_INT32);
-    if (cgnsType == "I8") return write_numeric_array<int64_t>(loc, name, array, H5T_NATIVE_INT64);
-    if (cgnsType == "U1") return write_numeric_array<uint8_t>(loc, name, array, H5T_NATIVE_UINT8);
-    if (cgnsType == "U2") return write_numeric_array<uint16_t>(loc, name, array, H5T_NATIVE_UINT16);
-    if (cgnsType == "U4") return write_numeric_array<uint32_t>(loc, name, array, H5T_NATIVE_UINT32);
-    if (cgnsType == "U8") return write_numeric_array<uint64_t>(loc, name, array, H5T_NATIVE_UINT64);
-    if (cgnsType == "R4") return write_numeric_array<float>(loc, name, array, H5T_NATIVE_FLOAT);
-    if (cgnsType == "R8") return write_numeric_array<double>(loc, name, array, H5T_NATIVE_DOUBLE);
-    if (cgnsType == "X1") return write_numeric_array<int8_t>(loc, name, array, H5T_NATIVE_INT8);
+    if (cgnsType == "I1") return write_numeric_array<int8_t>(loc, name, array, H5T_NATIVE_INT8, options);
+    if (cgnsType == "I2") return write_numeric_array<int16_t>(loc, name, array, H5T_NATIVE_INT16, options);
+    if (cgnsType == "I4") return write_numeric_array<int32_t>(loc, name, array, H5T_NATIVE_INT32, options);
+    if (cgnsType == "I8") return write_numeric_array<int64_t>(loc, name, array, H5T_NATIVE_INT64, options);
+    if (cgnsType == "U1") return write_numeric_array<uint8_t>(loc, name, array, H5T_NATIVE_UINT8, options);
+    if (cgnsType == "U2") return write_numeric_array<uint16_t>(loc, name, array, H5T_NATIVE_UINT16, options);
+    if (cgnsType == "U4") return write_numeric_array<uint32_t>(loc, name, array, H5T_NATIVE_UINT32, options);
+    if (cgnsType == "U8") return write_numeric_array<uint64_t>(loc, name, array, H5T_NATIVE_UINT64, options);
+    if (cgnsType == "R4") return write_numeric_array<float>(loc, name, array, H5T_NATIVE_FLOAT, options);
+    if (cgnsType == "R8") return write_numeric_array<double>(loc, name, array, H5T_NATIVE_DOUBLE, options);
+    if (cgnsType == "X1") return write_numeric_array<int8_t>(loc, name, array, H5T_NATIVE_INT8, options);
 
     throw std::runtime_error("Unsupported Array dtype for CGNS write: " + cgnsType);
 }
 
+void write_array_dataset(hid_t dset, const Array& array, size_t stagingBytes,
+                         const DiskSlab& target = DiskSlab(), hid_t dxpl = H5P_DEFAULT) {
+    const std::string cgnsType = cgnsTypeFromArray(array);
+    if (cgnsType == "I1") return write_numeric_dataset<int8_t>(dset, array, H5T_NATIVE_INT8, stagingBytes, target, dxpl);
+    if (cgnsType == "I2") return write_numeric_dataset<int16_t>(dset, array, H5T_NATIVE_INT16, stagingBytes, target, dxpl);
+    if (cgnsType == "I4") return write_numeric_dataset<int32_t>(dset, array, H5T_NATIVE_INT32, stagingBytes, target, dxpl);
+    if (cgnsType == "I8") return write_numeric_dataset<int64_t>(dset, array, H5T_NATIVE_INT64, stagingBytes, target, dxpl);
+    if (cgnsType == "U1") return write_numeric_dataset<uint8_t>(dset, array, H5T_NATIVE_UINT8, stagingBytes, target, dxpl);
+    if (cgnsType == "U2") return write_numeric_dataset<uint16_t>(dset, array, H5T_NATIVE_UINT16, stagingBytes, target, dxpl);
+    if (cgnsType == "U4") return write_numeric_dataset<uint32_t>(dset, array, H5T_NATIVE_UINT32, stagingBytes, target, dxpl);
+    if (cgnsType == "U8") return write_numeric_dataset<uint64_t>(dset, array, H5T_NATIVE_UINT64, stagingBytes, target, dxpl);
+    if (cgnsType == "R4") return write_numeric_dataset<float>(dset, array, H5T_NATIVE_FLOAT, stagingBytes, target, dxpl);
+    if (cgnsType == "R8") return write_numeric_dataset<double>(dset, array, H5T_NATIVE_DOUBLE, stagingBytes, target, dxpl);
+    if (cgnsType == "X1") return write_numeric_dataset<int8_t>(dset, array, H5T_NATIVE_INT8, stagingBytes, target, dxpl);
+
+    throw std::runtime_error("CGNS/HDF5 write: unsupported Array dtype: " + cgnsType);
+}
+
 template <typename T>
 Array read_numeric_array(hid_t dset, const std::vector<size_t>& shape) {
     Array array = arrayfactory::empty<T>(shape, 'F');
@@ -436,11 +714,34 @@ Array read_numeric_array(hid_t dset, const std::vector<size_t>& shape) {
     return array;
 }
 
+void write_link_datasets(
+    hid_t file,
+    const std::string& groupPath,
+    const std::string& targetFile,
+    const std::string& targetPath) {
+
+    write_int8_string_dataset(file, groupPath + "/ file", targetFile);
+    write_int8_string_dataset(file, groupPath + "/ path", targetPath);
+
+    const std::string linkDatasetPath = groupPath + "/ link";
+    if (targetFile.empty() || targetFile == ".") {
+        check_status(
+            H5Lcreate_soft(targetPath.c_str(), file, linkDatasetPath.c_str(), H5P_DEFAULT, H5P_DEFAULT),
+            "create soft link at " + linkDatasetPath);
+    } else {
+        check_status(
+            H5Lcreate_external(targetFile.c_str(), targetPath.c_str(), file,
+                               linkDatasetPath.c_str(), H5P_DEFAULT, H5P_DEFAULT),
+            "create external link at " + linkDatasetPath);
+    }
+}
+
 void write_node_rec(
     hid_t file,
     hid_t gcpl,
     const std::shared_ptr<Node>& node,
     const std::string& path,
+    const io::WriteOptions& options,
     const std::string& cgnsTreeRootName = "") {
 
     std::string groupPath = path + "/" + node->name();
@@ -459,21 +760,10 @@ void write_node_rec(
         }
 
         add_cgns_type_attr(group, "LK");
-        const std::string targetPath = persisted_link_target_path(node, cgnsTreeRootName);
-
-        write_int8_string_dataset(file, groupPath + "/ file", node->linkTargetFile());
-        write_int8_string_dataset(file, groupPath + "/ path", targetPath);
-
-        const std::string linkDatasetPath = groupPath + "/ link";
-        if (node->linkTargetFile().empty() || node->linkTargetFile() == ".") {
-            check_status(
-                H5Lcreate_soft(targetPath.c_str(), file, linkDatasetPath.c_str(), H5P_DEFAULT, H5P_DEFAULT),
-                "create soft link at " + linkDatasetPath);
-        } else {
-            check_status(
-                H5Lcreate_external(node->linkTargetFile().c_str(), targetPath.c_str(), file,
-                                   linkDatasetPath.c_str(), H5P_DEFAULT, H5P_DEFAULT),
-                "create external link at " + linkDatasetPath);
+        write_link_datasets(file, groupPath, node->linkTargetFile(),
+                            persisted_link_target_path(node, cgnsTreeRootName));
+        if (options.incremental) {
+            add_fingerprint_attr(group, *node);
         }
 
         H5Gclose(group);
@@ -489,12 +779,15 @@ void write_node_rec(
             throw std::runtime_error("Expected Array");
         }
         nodeCgnsDataType = cgnsTypeFromArray(*array);
-        write_array(file, groupPath + "/ data", *array, nodeCgnsDataType);
+        write_array(file, groupPath + "/ data", *array, nodeCgnsDataType, options);
     }
     add_cgns_type_attr(group, nodeCgnsDataType);
 
     for (auto& child : node->children()) {
-        write_node_rec(file, gcpl, child, groupPath, cgnsTreeRootName);
+        write_node_rec(file, gcpl, child, groupPath, options, cgnsTreeRootName);
+    }
+    if (options.incremental) {
+        add_fingerprint_attr(group, *node);
     }
 
     H5Gclose(group);
@@ -512,40 +805,59 @@ void write_cgns_library_version(hid_t file, hid_t gcpl, const float& cgnsVersion
     H5Gclose(group);
 }
 
+/**
+ * @brief Read a numeric payload into an Array of memory order @p order.
+ *
+ * When @p hdf5Lock is given, it is released once the values are read so that
+ * the conversion to C order runs without holding the HDF5 library lock.
+ */
 template <typename T>
-Array readNumericArrayTyped(hid_t dset, const std::vector<size_t>& shape, const std::string& cgnsType, const char order) {
+Array readNumericArrayTyped(
+    hid_t dset,
+    const std::vector<size_t>& shape,
+    const std::string& cgnsType,
+    const char order,
+    hid_t memSpace = H5S_ALL,
+    hid_t fileSpace = H5S_ALL,
+    std::unique_lock<std::mutex>* hdf5Lock = nullptr) {
+
     const char normalizedOrder = normalize_order(order, "CGNS/HDF5 read");
     hid_t dtype = hdfTypeFromCgnsType(cgnsType);
     const size_t totalSize = flat_size(shape);
 
     if (normalizedOrder == 'F') {
         Array array = arrayfactory::empty<T>(shape, 'F');
-        check_status(H5Dread(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, array.rawData()),
+        check_status(H5Dread(dset, dtype, memSpace, fileSpace, H5P_DEFAULT, array.rawData()),
                      std::string("read ") + cgnsType + " F-order");
         return array;
     }
 
     std::vector<T> buffer(totalSize);
-    check_status(H5Dread(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data()),
+    check_status(H5Dread(dset, dtype, memSpace, fileSpace, H5P_DEFAULT, buffer.data()),
                  std::string("read ") + cgnsType + " Fortran buffer");
-
-    Array array = arrayfactory::empty<T>(shape, 'C');
-    T* destData = static_cast<T*>(array.rawData());
-
-    if (shape.size() <= 1) {
-        std::memcpy(destData, buffer.data(), totalSize * sizeof(T));
-        return array;
+    if (hdf5Lock && hdf5Lock->owns_lock()) {
+        hdf5Lock->unlock();
     }
 
-    for (size_t fIndex = 0; fIndex < totalSize; ++fIndex) {
-        const std::vector<size_t> indices = indices_from_fortran_flat(fIndex, shape);
-        destData[c_flat_from_indices(indices, shape)] = buffer[fIndex];
-    }
+    Array array = arrayfactory::empty<T>(shape, 'C');
+    arraylayout::copyStrided(buffer.data(), arraylayout::contiguousStrides(shape, sizeof(T), 'F'),
+                             array.rawData(), array.strides(), shape, sizeof(T));
     return array;
 }
 
-Array readArrayFromDataset(hid_t dset, const std::vector<size_t>& shape, const std::string& cgnsType, const char order = 'F') {
+Array readArrayFromDataset(
+    hid_t dset,
+    const std::vector<size_t>& shape,
+    const std::string& cgnsType,
+    const char order = 'F',
+    hid_t memSpace = H5S_ALL,
+    hid_t fileSpace = H5S_ALL,
+    std::unique_lock<std::mutex>* hdf5Lock = nullptr) {
+
     if (cgnsType == "C1") {
+        if (fileSpace != H5S_ALL) {
+            throw std::runtime_error("CGNS/HDF5 slab: string payloads cannot be read partially");
+        }
         hid_t space = H5Dget_space(dset);
         int ndims = H5Sget_simple_extent_ndims(space);
         if (ndims < 0) {
@@ -573,43 +885,353 @@ Array readArrayFromDataset(hid_t dset, const std::vector<size_t>& shape, const s
     }
 
     if (cgnsType == "I1") {
-        return readNumericArrayTyped<int8_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<int8_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "I2") {
-        return readNumericArrayTyped<int16_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<int16_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "I4") {
-        return readNumericArrayTyped<int32_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<int32_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "I8") {
-        return readNumericArrayTyped<int64_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<int64_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "U1") {
-        return readNumericArrayTyped<uint8_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<uint8_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "U2") {
-        return readNumericArrayTyped<uint16_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<uint16_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "U4") {
-        return readNumericArrayTyped<uint32_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<uint32_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "U8") {
-        return readNumericArrayTyped<uint64_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<uint64_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "R4") {
-        return readNumericArrayTyped<float>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<float>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "R8") {
-        return readNumericArrayTyped<double>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<double>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
     if (cgnsType == "X1") {
-        return readNumericArrayTyped<int8_t>(dset, shape, cgnsType, order);
+        return readNumericArrayTyped<int8_t>(dset, shape, cgnsType, order, memSpace, fileSpace, hdf5Lock);
     }
 
     throw std::runtime_error("Unsupported type in read: " + cgnsType);
 }
 
-std::shared_ptr<Node> read_node_rec(hid_t file, const std::string& path, const char order = 'C') {
+std::vector<hsize_t> dataset_disk_dims(hid_t dset) {
+    hid_t space = H5Dget_space(dset);
+    const int ndims = H5Sget_simple_extent_ndims(space);
+    if (ndims < 0) {
+        H5Sclose(space);
+        throw std::runtime_error("HDF5 error: cannot get dataset rank");
+    }
+    std::vector<hsize_t> dims(static_cast<size_t>(ndims));
+    if (ndims > 0) {
+        H5Sget_simple_extent_dims(space, dims.data(), nullptr);
+    }
+    H5Sclose(space);
+    return dims;
+}
+
+/**
+ * @brief File and memory dataspaces selecting an io::Hyperslab of a dataset.
+ *
+ * The slab is given in array axis order and reversed to match the disk layout.
+ */
+struct SlabSelection {
+    hid_t fileSpace = -1;
+    hid_t memSpace = -1;
+    std::vector<size_t> shape;
+    DiskSlab target;
+
+    SlabSelection(hid_t dset, const io::Hyperslab& slab) {
+        const std::vector<hsize_t> diskDims = dataset_disk_dims(dset);
+        const size_t rank = diskDims.size();
+        if (rank == 0) {
+            throw std::invalid_argument("CGNS/HDF5 slab: cannot select a hyperslab of a scalar payload");
+        }
+        if (slab.start.size() != rank || slab.count.size() != rank
+            || (!slab.stride.empty() && slab.stride.size() != rank)) {
+            throw std::invalid_argument(
+                "CGNS/HDF5 slab: start, count and stride must have one entry per axis (" + std::to_string(rank) + ")");
+        }
+
+        std::vector<hsize_t> diskStart(rank), diskCount(rank), diskStride(rank);
+        for (size_t axis = 0; axis < rank; ++axis) {
+            const size_t diskAxis = rank - 1 - axis;
+            const size_t stride = slab.stride.empty() ? 1 : slab.stride[axis];
+            if (stride == 0) {
+                throw std::invalid_argument("CGNS/HDF5 slab: stride must be positive");
+            }
+            if (slab.count[axis] > 0
+                && slab.start[axis] + (slab.count[axis] - 1) * stride >= diskDims[diskAxis]) {
+                throw std::out_of_range("CGNS/HDF5 slab: selection exceeds payload bounds along axis " + std::to_string(axis));
+            }
+            diskStart[diskAxis] = static_cast<hsize_t>(slab.start[axis]);
+            diskCount[diskAxis] = static_cast<hsize_t>(slab.count[axis]);
+            diskStride[diskAxis] = static_cast<hsize_t>(stride);
+        }
+
+        fileSpace = H5Dget_space(dset);
+        memSpace = H5Screate_simple(static_cast<int>(rank), diskCount.data(), nullptr);
+        shape = slab.count;
+        target = {diskStart, diskStride};
+        check_status(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, diskStart.data(), diskStride.data(),
+                                         diskCount.data(), nullptr),
+                     "select hyperslab");
+    }
+
+    ~SlabSelection() {
+        if (memSpace >= 0) H5Sclose(memSpace);
+        if (fileSpace >= 0) H5Sclose(fileSpace);
+    }
+
+    SlabSelection(const SlabSelection&) = delete;
+    SlabSelection& operator=(const SlabSelection&) = delete;
+};
+
+Array read_dataset_slab(
+    hid_t file,
+    const std::string& dataPath,
+    const std::string& cgnsType,
+    const io::Hyperslab& slab,
+    const char order) {
+
+    hid_t dset = H5Dopen2(file, dataPath.c_str(), H5P_DEFAULT);
+    if (dset < 0) {
+        throw std::runtime_error("HDF5 error: cannot open dataset " + dataPath);
+    }
+    try {
+        SlabSelection selection(dset, slab);
+        Array array = readArrayFromDataset(
+            dset, selection.shape, cgnsType, order, selection.memSpace, selection.fileSpace);
+        H5Dclose(dset);
+        return array;
+    } catch (...) {
+        H5Dclose(dset);
+        throw;
+    }
+}
+
+std::string hdf5_group_path(const std::string& nodePath) {
+    std::string groupPath = nodePath;
+    while (!groupPath.empty() && groupPath.back() == '/') {
+        groupPath.pop_back();
+    }
+    if (groupPath.empty() || groupPath.front() != '/') {
+        groupPath.insert(groupPath.begin(), '/');
+    }
+    return groupPath;
+}
+
+std::string payload_cgns_type(hid_t file, const std::string& groupPath) {
+    hid_t group = H5Gopen2(file, groupPath.c_str(), H5P_DEFAULT);
+    if (group < 0) {
+        throw std::runtime_error("Failed to open group: " + groupPath);
+    }
+    const std::string cgnsType = read_string_attr(group, "type");
+    H5Gclose(group);
+    const std::string dataPath = groupPath + "/ data";
+    if (cgnsType.empty() || cgnsType == "MT" || cgnsType == "LK"
+        || H5Lexists(file, dataPath.c_str(), H5P_DEFAULT) <= 0) {
+        throw std::runtime_error("CGNS/HDF5 slab: node has no payload: " + groupPath);
+    }
+    return cgnsType;
+}
+
+std::string dtype_name_from_cgns_type(const std::string& cgnsType) {
+    if (cgnsType == "I1" || cgnsType == "X1") return "int8";
+    if (cgnsType == "I2") return "int16";
+    if (cgnsType == "I4") return "int32";
+    if (cgnsType == "I8") return "int64";
+    if (cgnsType == "U1") return "uint8";
+    if (cgnsType == "U2") return "uint16";
+    if (cgnsType == "U4") return "uint32";
+    if (cgnsType == "U8") return "uint64";
+    if (cgnsType == "R4") return "float32";
+    if (cgnsType == "R8") return "float64";
+    if (cgnsType == "C1") return "bytes";
+    throw std::runtime_error("Unsupported type in read: " + cgnsType);
+}
+
+/** @brief Path pattern compiled into one glob matcher per path element. */
+using CompiledPathPattern = std::vector<std::regex>;
+
+CompiledPathPattern compile_path_pattern(const std::string& pattern) {
+    CompiledPathPattern elements;
+    std::stringstream stream(pattern);
+    std::string element;
+    while (std::getline(stream, element, '/')) {
+        if (!element.empty()) {
+            elements.emplace_back(utils::globToRegexPattern(element));
+        }
+    }
+    if (elements.empty()) {
+        throw std::invalid_argument("CGNS/HDF5 read: empty path pattern '" + pattern + "'");
+    }
+    return elements;
+}
+
+std::vector<CompiledPathPattern> compile_path_patterns(const std::vector<std::string>& patterns) {
+    std::vector<CompiledPathPattern> compiled;
+    compiled.reserve(patterns.size());
+    for (const auto& pattern : patterns) {
+        compiled.push_back(compile_path_pattern(pattern));
+    }
+    return compiled;
+}
+
+/** @brief True when the leading elements of @p pathElements match the whole @p pattern. */
+bool path_starts_with_pattern(const CompiledPathPattern& pattern, const std::vector<std::string>& pathElements) {
+    if (pathElements.size() < pattern.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        if (!std::regex_match(pathElements[i], pattern[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** @brief True when @p pathElements is a strict ancestor of paths that may match @p pattern. */
+bool path_leads_to_pattern(const CompiledPathPattern& pattern, const std::vector<std::string>& pathElements) {
+    if (pathElements.size() >= pattern.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < pathElements.size(); ++i) {
+        if (!std::regex_match(pathElements[i], pattern[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+enum class PathSelection {
+    Excluded,
+    Traversed,
+    Selected
+};
+
+/** @brief Payload whose read is postponed until the whole hierarchy is known. */
+struct PendingPayload {
+    std::shared_ptr<Node> node;
+    std::string dataPath;
+    std::vector<size_t> shape;
+    std::string cgnsType;
+};
+
+/**
+ * @brief State shared by a whole read_node_rec traversal.
+ *
+ * When reading lazily, @p sharedFile keeps the file open for as long as a
+ * deferred payload still needs it. When @p pendingPayloads is set, payloads
+ * are queued there instead of being read during the traversal.
+ */
+struct ReadContext {
+    hid_t file = -1;
+    std::shared_ptr<hid_t> sharedFile;
+    char order = 'C';
+    bool lazy = false;
+    std::vector<CompiledPathPattern> includePatterns;
+    std::vector<CompiledPathPattern> excludePatterns;
+    size_t maxDepth = std::numeric_limits<size_t>::max();
+    std::vector<PendingPayload>* pendingPayloads = nullptr;
+    std::set<std::vector<std::string>> skippedPaths;
+};
+
+PathSelection select_path(
+    const ReadContext& context,
+    const std::vector<std::string>& pathElements,
+    const bool parentSelected) {
+
+    for (const auto& pattern : context.excludePatterns) {
+        if (path_starts_with_pattern(pattern, pathElements)) {
+            return PathSelection::Excluded;
+        }
+    }
+    if (parentSelected || context.includePatterns.empty()) {
+        return PathSelection::Selected;
+    }
+    for (const auto& pattern : context.includePatterns) {
+        if (path_starts_with_pattern(pattern, pathElements)) {
+            return PathSelection::Selected;
+        }
+    }
+    for (const auto& pattern : context.includePatterns) {
+        if (path_leads_to_pattern(pattern, pathElements)) {
+            return PathSelection::Traversed;
+        }
+    }
+    return PathSelection::Excluded;
+}
+
+/**
+ * @brief Lock serializing HDF5 calls of the payload reader threads and of deferred loads.
+ */
+std::mutex& hdf5_library_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::shared_ptr<Data> make_deferred_payload(
+    const ReadContext& context,
+    const std::string& dataPath,
+    const std::vector<size_t>& shape,
+    const std::string& cgnsType) {
+
+    auto loader = [sharedFile = context.sharedFile, dataPath, shape, cgnsType, order = context.order]()
+        -> std::shared_ptr<Data> {
+        // deferred payloads may be loaded from several threads, by parallel queries for instance
+        std::lock_guard<std::mutex> lock(hdf5_library_mutex());
+        hid_t dset = H5Dopen2(*sharedFile, dataPath.c_str(), H5P_DEFAULT);
+        if (dset < 0) {
+            throw std::runtime_error("HDF5 error: cannot open dataset " + dataPath);
+        }
+        try {
+            auto array = std::make_shared<Array>(readArrayFromDataset(dset, shape, cgnsType, order));
+            H5Dclose(dset);
+            return array;
+        } catch (...) {
+            H5Dclose(dset);
+            throw;
+        }
+    };
+
+    if (cgnsType == "C1") {
+        return std::make_shared<DeferredData>(loader, std::vector<size_t>{1}, "bytes", true);
+    }
+    auto deferred = std::make_shared<DeferredData>(loader, shape, dtype_name_from_cgns_type(cgnsType));
+    deferred->setSlabLoader(
+        [sharedFile = context.sharedFile, dataPath, cgnsType, order = context.order](
+            const std::vector<size_t>& start, const std::vector<size_t>& count) -> std::shared_ptr<Data> {
+            std::lock_guard<std::mutex> lock(hdf5_library_mutex());
+            io::Hyperslab slab;
+            slab.start = start;
+            slab.count = count;
+            return std::make_shared<Array>(read_dataset_slab(*sharedFile, dataPath, cgnsType, slab, order));
+        });
+    return deferred;
+}
+
+/**
+ * @brief Read the group at @p path and the selected part of its subtree.
+ *
+ * Nodes that are only traversed to reach a selection are read without
+ * payload, and dropped when none of their descendants is selected.
+ * @return The read node, or nullptr when it was pruned.
+ */
+std::shared_ptr<Node> read_node_rec(
+    const ReadContext& context,
+    const std::string& path,
+    std::vector<std::string>& pathElements,
+    const bool selected) {
+
+    const hid_t file = context.file;
+    const bool isRoot = pathElements.empty();
     hid_t group = H5Gopen2(file, path.c_str(), H5P_DEFAULT);
     if (group < 0) {
         throw std::runtime_error("Failed to open group: " + path);
@@ -622,6 +1244,10 @@ std::shared_ptr<Node> read_node_rec(hid_t file, const std::string& path, const c
 
     auto node = make_node_for_cgns_label(name, label);
     if (is_link_group(group)) {
+        if (!selected && !isRoot) {
+            H5Gclose(group);
+            return nullptr;
+        }
         std::string targetFile = read_int8_string_dataset(file, path + "/ file");
         std::string targetPath = read_int8_string_dataset(file, path + "/ path");
         if (targetPath.empty()) {
@@ -634,7 +1260,7 @@ std::shared_ptr<Node> read_node_rec(hid_t file, const std::string& path, const c
     }
 
     std::string dataPath = path + "/ data";
-    if (H5Lexists(file, dataPath.c_str(), H5P_DEFAULT)) {
+    if (selected && H5Lexists(file, dataPath.c_str(), H5P_DEFAULT)) {
         hid_t dset = H5Dopen2(file, dataPath.c_str(), H5P_DEFAULT);
         hid_t space = H5Dget_space(dset);
         int ndims = H5Sget_simple_extent_ndims(space);
@@ -653,15 +1279,23 @@ std::shared_ptr<Node> read_node_rec(hid_t file, const std::string& path, const c
             if (cgnsType != "C1") {
                 std::reverse(shape.begin(), shape.end());
             }
-            node->setData(readArrayFromDataset(dset, shape, cgnsType, order));
+            if (context.lazy) {
+                node->setData(make_deferred_payload(context, dataPath, shape, cgnsType));
+            } else if (context.pendingPayloads) {
+                context.pendingPayloads->push_back({node, dataPath, shape, cgnsType});
+            } else {
+                node->setData(readArrayFromDataset(dset, shape, cgnsType, context.order));
+            }
         }
 
         H5Sclose(space);
         H5Dclose(dset);
     }
 
-    hsize_t nObjs;
-    H5Gget_num_objs(group, &nObjs);
+    hsize_t nObjs = 0;
+    if (pathElements.size() < context.maxDepth) {
+        H5Gget_num_objs(group, &nObjs);
+    }
     for (hsize_t i = 0; i < nObjs; ++i) {
         if (H5Gget_objtype_by_idx(group, i) != H5G_GROUP) {
             continue;
@@ -669,48 +1303,1287 @@ std::shared_ptr<Node> read_node_rec(hid_t file, const std::string& path, const c
         char nameBuf[256];
         H5Gget_objname_by_idx(group, i, nameBuf, sizeof(nameBuf));
         std::string childName(nameBuf);
-        if (childName == " data" || childName == " file" || childName == " path" || childName == " link") {
+        if (is_reserved_child_name(childName)) {
             continue;
         }
-        std::string childPath = path + "/" + childName;
-        auto child = read_node_rec(file, childPath, order);
-        child->attachTo(node);
+        pathElements.push_back(childName);
+        const PathSelection selection = context.skippedPaths.count(pathElements) > 0
+            ? PathSelection::Excluded
+            : select_path(context, pathElements, selected);
+        if (selection != PathSelection::Excluded) {
+            std::string childPath = path + "/" + childName;
+            auto child = read_node_rec(context, childPath, pathElements, selection == PathSelection::Selected);
+            if (child) {
+                child->attachTo(node);
+            }
+        }
+        pathElements.pop_back();
     }
 
     H5Gclose(group);
+    if (!selected && !isRoot && node->children().empty()) {
+        return nullptr;
+    }
     return node;
 }
 
+Array read_pending_payload(hid_t file, const PendingPayload& payload, const char order, const bool serializeHdf5) {
+    std::unique_lock<std::mutex> lock(hdf5_library_mutex(), std::defer_lock);
+    if (serializeHdf5) {
+        lock.lock();
+    }
+    hid_t dset = H5Dopen2(file, payload.dataPath.c_str(), H5P_DEFAULT);
+    if (dset < 0) {
+        throw std::runtime_error("HDF5 error: cannot open dataset " + payload.dataPath);
+    }
+    std::optional<Array> array;
+    try {
+        array.emplace(readArrayFromDataset(
+            dset, payload.shape, payload.cgnsType, order, H5S_ALL, H5S_ALL, &lock));
+    } catch (...) {
+        if (serializeHdf5 && !lock.owns_lock()) {
+            lock.lock();
+        }
+        H5Dclose(dset);
+        throw;
+    }
+    if (serializeHdf5 && !lock.owns_lock()) {
+        lock.lock();
+    }
+    H5Dclose(dset);
+    return std::move(*array);
+}
+
+/**
+ * @brief Read queued payloads on at most @p threadCount threads of the shared pool and attach them to their nodes.
+ *
+ * Each payload goes to its own node, so the result does not depend on the
+ * scheduling. If several reads fail, the error of the first queued payload is
+ * rethrown.
+ */
+void read_pending_payloads(
+    hid_t file,
+    const std::vector<PendingPayload>& pending,
+    const char order,
+    const size_t threadCount) {
+
+    hbool_t threadSafe = false;
+    check_status(H5is_library_threadsafe(&threadSafe), "query library thread-safety");
+    const bool serializeHdf5 = !threadSafe;
+
+    std::vector<std::exception_ptr> errors(pending.size());
+    std::atomic<size_t> next{0};
+    utils::ThreadPool::shared().parallelFor(std::min(threadCount, pending.size()), 1, [&](size_t, size_t) {
+        for (size_t index = next++; index < pending.size(); index = next++) {
+            try {
+                pending[index].node->setData(read_pending_payload(file, pending[index], order, serializeHdf5));
+            } catch (...) {
+                errors[index] = std::current_exception();
+            }
+        }
+    }, threadCount);
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+std::shared_ptr<hid_t> open_shared_file(const std::string& filename) {
+    hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (file < 0) {
+        throw std::runtime_error("HDF5 error: cannot open file " + filename);
+    }
+    return std::shared_ptr<hid_t>(new hid_t(file), [](hid_t* handle) {
+        H5Fclose(*handle);
+        delete handle;
+    });
+}
+
+/**
+ * @brief Read the hierarchy of an open file, leaving out the subtrees at @p skippedPaths.
+ *
+ * The file is closed when @p sharedFile is released, that is once the last
+ * deferred payload is loaded when reading lazily.
+ */
+std::shared_ptr<Node> read_file(
+    const std::shared_ptr<hid_t>& sharedFile,
+    const io::ReadOptions& options,
+    std::set<std::vector<std::string>> skippedPaths) {
+
+    const hid_t file = *sharedFile;
+    ReadContext context;
+    context.file = file;
+    context.order = options.order;
+    context.lazy = options.lazy;
+    context.includePatterns = compile_path_patterns(options.includePatterns);
+    context.excludePatterns = compile_path_patterns(options.excludePatterns);
+    context.maxDepth = options.maxDepth;
+    context.skippedPaths = std::move(skippedPaths);
+    if (context.lazy) {
+        // deferred loads happen later: reject an invalid order now, like an eager read would
+        normalize_order(context.order, "CGNS/HDF5 read");
+        context.sharedFile = sharedFile;
+    }
+    const size_t poolThreads = utils::ThreadPool::shared().threads();
+    const size_t threadCount = options.threads == 0 ? poolThreads : std::min(options.threads, poolThreads);
+    std::vector<PendingPayload> pendingPayloads;
+    if (!context.lazy && threadCount > 1) {
+        normalize_order(context.order, "CGNS/HDF5 read");
+        context.pendingPayloads = &pendingPayloads;
+    }
+    std::vector<std::string> pathElements;
+    auto root = read_node_rec(context, "/", pathElements, context.includePatterns.empty());
+    if (context.pendingPayloads) {
+        read_pending_payloads(file, pendingPayloads, context.order, threadCount);
+    }
+    return root;
+}
+
+bool group_has_child_nodes(hid_t group) {
+    hsize_t nObjs = 0;
+    H5Gget_num_objs(group, &nObjs);
+    for (hsize_t i = 0; i < nObjs; ++i) {
+        if (H5Gget_objtype_by_idx(group, i) != H5G_GROUP) {
+            continue;
+        }
+        char nameBuf[256];
+        H5Gget_objname_by_idx(group, i, nameBuf, sizeof(nameBuf));
+        if (!is_reserved_child_name(nameBuf)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void delete_link_if_exists(hid_t file, const std::string& path) {
+    if (H5Lexists(file, path.c_str(), H5P_DEFAULT) > 0) {
+        check_status(H5Ldelete(file, path.c_str(), H5P_DEFAULT), "delete " + path);
+    }
+}
+
+/** @brief True when the dataset at @p dataPath can be overwritten by @p array without being recreated. */
+bool dataset_has_layout_of(hid_t file, const std::string& dataPath, const std::string& storedType,
+                           const Array& array, const std::string& cgnsType) {
+    if (cgnsType == "C1" || storedType != cgnsType || H5Lexists(file, dataPath.c_str(), H5P_DEFAULT) <= 0) {
+        return false;
+    }
+    hid_t dset = H5Dopen2(file, dataPath.c_str(), H5P_DEFAULT);
+    if (dset < 0) {
+        return false;
+    }
+    const std::vector<hsize_t> diskDims = dataset_disk_dims(dset);
+    H5Dclose(dset);
+
+    std::vector<size_t> diskShape = array.shape();
+    std::reverse(diskShape.begin(), diskShape.end());
+    return std::vector<size_t>(diskDims.begin(), diskDims.end()) == diskShape;
+}
+
+/** @brief Open the group at @p groupPath, creating it and its missing ancestors. */
+hid_t open_or_create_group_path(hid_t file, hid_t gcpl, const std::string& groupPath, const std::string& leafLabel) {
+    std::vector<std::string> elements;
+    std::stringstream stream(groupPath);
+    std::string element;
+    while (std::getline(stream, element, '/')) {
+        if (!element.empty()) {
+            elements.push_back(element);
+        }
+    }
+
+    std::string currentPath;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        currentPath += "/" + elements[i];
+        if (H5Lexists(file, currentPath.c_str(), H5P_DEFAULT) > 0) {
+            continue;
+        }
+        hid_t group = H5Gcreate2(file, currentPath.c_str(), H5P_DEFAULT, gcpl, H5P_DEFAULT);
+        if (group < 0) {
+            throw std::runtime_error("HDF5 error: cannot create group " + currentPath);
+        }
+        add_cgns_name_attr(group, elements[i]);
+        add_cgns_label_attr(group, i + 1 == elements.size() ? leafLabel : "DataArray_t");
+        add_flags_attr(group);
+        add_cgns_type_attr(group, "MT");
+        H5Gclose(group);
+    }
+
+    hid_t group = H5Gopen2(file, groupPath.c_str(), H5P_DEFAULT);
+    if (group < 0) {
+        throw std::runtime_error("Failed to open group: " + groupPath);
+    }
+    return group;
+}
+
+/** @brief Write the payload of @p node in @p group, overwriting its dataset when dtype and shape are unchanged. */
+void update_group_payload(hid_t file, hid_t group, const std::string& groupPath, const std::string& storedType,
+                          const Node& node, const io::WriteOptions& options) {
+    const std::string dataPath = groupPath + "/ data";
+    if (node.noData()) {
+        delete_link_if_exists(file, dataPath);
+        add_cgns_type_attr(group, "MT");
+        return;
+    }
+
+    auto array = std::dynamic_pointer_cast<Array>(node.dataPtr());
+    if (!array) {
+        throw std::runtime_error("Expected Array");
+    }
+    const std::string cgnsType = cgnsTypeFromArray(*array);
+    if (dataset_has_layout_of(file, dataPath, storedType, *array, cgnsType)) {
+        hid_t dset = H5Dopen2(file, dataPath.c_str(), H5P_DEFAULT);
+        try {
+            write_array_dataset(dset, *array, options.stagingBytes);
+        } catch (...) {
+            H5Dclose(dset);
+            throw;
+        }
+        H5Dclose(dset);
+    } else {
+        delete_link_if_exists(file, dataPath);
+        write_array(file, dataPath, *array, cgnsType, options);
+    }
+    add_cgns_type_attr(group, cgnsType);
+}
+
+void update_group_from_node(hid_t file, hid_t group, const std::string& groupPath, const Node& node,
+                            const io::WriteOptions& options) {
+    add_cgns_label_attr(group, node.type());
+    const std::string storedType = read_string_attr(group, "type");
+
+    if (node.hasLinkTarget()) {
+        if (group_has_child_nodes(group)) {
+            throw std::runtime_error(
+                "CGNS/HDF5 update: cannot persist link metadata onto node with existing children at path '" +
+                groupPath + "'");
+        }
+        for (const char* reserved : {"/ data", "/ file", "/ path", "/ link"}) {
+            delete_link_if_exists(file, groupPath + reserved);
+        }
+        if (H5Aexists(group, "flags") > 0) {
+            check_status(H5Adelete(group, "flags"), "delete attribute flags");
+        }
+        add_cgns_type_attr(group, "LK");
+        write_link_datasets(file, groupPath, node.linkTargetFile(), node.linkTargetPath());
+        return;
+    }
+
+    for (const char* reserved : {"/ file", "/ path", "/ link"}) {
+        delete_link_if_exists(file, groupPath + reserved);
+    }
+    add_flags_attr(group);
+    update_group_payload(file, group, groupPath, storedType, node, options);
+}
+
+bool is_link_group_at(hid_t file, const std::string& groupPath) {
+    hid_t group = H5Gopen2(file, groupPath.c_str(), H5P_DEFAULT);
+    if (group < 0) {
+        throw std::runtime_error("Failed to open group: " + groupPath);
+    }
+    const bool isLink = is_link_group(group);
+    H5Gclose(group);
+    return isLink;
+}
+
+/** @brief Remove the incremental write records of the file root and of the groups down to @p groupPath. */
+void forget_fingerprints_along(hid_t file, const std::string& groupPath) {
+    delete_fingerprint_attr(file);
+    std::string currentPath;
+    std::stringstream stream(groupPath);
+    std::string element;
+    while (std::getline(stream, element, '/')) {
+        if (element.empty()) {
+            continue;
+        }
+        currentPath += "/" + element;
+        if (H5Lexists(file, currentPath.c_str(), H5P_DEFAULT) <= 0) {
+            return;
+        }
+        hid_t group = H5Gopen2(file, currentPath.c_str(), H5P_DEFAULT);
+        if (group < 0) {
+            return;
+        }
+        delete_fingerprint_attr(group);
+        H5Gclose(group);
+    }
+}
+
+/** @brief Child node groups of @p group, in creation order. */
+std::vector<std::string> child_group_names_in_creation_order(hid_t group) {
+    H5G_info_t info;
+    check_status(H5Gget_info(group, &info), "get group info");
+    std::vector<std::string> names;
+    for (hsize_t i = 0; i < info.nlinks; ++i) {
+        const ssize_t length = H5Lget_name_by_idx(group, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT);
+        if (length < 0) {
+            throw std::runtime_error("HDF5 error: cannot get link name by creation order");
+        }
+        std::string name(static_cast<size_t>(length), '\0');
+        H5Lget_name_by_idx(group, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, i, name.data(), name.size() + 1, H5P_DEFAULT);
+        if (!name.empty() && name.front() != ' ') {
+            names.push_back(std::move(name));
+        }
+    }
+    return names;
+}
+
+/** @brief State shared by a whole incremental write. */
+struct IncrementalWrite {
+    hid_t file = -1;
+    hid_t gcpl = -1;
+    const io::WriteOptions& options;
+    std::string cgnsTreeRootName;
+};
+
+void update_group_incrementally(const IncrementalWrite& write, hid_t group, const std::string& groupPath,
+                                const Node& node, bool isFileRoot);
+
+/**
+ * @brief Bring the children stored in @p group up to date with those of @p node.
+ *
+ * Children stored with the same name are updated in place when their
+ * creation order stays that of @p node; added, renamed and link children are
+ * written after them, and children no longer in @p node are unlinked.
+ * Otherwise every child is written again.
+ */
+void update_children_incrementally(const IncrementalWrite& write, hid_t group, const std::string& groupPath,
+                                   const Node& node, bool isFileRoot) {
+    const std::string childPrefix = groupPath == "/" ? "" : groupPath;
+    std::vector<std::string> storedNames = child_group_names_in_creation_order(group);
+    std::vector<std::shared_ptr<Node>> children;
+    for (const auto& child : node.children()) {
+        if (!(isFileRoot && is_cgns_library_version_node(child))) {
+            children.push_back(child);
+        }
+    }
+    if (isFileRoot) {
+        storedNames.erase(std::remove(storedNames.begin(), storedNames.end(), "CGNSLibraryVersion"), storedNames.end());
+    }
+
+    // children kept in place, in the order of the node, then those written again
+    std::set<std::string> storedSet(storedNames.begin(), storedNames.end());
+    std::vector<std::string> keptNames;
+    std::vector<std::shared_ptr<Node>> kept;
+    std::vector<std::shared_ptr<Node>> written;
+    bool inOrder = true;
+    for (const auto& child : children) {
+        const bool keep = storedSet.count(child->name()) > 0 && !child->hasLinkTarget()
+            && !is_link_group_at(write.file, childPrefix + "/" + child->name());
+        if (keep) {
+            inOrder = inOrder && written.empty();
+            keptNames.push_back(child->name());
+            kept.push_back(child);
+        } else {
+            written.push_back(child);
+        }
+    }
+    std::set<std::string> keptSet(keptNames.begin(), keptNames.end());
+    std::vector<std::string> storedKept;
+    for (const auto& name : storedNames) {
+        if (keptSet.count(name) > 0) {
+            storedKept.push_back(name);
+        }
+    }
+    if (!inOrder || storedKept != keptNames) {
+        kept.clear();
+        keptSet.clear();
+        written = children;
+    }
+
+    for (const auto& name : storedNames) {
+        if (keptSet.count(name) == 0) {
+            delete_link_if_exists(write.file, childPrefix + "/" + name);
+        }
+    }
+    for (const auto& child : kept) {
+        const std::string childPath = childPrefix + "/" + child->name();
+        hid_t childGroup = H5Gopen2(write.file, childPath.c_str(), H5P_DEFAULT);
+        if (childGroup < 0) {
+            throw std::runtime_error("Failed to open group: " + childPath);
+        }
+        try {
+            update_group_incrementally(write, childGroup, childPath, *child, false);
+        } catch (...) {
+            H5Gclose(childGroup);
+            throw;
+        }
+        H5Gclose(childGroup);
+    }
+    for (const auto& child : written) {
+        write_node_rec(write.file, write.gcpl, child, childPrefix, write.options, write.cgnsTreeRootName);
+    }
+}
+
+/**
+ * @brief Bring the group at @p groupPath up to date with the subtree of @p node, skipping it when unchanged.
+ *
+ * The record of the group is removed before anything below it is touched
+ * and written back last, so an interrupted write leaves no record that
+ * would hide a partially updated subtree from the next one.
+ */
+void update_group_incrementally(const IncrementalWrite& write, hid_t group, const std::string& groupPath,
+                                const Node& node, bool isFileRoot) {
+    const std::optional<StoredFingerprint> stored = read_fingerprint_attr(group);
+    if (stored && stored->subtree == node.fingerprint()) {
+        return;
+    }
+    delete_fingerprint_attr(group);
+    if (!stored || stored->node != node_own_fingerprint(node)) {
+        add_cgns_label_attr(group, node.type());
+        update_group_payload(write.file, group, groupPath, read_string_attr(group, "type"), node, write.options);
+    }
+    update_children_incrementally(write, group, groupPath, node, isFileRoot);
+    add_fingerprint_attr(group, node);
+}
+
+/** @brief Overwrite the stored CGNS version, keeping the group where the file has one. */
+void update_cgns_library_version(hid_t file, hid_t gcpl, const float& cgnsVersion) {
+    const char* dataPath = "/CGNSLibraryVersion/ data";
+    if (H5Lexists(file, "/CGNSLibraryVersion", H5P_DEFAULT) <= 0 || H5Lexists(file, dataPath, H5P_DEFAULT) <= 0) {
+        delete_link_if_exists(file, "/CGNSLibraryVersion");
+        write_cgns_library_version(file, gcpl, cgnsVersion);
+        return;
+    }
+    hid_t dset = H5Dopen2(file, dataPath, H5P_DEFAULT);
+    if (dset < 0) {
+        throw std::runtime_error("HDF5 error: cannot open dataset " + std::string(dataPath));
+    }
+    const herr_t status = H5Dwrite(dset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &cgnsVersion);
+    H5Dclose(dset);
+    check_status(status, "write CGNS library version");
+}
+
+/**
+ * @brief Update @p filename in place from @p root when it was written incrementally from the same root.
+ * @return False when the file has to be written in full.
+ */
+bool write_node_incrementally(const std::string& filename, const std::shared_ptr<Node>& root,
+                              const io::WriteOptions& options) {
+    if (!std::filesystem::is_regular_file(filename) || H5Fis_hdf5(filename.c_str()) <= 0) {
+        return false;
+    }
+    hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    if (file < 0) {
+        return false;
+    }
+    // the root itself is only compared: a renamed root moves every link target and group path
+    const bool flattened = is_cgns_tree_root(root);
+    const std::string rootPath = flattened ? "/" : "/" + root->name();
+    const std::optional<StoredFingerprint> fileRecord = read_fingerprint_attr(file);
+    std::optional<StoredFingerprint> rootRecord;
+    if (flattened) {
+        rootRecord = fileRecord;
+    } else if (!fileRecord && H5Lexists(file, rootPath.c_str(), H5P_DEFAULT) > 0) {
+        hid_t group = H5Gopen2(file, rootPath.c_str(), H5P_DEFAULT);
+        if (group >= 0) {
+            rootRecord = read_fingerprint_attr(group);
+            H5Gclose(group);
+        }
+    }
+    if (!rootRecord || rootRecord->node != node_own_fingerprint(*root) || root->hasLinkTarget()) {
+        H5Fclose(file);
+        return false;
+    }
+    if (rootRecord->subtree == root->fingerprint()) {
+        H5Fclose(file);
+        return true;
+    }
+
+    hid_t gcpl = make_cgns_group_creation_plist();
+    hid_t group = -1;
+    try {
+        IncrementalWrite write{file, gcpl, options, flattened ? root->name() : ""};
+        if (flattened) {
+            update_cgns_library_version(file, gcpl, resolved_cgns_version(root, options.cgnsVersion));
+        }
+        group = H5Gopen2(file, rootPath.c_str(), H5P_DEFAULT);
+        if (group < 0) {
+            throw std::runtime_error("Failed to open group: " + rootPath);
+        }
+        update_group_incrementally(write, group, rootPath, *root, flattened);
+    } catch (...) {
+        if (group >= 0) H5Gclose(group);
+        H5Pclose(gcpl);
+        H5Fclose(file);
+        throw;
+    }
+    H5Gclose(group);
+    H5Pclose(gcpl);
+    H5Fclose(file);
+    return true;
+}
+
+#ifdef ENABLE_MPI
+
+/**
+ * @brief Group of a file written by several MPI ranks, as described by one of them.
+ *
+ * The payload shape is in array axis order; string payloads have the shape
+ * ``{length}``. @p owner is the rank writing the payload.
+ */
+struct GroupRecord {
+    std::string path;
+    std::string name;
+    std::string label;
+    std::string cgnsType;
+    std::vector<size_t> shape;
+    std::string linkFile;
+    std::string linkPath;
+    int owner = 0;
+};
+
+void collect_group_records(
+    const std::shared_ptr<Node>& node,
+    const std::string& path,
+    const std::string& cgnsTreeRootName,
+    std::vector<GroupRecord>& records,
+    std::map<std::string, std::shared_ptr<Array>>& payloads) {
+
+    GroupRecord record;
+    record.path = path + "/" + node->name();
+    record.name = node->name();
+    record.label = node->type();
+    record.cgnsType = "MT";
+
+    if (node->hasLinkTarget()) {
+        if (!node->noData()) {
+            throw std::runtime_error("node with link must not carry array data: " + node->path());
+        }
+        if (!node->children().empty()) {
+            throw std::runtime_error("node with link must not have children: " + node->path());
+        }
+        record.cgnsType = "LK";
+        record.linkFile = node->linkTargetFile();
+        record.linkPath = persisted_link_target_path(node, cgnsTreeRootName);
+        records.push_back(std::move(record));
+        return;
+    }
+
+    if (!node->noData()) {
+        auto array = std::dynamic_pointer_cast<Array>(node->dataPtr());
+        if (!array) {
+            throw std::runtime_error("Expected Array");
+        }
+        record.cgnsType = cgnsTypeFromArray(*array);
+        record.shape = record.cgnsType == "C1"
+            ? std::vector<size_t>{array->extractString().size()}
+            : array->shape();
+        payloads[record.path] = array;
+    }
+    const std::string groupPath = record.path;
+    records.push_back(std::move(record));
+
+    for (const auto& child : node->children()) {
+        collect_group_records(child, groupPath, cgnsTreeRootName, records, payloads);
+    }
+}
+
+void pack_size(std::string& buffer, const size_t value) {
+    const uint64_t packed = value;
+    buffer.append(reinterpret_cast<const char*>(&packed), sizeof(packed));
+}
+
+void pack_string(std::string& buffer, const std::string& value) {
+    pack_size(buffer, value.size());
+    buffer += value;
+}
+
+/** @brief Reads back, in order, the values appended by pack_size and pack_string. */
+struct Unpacker {
+    const std::string& buffer;
+    size_t offset = 0;
+
+    size_t size() {
+        uint64_t packed = 0;
+        if (offset + sizeof(packed) > buffer.size()) {
+            throw std::runtime_error("CGNS/HDF5 parallel write: truncated node description");
+        }
+        std::memcpy(&packed, buffer.data() + offset, sizeof(packed));
+        offset += sizeof(packed);
+        return packed;
+    }
+
+    std::string string() {
+        const size_t length = size();
+        if (offset + length > buffer.size()) {
+            throw std::runtime_error("CGNS/HDF5 parallel write: truncated node description");
+        }
+        std::string value = buffer.substr(offset, length);
+        offset += length;
+        return value;
+    }
+};
+
+std::string pack_group_records(const std::vector<GroupRecord>& records) {
+    std::string buffer;
+    pack_size(buffer, records.size());
+    for (const auto& record : records) {
+        pack_string(buffer, record.path);
+        pack_string(buffer, record.name);
+        pack_string(buffer, record.label);
+        pack_string(buffer, record.cgnsType);
+        pack_size(buffer, record.shape.size());
+        for (size_t extent : record.shape) {
+            pack_size(buffer, extent);
+        }
+        pack_string(buffer, record.linkFile);
+        pack_string(buffer, record.linkPath);
+    }
+    return buffer;
+}
+
+std::vector<GroupRecord> unpack_group_records(const std::string& buffer, const int owner) {
+    Unpacker unpacker{buffer};
+    std::vector<GroupRecord> records(unpacker.size());
+    for (auto& record : records) {
+        record.path = unpacker.string();
+        record.name = unpacker.string();
+        record.label = unpacker.string();
+        record.cgnsType = unpacker.string();
+        record.shape.resize(unpacker.size());
+        for (size_t& extent : record.shape) {
+            extent = unpacker.size();
+        }
+        record.linkFile = unpacker.string();
+        record.linkPath = unpacker.string();
+        record.owner = owner;
+    }
+    return records;
+}
+
+/** @brief Gather the string of every rank of @p comm on every rank, in rank order. */
+std::vector<std::string> allgather_strings(const std::string& local, MPI_Comm comm) {
+    int size = 0;
+    MPI_Comm_size(comm, &size);
+    // gather the lengths before checking them, so that every rank raises the same error
+    const std::uint64_t localLength64 = local.size();
+    std::vector<std::uint64_t> lengths64(static_cast<size_t>(size), 0);
+    MPI_Allgather(&localLength64, 1, MPI_UINT64_T, lengths64.data(), 1, MPI_UINT64_T, comm);
+    std::vector<int> lengths(lengths64.size(), 0);
+    for (size_t rank = 0; rank < lengths64.size(); ++rank) {
+        if (lengths64[rank] > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+            throw std::runtime_error("CGNS/HDF5 parallel write: node description of rank "
+                + std::to_string(rank) + " too large");
+        }
+        lengths[rank] = static_cast<int>(lengths64[rank]);
+    }
+    const int localLength = static_cast<int>(local.size());
+
+    std::vector<int> displacements(lengths.size(), 0);
+    size_t total = 0;
+    for (size_t rank = 0; rank < lengths.size(); ++rank) {
+        if (total > static_cast<size_t>(std::numeric_limits<int>::max())) {
+            throw std::runtime_error("CGNS/HDF5 parallel write: node descriptions too large");
+        }
+        displacements[rank] = static_cast<int>(total);
+        total += static_cast<size_t>(lengths[rank]);
+    }
+    std::string gathered(total, '\0');
+    MPI_Allgatherv(local.data(), localLength, MPI_CHAR,
+                   gathered.data(), lengths.data(), displacements.data(), MPI_CHAR, comm);
+
+    std::vector<std::string> strings;
+    strings.reserve(lengths.size());
+    for (size_t rank = 0; rank < lengths.size(); ++rank) {
+        strings.push_back(gathered.substr(static_cast<size_t>(displacements[rank]),
+                                          static_cast<size_t>(lengths[rank])));
+    }
+    return strings;
+}
+
+/**
+ * @brief Union of the groups described by all ranks, in rank then depth-first order.
+ *
+ * A group described by several ranks must have the same label and link; its
+ * payload, if any, is written by the first rank holding one, and must have
+ * the same type and shape on every rank holding one.
+ */
+std::vector<GroupRecord> merge_group_records(const std::vector<std::vector<GroupRecord>>& recordsByRank) {
+    std::vector<GroupRecord> merged;
+    std::map<std::string, size_t> indexByPath;
+    for (const auto& records : recordsByRank) {
+        for (const auto& record : records) {
+            auto found = indexByPath.find(record.path);
+            if (found == indexByPath.end()) {
+                indexByPath.emplace(record.path, merged.size());
+                merged.push_back(record);
+                continue;
+            }
+            GroupRecord& existing = merged[found->second];
+            const bool existingIsLink = existing.cgnsType == "LK";
+            const bool recordIsLink = record.cgnsType == "LK";
+            const bool bothHavePayload = existing.cgnsType != "MT" && record.cgnsType != "MT";
+            if (existing.label != record.label || existingIsLink != recordIsLink
+                || (existingIsLink && (existing.linkFile != record.linkFile || existing.linkPath != record.linkPath))
+                || (bothHavePayload && (existing.cgnsType != record.cgnsType || existing.shape != record.shape))) {
+                throw std::runtime_error(
+                    "CGNS/HDF5 parallel write: ranks " + std::to_string(existing.owner) + " and " +
+                    std::to_string(record.owner) + " describe node '" + record.path + "' differently");
+            }
+            if (existing.cgnsType == "MT" && record.cgnsType != "MT") {
+                existing.cgnsType = record.cgnsType;
+                existing.shape = record.shape;
+                existing.owner = record.owner;
+            }
+        }
+    }
+    return merged;
+}
+
+/** @brief Create the groups, attributes, links and empty payload datasets of @p records. */
+void create_group_records(
+    hid_t file,
+    hid_t gcpl,
+    const std::vector<GroupRecord>& records,
+    const io::WriteOptions& options) {
+
+    for (const auto& record : records) {
+        hid_t group = H5Gcreate2(file, record.path.c_str(), H5P_DEFAULT, gcpl, H5P_DEFAULT);
+        if (group < 0) {
+            throw std::runtime_error("HDF5 error: cannot create group " + record.path);
+        }
+        add_cgns_name_attr(group, record.name);
+        add_cgns_label_attr(group, record.label);
+
+        if (record.cgnsType == "LK") {
+            add_cgns_type_attr(group, "LK");
+            write_link_datasets(file, record.path, record.linkFile, record.linkPath);
+            H5Gclose(group);
+            continue;
+        }
+
+        add_flags_attr(group);
+        if (record.cgnsType != "MT") {
+            const std::string dataPath = record.path + "/ data";
+            hid_t space = -1;
+            hid_t dcpl = H5P_DEFAULT;
+            hid_t dtype = H5T_NATIVE_INT8;
+            if (record.cgnsType == "C1") {
+                const hsize_t length = static_cast<hsize_t>(record.shape.at(0));
+                space = H5Screate_simple(1, &length, nullptr);
+            } else {
+                std::vector<size_t> diskShape = record.shape;
+                std::reverse(diskShape.begin(), diskShape.end());
+                space = make_dataspace(diskShape);
+                dtype = hdfTypeFromCgnsType(record.cgnsType);
+                dcpl = make_dataset_creation_plist(record.shape, H5Tget_size(dtype), options);
+            }
+            hid_t dset = H5Dcreate2(file, dataPath.c_str(), dtype, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+            if (dcpl != H5P_DEFAULT) {
+                H5Pclose(dcpl);
+            }
+            H5Sclose(space);
+            if (dset < 0) {
+                H5Gclose(group);
+                throw std::runtime_error("HDF5 error: cannot create dataset " + dataPath);
+            }
+            H5Dclose(dset);
+        }
+        add_cgns_type_attr(group, record.cgnsType);
+        H5Gclose(group);
+    }
+}
+
+/**
+ * @brief Write into the datasets created by create_group_records the payloads owned by @p rank.
+ *
+ * With @p collective, every rank takes part in the write of every payload,
+ * non-owners and owners of empty payloads with an empty selection, and owners
+ * write their payload in a single call. Independent writes stage at most
+ * @p stagingBytes bytes at a time.
+ */
+void write_owned_payloads(
+    hid_t file,
+    const std::vector<GroupRecord>& records,
+    const std::map<std::string, std::shared_ptr<Array>>& payloads,
+    const int rank,
+    hid_t dxpl,
+    const bool collective,
+    const size_t stagingBytes) {
+
+    for (const auto& record : records) {
+        if (record.cgnsType == "MT" || record.cgnsType == "LK" || (record.owner != rank && !collective)) {
+            continue;
+        }
+        const std::string dataPath = record.path + "/ data";
+        hid_t dset = H5Dopen2(file, dataPath.c_str(), H5P_DEFAULT);
+        if (dset < 0) {
+            throw std::runtime_error("HDF5 error: cannot open dataset " + dataPath);
+        }
+        try {
+            if (record.owner == rank && record.cgnsType == "C1") {
+                const std::string str = payloads.at(record.path)->extractString();
+                std::vector<int8_t> buffer(str.begin(), str.end());
+                check_status(H5Dwrite(dset, H5T_NATIVE_INT8, H5S_ALL, H5S_ALL, dxpl, buffer.data()),
+                             "write string " + dataPath);
+            } else if (record.owner == rank && payloads.at(record.path)->size() > 0) {
+                // a collective transfer takes one call per rank: stage the whole payload
+                write_array_dataset(dset, *payloads.at(record.path),
+                                    collective ? std::numeric_limits<size_t>::max() : stagingBytes,
+                                    DiskSlab(), dxpl);
+            } else {
+                hid_t fileSpace = H5Dget_space(dset);
+                H5Sselect_none(fileSpace);
+                hid_t memSpace = H5Scopy(fileSpace);
+                const hid_t dtype = record.cgnsType == "C1" ? H5T_NATIVE_INT8 : hdfTypeFromCgnsType(record.cgnsType);
+                int8_t unused = 0;
+                const herr_t status = H5Dwrite(dset, dtype, memSpace, fileSpace, dxpl, &unused);
+                H5Sclose(memSpace);
+                H5Sclose(fileSpace);
+                check_status(status, "join collective write of " + dataPath);
+            }
+        } catch (...) {
+            H5Dclose(dset);
+            throw;
+        }
+        H5Dclose(dset);
+    }
+}
+
+/**
+ * @brief Run @p action on every rank of @p comm and raise on all of them if it failed on any.
+ */
+template <typename Action>
+void run_on_all_ranks(MPI_Comm comm, const std::string& context, Action&& action) {
+    std::exception_ptr error;
+    try {
+        action();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    int localFailure = error ? 1 : 0;
+    int anyFailure = 0;
+    MPI_Allreduce(&localFailure, &anyFailure, 1, MPI_INT, MPI_MAX, comm);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    if (anyFailure) {
+        throw std::runtime_error(context + ": failed on another rank");
+    }
+}
+
+#ifdef H5_HAVE_PARALLEL
+
+void write_group_records_collectively(
+    const std::string& filename,
+    MPI_Comm comm,
+    const std::vector<GroupRecord>& records,
+    const std::map<std::string, std::shared_ptr<Array>>& payloads,
+    const float cgnsVersion,
+    const io::WriteOptions& options) {
+
+    int rank = 0;
+    MPI_Comm_rank(comm, &rank);
+    const std::string context = "CGNS/HDF5 parallel write of " + filename;
+
+    hid_t file = -1;
+    run_on_all_ranks(comm, context, [&]() {
+        hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+        try {
+            check_status(H5Pset_fapl_mpio(fapl, comm, MPI_INFO_NULL), "set MPI-IO file driver");
+#if H5_VERSION_GE(1, 10, 0)
+            check_status(H5Pset_all_coll_metadata_ops(fapl, true), "set collective metadata reads");
+            check_status(H5Pset_coll_metadata_write(fapl, true), "set collective metadata writes");
+#endif
+        } catch (...) {
+            H5Pclose(fapl);
+            throw;
+        }
+        hid_t fcpl = make_cgns_file_creation_plist();
+        file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, fcpl, fapl);
+        H5Pclose(fcpl);
+        H5Pclose(fapl);
+        if (file < 0) {
+            throw std::runtime_error("HDF5 error: cannot create file " + filename);
+        }
+    });
+
+    try {
+        // group, attribute and dataset creations are collective: every rank creates all of them
+        run_on_all_ranks(comm, context, [&]() {
+            hid_t gcpl = make_cgns_group_creation_plist();
+            try {
+                write_cgns_file_metadata(file);
+                write_cgns_library_version(file, gcpl, cgnsVersion);
+                create_group_records(file, gcpl, records, options);
+            } catch (...) {
+                H5Pclose(gcpl);
+                throw;
+            }
+            H5Pclose(gcpl);
+        });
+
+        run_on_all_ranks(comm, context, [&]() {
+            hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+            try {
+                check_status(
+                    H5Pset_dxpl_mpio(dxpl, options.collectiveTransfers ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT),
+                    "set MPI-IO transfer mode");
+                write_owned_payloads(file, records, payloads, rank, dxpl, options.collectiveTransfers,
+                                     options.stagingBytes);
+            } catch (...) {
+                H5Pclose(dxpl);
+                throw;
+            }
+            H5Pclose(dxpl);
+        });
+    } catch (...) {
+        H5Fclose(file);
+        throw;
+    }
+    H5Fclose(file);
+}
+
+#else
+
+/**
+ * @brief Write @p records without parallel HDF5: rank 0 creates the file, then
+ * each rank writes its payloads in turn.
+ */
+void write_group_records_in_turns(
+    const std::string& filename,
+    MPI_Comm comm,
+    const std::vector<GroupRecord>& records,
+    const std::map<std::string, std::shared_ptr<Array>>& payloads,
+    const float cgnsVersion,
+    const io::WriteOptions& options) {
+
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    const std::string context = "CGNS/HDF5 parallel write of " + filename;
+
+    run_on_all_ranks(comm, context, [&]() {
+        if (rank != 0) {
+            return;
+        }
+        hid_t fcpl = make_cgns_file_creation_plist();
+        hid_t file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, fcpl, H5P_DEFAULT);
+        H5Pclose(fcpl);
+        if (file < 0) {
+            throw std::runtime_error("HDF5 error: cannot create file " + filename);
+        }
+        hid_t gcpl = make_cgns_group_creation_plist();
+        try {
+            write_cgns_file_metadata(file);
+            write_cgns_library_version(file, gcpl, cgnsVersion);
+            create_group_records(file, gcpl, records, options);
+        } catch (...) {
+            H5Pclose(gcpl);
+            H5Fclose(file);
+            throw;
+        }
+        H5Pclose(gcpl);
+        H5Fclose(file);
+    });
+
+    for (int turn = 0; turn < size; ++turn) {
+        run_on_all_ranks(comm, context, [&]() {
+            if (rank != turn) {
+                return;
+            }
+            hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+            if (file < 0) {
+                throw std::runtime_error("HDF5 error: cannot open file for writing " + filename);
+            }
+            try {
+                write_owned_payloads(file, records, payloads, rank, H5P_DEFAULT, false, options.stagingBytes);
+            } catch (...) {
+                H5Fclose(file);
+                throw;
+            }
+            H5Fclose(file);
+        });
+    }
+}
+
+#endif // H5_HAVE_PARALLEL
+
+/**
+ * @brief Paths, as ``{base, zone}``, of the Zone_t nodes of @p file in read order.
+ */
+std::vector<std::vector<std::string>> zone_paths(hid_t file) {
+    std::vector<std::vector<std::string>> paths;
+    const auto childGroupNames = [](hid_t group) {
+        std::vector<std::string> names;
+        hsize_t nObjs = 0;
+        H5Gget_num_objs(group, &nObjs);
+        for (hsize_t i = 0; i < nObjs; ++i) {
+            if (H5Gget_objtype_by_idx(group, i) != H5G_GROUP) {
+                continue;
+            }
+            char nameBuf[256];
+            H5Gget_objname_by_idx(group, i, nameBuf, sizeof(nameBuf));
+            if (!is_reserved_child_name(nameBuf)) {
+                names.emplace_back(nameBuf);
+            }
+        }
+        return names;
+    };
+
+    for (const auto& baseName : childGroupNames(file)) {
+        hid_t base = H5Gopen2(file, baseName.c_str(), H5P_DEFAULT);
+        if (base < 0) {
+            throw std::runtime_error("Failed to open group: /" + baseName);
+        }
+        for (const auto& zoneName : childGroupNames(base)) {
+            hid_t zone = H5Gopen2(base, zoneName.c_str(), H5P_DEFAULT);
+            if (zone < 0) {
+                H5Gclose(base);
+                throw std::runtime_error("Failed to open group: /" + baseName + "/" + zoneName);
+            }
+            if (read_string_attr(zone, "label") == "Zone_t") {
+                paths.push_back({baseName, zoneName});
+            }
+            H5Gclose(zone);
+        }
+        H5Gclose(base);
+    }
+    return paths;
+}
+
+#endif // ENABLE_MPI
+
 } // namespace
 
 void write_node(const std::string& filename, std::shared_ptr<Node> root, const float& cgnsVersion) {
+    io::WriteOptions options;
+    options.cgnsVersion = cgnsVersion;
+    write_node(filename, std::move(root), options);
+}
+
+void write_node(const std::string& filename, std::shared_ptr<Node> root, const io::WriteOptions& options) {
+    check_write_options(options);
+    if (options.incremental) {
+        // the records of the file must not come from payload hashes out of date
+        root->refreshFingerprint();
+        if (write_node_incrementally(filename, root, options)) {
+            return;
+        }
+    }
     hid_t fcpl = make_cgns_file_creation_plist();
     hid_t file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, fcpl, H5P_DEFAULT);
     H5Pclose(fcpl);
     hid_t gcpl = make_cgns_group_creation_plist();
     write_cgns_file_metadata(file);
-    write_cgns_library_version(file, gcpl, resolved_cgns_version(root, cgnsVersion));
+    write_cgns_library_version(file, gcpl, resolved_cgns_version(root, options.cgnsVersion));
     if (is_cgns_tree_root(root)) {
         for (const auto& child : root->children()) {
             if (is_cgns_library_version_node(child)) {
                 continue;
             }
-            write_node_rec(file, gcpl, child, "", root->name());
+            write_node_rec(file, gcpl, child, "", options, root->name());
+        }
+        if (options.incremental) {
+            add_fingerprint_attr(file, *root);
         }
     } else {
-        write_node_rec(file, gcpl, root, "");
+        write_node_rec(file, gcpl, root, "", options);
     }
     H5Pclose(gcpl);
     H5Fclose(file);
 }
 
 std::shared_ptr<Node> read(const std::string& filename, const char order) {
+    io::ReadOptions options;
+    options.order = order;
+    return read(filename, options);
+}
+
+std::shared_ptr<Node> read(const std::string& filename, const io::ReadOptions& options) {
+    return read_file(open_shared_file(filename), options, {});
+}
+
+
+std::shared_ptr<Node> read_node(const std::string& filename, const std::string& nodePath, const char order) {
     hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
-    auto root = read_node_rec(file, "/", order);
+    if (file < 0) {
+        throw std::runtime_error("HDF5 error: cannot open file " + filename);
+    }
+    try {
+        const std::string groupPath = hdf5_group_path(nodePath);
+        if (H5Lexists(file, groupPath.c_str(), H5P_DEFAULT) <= 0 && groupPath != "/") {
+            throw std::runtime_error("CGNS/HDF5 read: node '" + nodePath + "' was not found in '" + filename + "'");
+        }
+
+        ReadContext context;
+        context.file = file;
+        context.order = order;
+        std::vector<std::string> pathElements;
+        std::stringstream stream(groupPath);
+        std::string element;
+        while (std::getline(stream, element, '/')) {
+            if (!element.empty()) {
+                pathElements.push_back(element);
+            }
+        }
+        context.maxDepth = pathElements.size();
+        auto node = read_node_rec(context, groupPath, pathElements, true);
+        H5Fclose(file);
+        return node;
+    } catch (...) {
+        H5Fclose(file);
+        throw;
+    }
+}
+
+void update_node(const std::string& filename, const std::string& nodePath, const Node& node,
+                 const io::WriteOptions& options) {
+    check_write_options(options);
+    hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    if (file < 0) {
+        throw std::runtime_error("HDF5 error: cannot open file for writing " + filename);
+    }
+    hid_t gcpl = -1;
+    hid_t group = -1;
+    try {
+        const std::string groupPath = hdf5_group_path(nodePath);
+        if (groupPath == "/") {
+            throw std::invalid_argument("CGNS/HDF5 update: cannot update the file root node");
+        }
+        gcpl = make_cgns_group_creation_plist();
+        forget_fingerprints_along(file, groupPath);
+        group = open_or_create_group_path(file, gcpl, groupPath, node.type());
+        update_group_from_node(file, group, groupPath, node, options);
+    } catch (...) {
+        if (group >= 0) H5Gclose(group);
+        if (gcpl >= 0) H5Pclose(gcpl);
+        H5Fclose(file);
+        throw;
+    }
+    H5Gclose(group);
+    H5Pclose(gcpl);
     H5Fclose(file);
-    return root;
 }
 
+Array read_data_slab(const std::string& filename, const std::string& nodePath,
+                     const io::Hyperslab& slab, const char order) {
+    hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (file < 0) {
+        throw std::runtime_error("HDF5 error: cannot open file " + filename);
+    }
+    try {
+        const std::string groupPath = hdf5_group_path(nodePath);
+        const std::string cgnsType = payload_cgns_type(file, groupPath);
+        Array array = read_dataset_slab(file, groupPath + "/ data", cgnsType, slab, order);
+        H5Fclose(file);
+        return array;
+    } catch (...) {
+        H5Fclose(file);
+        throw;
+    }
+}
+
+void write_data_slab(const std::string& filename, const std::string& nodePath,
+                     const Array& values, const io::Hyperslab& slab) {
+    io::Hyperslab selected = slab;
+    if (selected.count.empty()) {
+        selected.count = values.shape();
+    } else if (selected.count != values.shape()) {
+        throw std::invalid_argument("CGNS/HDF5 slab: count does not match the shape of the written values");
+    }
+    if (values.hasString()) {
+        throw std::invalid_argument("CGNS/HDF5 slab: string payloads cannot be written partially");
+    }
+
+    hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    if (file < 0) {
+        throw std::runtime_error("HDF5 error: cannot open file for writing " + filename);
+    }
+    hid_t dset = -1;
+    try {
+        const std::string groupPath = hdf5_group_path(nodePath);
+        payload_cgns_type(file, groupPath);
+        forget_fingerprints_along(file, groupPath);
+        const std::string dataPath = groupPath + "/ data";
+        dset = H5Dopen2(file, dataPath.c_str(), H5P_DEFAULT);
+        if (dset < 0) {
+            throw std::runtime_error("HDF5 error: cannot open dataset " + dataPath);
+        }
+        SlabSelection selection(dset, selected);
+        write_array_dataset(dset, values, io::WriteOptions().stagingBytes, selection.target);
+    } catch (...) {
+        if (dset >= 0) H5Dclose(dset);
+        H5Fclose(file);
+        throw;
+    }
+    H5Dclose(dset);
+    H5Fclose(file);
+}
+
+#ifdef ENABLE_MPI
+
+void write_node_parallel(
+    const std::string& filename,
+    std::shared_ptr<Node> root,
+    MPI_Comm comm,
+    const io::WriteOptions& options) {
+
+    check_write_options(options);
+    const bool useFilters = options.deflateLevel > 0 || options.shuffle;
+    if (useFilters && !options.collectiveTransfers) {
+        throw std::invalid_argument("CGNS/HDF5 parallel write: compression filters require collective transfers");
+    }
+
+    std::vector<GroupRecord> localRecords;
+    std::map<std::string, std::shared_ptr<Array>> payloads;
+    run_on_all_ranks(comm, "CGNS/HDF5 parallel write of " + filename, [&]() {
+        if (is_cgns_tree_root(root)) {
+            for (const auto& child : root->children()) {
+                if (!is_cgns_library_version_node(child)) {
+                    collect_group_records(child, "", root->name(), localRecords, payloads);
+                }
+            }
+        } else {
+            collect_group_records(root, "", "", localRecords, payloads);
+        }
+    });
+
+    const std::vector<std::string> packed = allgather_strings(pack_group_records(localRecords), comm);
+    std::vector<std::vector<GroupRecord>> recordsByRank;
+    for (size_t rank = 0; rank < packed.size(); ++rank) {
+        recordsByRank.push_back(unpack_group_records(packed[rank], static_cast<int>(rank)));
+    }
+    // every rank merges the same descriptions, so a mismatch raises on all of them
+    const std::vector<GroupRecord> records = merge_group_records(recordsByRank);
+
+    float cgnsVersion = resolved_cgns_version(root, options.cgnsVersion);
+    MPI_Bcast(&cgnsVersion, 1, MPI_FLOAT, 0, comm);
+
+#ifdef H5_HAVE_PARALLEL
+    write_group_records_collectively(filename, comm, records, payloads, cgnsVersion, options);
+#else
+    write_group_records_in_turns(filename, comm, records, payloads, cgnsVersion, options);
+#endif
+}
+
+std::shared_ptr<Node> read_parallel(
+    const std::string& filename,
+    MPI_Comm comm,
+    const io::ReadOptions& options) {
+
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // ranks read disjoint parts of the file on their own: no collective call is needed
+    auto sharedFile = open_shared_file(filename);
+    const auto zones = zone_paths(*sharedFile);
+    std::set<std::vector<std::string>> skippedPaths;
+    for (size_t index = 0; index < zones.size(); ++index) {
+        const size_t owner = index * static_cast<size_t>(size) / zones.size();
+        if (owner != static_cast<size_t>(rank)) {
+            skippedPaths.insert(zones[index]);
+        }
+    }
+    return read_file(sharedFile, options, std::move(skippedPaths));
+}
+
+#endif // ENABLE_MPI
+
 } // namespace io::hdf5::cgns
 
 #endif // ENABLE_HDF5_IO
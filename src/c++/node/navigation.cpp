@@ -1,334 +1,79 @@
 #include "node/navigation.hpp"
 #include "node/node.hpp"
+#include "node/query.hpp"
 
-namespace {
-
-std::string globToRegexPattern(const std::string& globPattern) {
-    std::string regexPattern;
-    regexPattern.reserve(globPattern.size() * 2 + 2);
-    regexPattern += "^";
-
-    for (char c : globPattern) {
-        switch (c) {
-            case '*':
-                regexPattern += ".*";
-                break;
-            case '?':
-                regexPattern += ".";
-                break;
-            case '.':
-            case '^':
-            case '$':
-            case '+':
-            case '(':
-            case ')':
-            case '{':
-            case '}':
-            case '[':
-            case ']':
-            case '|':
-            case '\\':
-                regexPattern += "\\";
-                regexPattern += c;
-                break;
-            default:
-                regexPattern += c;
-                break;
-        }
-    }
-
-    regexPattern += "$";
-    return regexPattern;
-}
-
-} // namespace
+using Match = NodeQuery::Match;
 
 Navigation::Navigation(Node& inputNode) : _node(inputNode) {}
 
 std::shared_ptr<Node> Navigation::childByName(const std::string& name) {
-
-    for (auto child: _node.children()) {
-        if (child && name == child->name()) return child;
-    }
-    return nullptr;
+    return _node.childByName(name);
 }
 
 
 std::shared_ptr<Node> Navigation::byName(const std::string& name, const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    for (auto child: _node.children()) {
-        if (child && child->name() == name) {
-            return child;
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byName(name, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return NodeQuery().name(name).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByName(const std::string& name, const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    for (auto child: _node.children()) {
-        if (child && child->name() == name) {
-            matches.push_back(child);
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByName(name, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().name(name).all(_node, depth);
 }
 
 std::shared_ptr<Node> Navigation::byNameRegex(const std::string& namePattern, const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    std::regex regexPattern(namePattern);
-    for (auto child: _node.children()) {
-        if (child && std::regex_search(child->name(), regexPattern)) {
-            return child;
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byNameRegex(namePattern, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return NodeQuery().name(namePattern, Match::Regex).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByNameRegex(
     const std::string& namePattern,
     const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    std::regex regexPattern(namePattern);
-    for (auto child: _node.children()) {
-        if (child && std::regex_search(child->name(), regexPattern)) {
-            matches.push_back(child);
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByNameRegex(namePattern, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().name(namePattern, Match::Regex).all(_node, depth);
 }
 
 std::shared_ptr<Node> Navigation::byNameGlob(const std::string& namePattern, const size_t& depth) {
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    const std::regex regexPattern(globToRegexPattern(namePattern));
-    for (auto child: _node.children()) {
-        if (child && std::regex_match(child->name(), regexPattern)) {
-            return child;
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byNameGlob(namePattern, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return NodeQuery().name(namePattern, Match::Glob).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByNameGlob(
     const std::string& namePattern,
     const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    const std::regex regexPattern(globToRegexPattern(namePattern));
-    for (auto child: _node.children()) {
-        if (child && std::regex_match(child->name(), regexPattern)) {
-            matches.push_back(child);
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByNameGlob(namePattern, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().name(namePattern, Match::Glob).all(_node, depth);
 }
 
 
 std::shared_ptr<Node> Navigation::childByType(const std::string& type) {
-
-    for (auto child: _node.children()) {
-        if (child && type == child->type()) return child;
-    }
-    return nullptr;
+    return NodeQuery().type(type).first(_node, 1);
 }
 
-
 std::shared_ptr<Node> Navigation::byType(const std::string& type, const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    for (auto child: _node.children()) {
-        if (child && child->type() == type) {
-            return child;
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byType(type, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return NodeQuery().type(type).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByType(const std::string& type, const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    for (auto child: _node.children()) {
-        if (child && child->type() == type) {
-            matches.push_back(child);
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByType(type, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().type(type).all(_node, depth);
 }
 
-
-std::shared_ptr<Node> Navigation::byTypeRegex(const std::string& typePattern,
-                                                const size_t& depth) {
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    std::regex regexPattern(typePattern);
-    for (auto child: _node.children()) {
-        if (child && std::regex_search(child->type(), regexPattern)) {
-            return child;
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byTypeRegex(typePattern, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+std::shared_ptr<Node> Navigation::byTypeRegex(const std::string& typePattern, const size_t& depth) {
+    return NodeQuery().type(typePattern, Match::Regex).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByTypeRegex(
     const std::string& typePattern,
     const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    std::regex regexPattern(typePattern);
-    for (auto child: _node.children()) {
-        if (child && std::regex_search(child->type(), regexPattern)) {
-            matches.push_back(child);
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByTypeRegex(typePattern, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().type(typePattern, Match::Regex).all(_node, depth);
 }
 
-std::shared_ptr<Node> Navigation::byTypeGlob(const std::string& typePattern,
-                                             const size_t& depth) {
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    const std::regex regexPattern(globToRegexPattern(typePattern));
-    for (auto child: _node.children()) {
-        if (child && std::regex_match(child->type(), regexPattern)) {
-            return child;
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byTypeGlob(typePattern, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+std::shared_ptr<Node> Navigation::byTypeGlob(const std::string& typePattern, const size_t& depth) {
+    return NodeQuery().type(typePattern, Match::Glob).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByTypeGlob(
     const std::string& typePattern,
     const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    const std::regex regexPattern(globToRegexPattern(typePattern));
-    for (auto child: _node.children()) {
-        if (child && std::regex_match(child->type(), regexPattern)) {
-            matches.push_back(child);
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByTypeGlob(typePattern, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().type(typePattern, Match::Glob).all(_node, depth);
 }
 
 std::shared_ptr<Node> Navigation::childByData(const std::string& data) {
-
-    for (auto child: _node.children()) {
-        if (child) {
-
-            bool isDataString = child->data().hasString();
-            
-            if (isDataString) {
-                std::string dataAsString = child->data().extractString();
-
-                if (data == dataAsString) return child;
-            }
-        }
-    }
-    return nullptr;
+    return NodeQuery().data(data).first(_node, 1);
 }
 
 std::shared_ptr<Node> Navigation::childByData(const char* data) {
@@ -338,109 +83,25 @@ std::shared_ptr<Node> Navigation::childByData(const char* data) {
 
 template <typename T>
 std::shared_ptr<Node> Navigation::childByData(const T& data) {
-
-    for (auto child: _node.children()) {
-        if (child) {
-
-            bool isScalar = child->data().isScalar();
-            
-            if (isScalar) {
-                if (child->data() == data) return child;
-            }
-        }
-    }
-    return nullptr;
+    return NodeQuery().scalar(data).first(_node, 1);
 }
 
 std::shared_ptr<Node> Navigation::byData(const std::string& data, const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    for (auto child: _node.children()) {
-        if (child && child->data().hasString()) {
-            if (child->data().extractString() == data) {
-                return child;
-            }
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byData(data, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return NodeQuery().data(data).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByData(const std::string& data, const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    for (auto child: _node.children()) {
-        if (child && child->data().hasString()) {
-            if (child->data().extractString() == data) {
-                matches.push_back(child);
-            }
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByData(data, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().data(data).all(_node, depth);
 }
 
 std::shared_ptr<Node> Navigation::byDataGlob(const std::string& dataPattern, const size_t& depth) {
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    const std::regex regexPattern(globToRegexPattern(dataPattern));
-    for (auto child: _node.children()) {
-        if (child && child->data().hasString()) {
-            const std::string dataAsString = child->data().extractString();
-            if (std::regex_match(dataAsString, regexPattern)) {
-                return child;
-            }
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byDataGlob(dataPattern, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return NodeQuery().data(dataPattern, Match::Glob).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByDataGlob(
     const std::string& dataPattern,
     const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    const std::regex regexPattern(globToRegexPattern(dataPattern));
-    for (auto child: _node.children()) {
-        if (child && child->data().hasString()) {
-            const std::string dataAsString = child->data().extractString();
-            if (std::regex_match(dataAsString, regexPattern)) {
-                matches.push_back(child);
-            }
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByDataGlob(dataPattern, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return NodeQuery().data(dataPattern, Match::Glob).all(_node, depth);
 }
 
 std::shared_ptr<Node> Navigation::byData(const char* data, const size_t& depth) {
@@ -455,88 +116,49 @@ std::vector<std::shared_ptr<Node>> Navigation::allByData(const char* data, const
 
 template <typename T>
 std::shared_ptr<Node> Navigation::byData(const T& data, const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    for (auto child: _node.children()) {
-        if (child && child->data().isScalar()) {
-            if (child->data() == data) {
-                return child;
-            }
-        }
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byData(data, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return NodeQuery().scalar(data).first(_node, depth);
 }
 
 template <typename T>
 std::vector<std::shared_ptr<Node>> Navigation::allByData(const T& data, const size_t& depth) {
-    std::vector<std::shared_ptr<Node>> matches;
+    return NodeQuery().scalar(data).all(_node, depth);
+}
 
-    if ( depth == 0 ) {
-        return matches;
-    }
+std::shared_ptr<Node> Navigation::byValue(const ValuePredicate& predicate, const size_t& depth) {
+    return NodeQuery().value(predicate).first(_node, depth);
+}
+
+std::vector<std::shared_ptr<Node>> Navigation::allByValue(const ValuePredicate& predicate, const size_t& depth) {
+    return NodeQuery().value(predicate).all(_node, depth);
+}
 
-    for (auto child: _node.children()) {
-        if (child && child->data().isScalar()) {
-            if (child->data() == data) {
-                matches.push_back(child);
-            }
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByData(data, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
+namespace {
+
+/**
+ * Query used by byAnd/allByAnd and their glob variants: empty name, type or
+ * string data patterns put no constraint on the node.
+ */
+template <typename T>
+NodeQuery andQuery(const std::string& name, const std::string& type, const T& data, Match match) {
+    NodeQuery query;
+    if (!name.empty()) query.name(name, match);
+    if (!type.empty()) query.type(type, match);
+    if constexpr (std::is_same_v<T, std::string>) {
+        if (!data.empty()) query.data(data, match);
+    } else {
+        query.scalar(data);
     }
-    return matches;
+    return query;
 }
 
+} // namespace
+
 std::shared_ptr<Node> Navigation::byAnd(
     const std::string& name,
     const std::string& type,
     const std::string& data,
     const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    for (auto child: _node.children()) {
-
-        bool matchName(false);
-        bool matchType(false);
-        bool matchData(false);
-
-        if (child && (name.empty() || child->name() == name)) {
-            matchName = true;
-            
-            if ( type.empty() || child->type() == type ) {
-                matchType = true;
-
-                if ( data.empty() ) {
-                    matchData = true;
-                } else if (child->data().hasString()) {
-                    std::string data_str = child->data().extractString();
-                    matchData = data_str == data;
-                }
-            }
-        }
-
-        if ( matchName && matchType && matchData ) return child;
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byAnd(name, type, data, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return andQuery(name, type, data, Match::Exact).first(_node, depth);
 }
 
 std::shared_ptr<Node> Navigation::byAnd(
@@ -556,37 +178,7 @@ std::shared_ptr<Node> Navigation::byAnd(
     const std::string& type,
     const T& data,
     const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    for (auto child: _node.children()) {
-
-        bool matchName(false);
-        bool matchType(false);
-        bool matchData(false);
-
-        if (child && (name.empty() || child->name() == name)) {
-            matchName = true;
-            
-            if ( type.empty() || child->type() == type ) {
-                matchType = true;
-
-                if ( child->data().isScalar() && child->data() == data ) {
-                    matchData = true;
-                }
-            }
-        }
-
-        if ( matchName && matchType && matchData ) return child;
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byAnd(name, type, data, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return andQuery(name, type, data, Match::Exact).first(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByAnd(
@@ -613,44 +205,7 @@ std::shared_ptr<Node> Navigation::byAndGlob(
     const std::string& type,
     const std::string& data,
     const size_t& depth) {
-
-    if ( depth == 0 ) {
-        return nullptr;
-    }
-
-    const std::regex namePattern(globToRegexPattern(name));
-    const std::regex typePattern(globToRegexPattern(type));
-    const std::regex dataPattern(globToRegexPattern(data));
-
-    for (auto child: _node.children()) {
-
-        bool matchName(false);
-        bool matchType(false);
-        bool matchData(false);
-
-        if (child && (name.empty() || std::regex_match(child->name(), namePattern))) {
-            matchName = true;
-
-            if (type.empty() || std::regex_match(child->type(), typePattern)) {
-                matchType = true;
-
-                if (data.empty()) {
-                    matchData = true;
-                } else if (child->data().hasString()) {
-                    const std::string dataString = child->data().extractString();
-                    matchData = std::regex_match(dataString, dataPattern);
-                }
-            }
-        }
-
-        if (matchName && matchType && matchData) return child;
-
-        if (child && depth > 1) {
-            auto foundNode = child->pick().byAndGlob(name, type, data, depth-1);
-            if (foundNode) return foundNode;
-        }
-    }
-    return nullptr;
+    return andQuery(name, type, data, Match::Glob).first(_node, depth);
 }
 
 std::shared_ptr<Node> Navigation::byAndGlob(
@@ -670,48 +225,7 @@ std::vector<std::shared_ptr<Node>> Navigation::allByAndGlob(
     const std::string& type,
     const std::string& data,
     const size_t& depth) {
-
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
-
-    const std::regex namePattern(globToRegexPattern(name));
-    const std::regex typePattern(globToRegexPattern(type));
-    const std::regex dataPattern(globToRegexPattern(data));
-
-    for (auto child: _node.children()) {
-
-        bool matchName(false);
-        bool matchType(false);
-        bool matchData(false);
-
-        if (child && (name.empty() || std::regex_match(child->name(), namePattern))) {
-            matchName = true;
-
-            if (type.empty() || std::regex_match(child->type(), typePattern)) {
-                matchType = true;
-
-                if (data.empty()) {
-                    matchData = true;
-                } else if (child->data().hasString()) {
-                    const std::string dataString = child->data().extractString();
-                    matchData = std::regex_match(dataString, dataPattern);
-                }
-            }
-        }
-
-        if (matchName && matchType && matchData) {
-            matches.push_back(child);
-        }
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByAndGlob(name, type, data, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+    return andQuery(name, type, data, Match::Glob).all(_node, depth);
 }
 
 std::vector<std::shared_ptr<Node>> Navigation::allByAndGlob(
@@ -732,49 +246,27 @@ std::vector<std::shared_ptr<Node>> Navigation::allByAnd(
     const std::string& type,
     const T& data,
     const size_t& depth) {
+    return andQuery(name, type, data, Match::Exact).all(_node, depth);
+}
 
-    std::vector<std::shared_ptr<Node>> matches;
-
-    if ( depth == 0 ) {
-        return matches;
-    }
+std::vector<std::shared_ptr<Node>> Navigation::allByAndParallel(
+    const std::string& name,
+    const std::string& type,
+    const std::string& data,
+    const size_t& depth,
+    size_t threads,
+    size_t grainSize) {
+    return andQuery(name, type, data, Match::Exact).allParallel(_node, depth, threads, grainSize);
+}
 
-    for (auto child: _node.children()) {
-
-        bool matchName(false);
-        bool matchType(false);
-        bool matchData(false);
-
-        if (child && (name.empty() || child->name() == name)) {
-            matchName = true;
-            
-            if ( type.empty() || child->type() == type ) {
-                matchType = true;
-
-                if constexpr (std::is_same_v<T, std::string>) {
-                    if ( data.empty() ) {
-                        matchData = true;
-                    } else if (child->data().hasString()) {
-                        std::string data_str = child->data().extractString();
-                        matchData = data_str == data;
-                    }
-                }  else if (child->data().isScalar()) {
-                    matchData = child->data() == data;
-                }
-            }
-        }
-
-        if ( matchName && matchType && matchData ) {
-            matches.push_back(child);
-        };
-
-
-        if (child && depth > 1) {
-            auto childMatches = child->pick().allByAnd(name, type, data, depth-1);
-            matches.insert(matches.end(), childMatches.begin(), childMatches.end());
-        }
-    }
-    return matches;
+std::vector<std::shared_ptr<Node>> Navigation::allByAndGlobParallel(
+    const std::string& name,
+    const std::string& type,
+    const std::string& data,
+    const size_t& depth,
+    size_t threads,
+    size_t grainSize) {
+    return andQuery(name, type, data, Match::Glob).allParallel(_node, depth, threads, grainSize);
 }
 
 /*
@@ -351,6 +351,14 @@ See C++ counterpart: :ref:`cpp-navigation-class`.
              py::overload_cast<const std::string&, const size_t&>(&Navigation::allByDataGlob),
              "get all nodes by glob-pattern data recursively",
              py::arg("data_pattern"), py::arg("depth")=100)
+        .def("by_value",
+             &Navigation::byValue,
+             "get node whose numeric data satisfies a ValuePredicate recursively",
+             py::arg("predicate"), py::arg("depth")=100)
+        .def("all_by_value",
+             &Navigation::allByValue,
+             "get all nodes whose numeric data satisfies a ValuePredicate recursively",
+             py::arg("predicate"), py::arg("depth")=100)
         .def("by_and",
              [](Navigation& self, const std::string& name, const std::string& type,
                     const py::object& data, const size_t& depth) {
@@ -386,7 +394,27 @@ See C++ counterpart: :ref:`cpp-navigation-class`.
              py::arg("name")=std::string(""),
              py::arg("type")=std::string(""),
              py::arg("data")=std::string(""),
-             py::arg("depth")=100);
+             py::arg("depth")=100)
+        .def("all_by_and_parallel",
+             &Navigation::allByAndParallel,
+             "get all nodes by exact conditions on name, type and string data, searching subtrees on several threads",
+             py::arg("name")=std::string(""),
+             py::arg("type")=std::string(""),
+             py::arg("data")=std::string(""),
+             py::arg("depth")=100,
+             py::arg("threads")=0,
+             py::arg("grain_size")=NodeQuery::kParallelGrainSize,
+             py::call_guard<py::gil_scoped_release>())
+        .def("all_by_and_glob_parallel",
+             &Navigation::allByAndGlobParallel,
+             "get all nodes by glob conditions on name, type and string data, searching subtrees on several threads",
+             py::arg("name")=std::string(""),
+             py::arg("type")=std::string(""),
+             py::arg("data")=std::string(""),
+             py::arg("depth")=100,
+             py::arg("threads")=0,
+             py::arg("grain_size")=NodeQuery::kParallelGrainSize,
+             py::call_guard<py::gil_scoped_release>());
 
     utils::bindClassMethodForScalarTypes(
         navigation,
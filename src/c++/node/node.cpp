@@ -1,7 +1,12 @@
 #include "utils/compat.hpp"
 #include "data/data_factory.hpp"
+#include "data/deferred_data.hpp"
 #include "node/node.hpp"
+#include "node/path_query.hpp"
+#include "node/traversal.hpp"
+#include "utils/hash.hpp"
 #include <limits>
+#include <mutex>
 
 using namespace std::string_literals;
 
@@ -23,6 +28,9 @@ namespace {
 
 using LinkRecord = std::tuple<std::string, std::string, std::string, std::string, int>;
 
+// below this many children, name lookups scan the children instead of building an index
+constexpr size_t kMinChildrenToIndex = 32;
+
 bool isListEntryName(const std::string& name) {
     return name.rfind("_list_.", 0) == 0;
 }
@@ -153,18 +161,7 @@ std::shared_ptr<Node> findSiblingByNameExcluding(
     const std::string& siblingName,
     const Node* ignoredNode) {
 
-    for (const auto& sibling : parent->children()) {
-        if (!sibling) {
-            continue;
-        }
-        if (sibling.get() == ignoredNode) {
-            continue;
-        }
-        if (sibling->name() == siblingName) {
-            return sibling;
-        }
-    }
-    return nullptr;
+    return parent->childByName(siblingName, ignoredNode);
 }
 
 std::string nextUniqueSiblingName(
@@ -191,20 +188,7 @@ bool hasSiblingNameConflict(
     if (!parent) {
         return false;
     }
-
-    for (const auto& sibling : parent->children()) {
-        if (!sibling) {
-            continue;
-        }
-        const Node* siblingRawPtr = sibling.get();
-        if (siblingRawPtr == ignoredA || siblingRawPtr == ignoredB) {
-            continue;
-        }
-        if (sibling->name() == candidateName) {
-            return true;
-        }
-    }
-    return false;
+    return parent->childByName(candidateName, ignoredA, ignoredB) != nullptr;
 }
 
 std::shared_ptr<Node> ensureNodeAtPath(
@@ -284,15 +268,7 @@ std::shared_ptr<Node> childByNameDepth1(const std::shared_ptr<Node>& parent, con
 }
 
 std::shared_ptr<Node> childByNameDepth1(const Node& parent, const std::string& childName) {
-    for (const auto& child : parent.children()) {
-        if (!child) {
-            continue;
-        }
-        if (child->name() == childName) {
-            return child;
-        }
-    }
-    return nullptr;
+    return parent.childByName(childName);
 }
 
 std::shared_ptr<Node> updateParameterOrMakeNewOne(
@@ -500,6 +476,14 @@ Node::~Node() {
     std::cout << "entering destructor of " << this->name() << std::endl;
     #endif
     
+    if (_ownedIndex) {
+        _ownedIndex->release();
+    }
+    _childrenByName.clear();
+    if (!_children.empty()) {
+        // surviving children lose their parent
+        structureChanged();
+    }
     _children.clear();
     _parent.reset();
 
@@ -509,6 +493,30 @@ Node::~Node() {
  }
 
 
+TreeIndex& Node::enableTreeIndex() {
+    if (_ownedIndex) {
+        return *_ownedIndex;
+    }
+    if (_treeIndex) {
+        throw std::runtime_error("enableTreeIndex: node '" + path()
+                                 + "' is already indexed from '" + _treeIndex->owner().path() + "'");
+    }
+    _ownedIndex = std::make_shared<TreeIndex>(*this);
+    return *_ownedIndex;
+}
+
+void Node::disableTreeIndex() {
+    if (_ownedIndex) {
+        _ownedIndex->release();
+        _ownedIndex.reset();
+    }
+}
+
+TreeIndex* Node::treeIndex() const {
+    return _treeIndex;
+}
+
+
 Navigation& Node::pick() {
     if (!_navigator) {
         _navigator = std::make_shared<Navigation>(*this);
@@ -545,7 +553,19 @@ const std::string& Node::name() const {
 }
 
 void Node::setName(const std::string& name) {
-    this->_name = name;
+    auto parent = this->_parent.lock();
+    if (parent) {
+        parent->unindexChild(this);
+    }
+    const std::string oldName = std::exchange(this->_name, name);
+    structureChanged();
+    fingerprintChanged();
+    if (parent) {
+        parent->indexChild(this);
+    }
+    if (_treeIndex) {
+        _treeIndex->rename(*this, oldName);
+    }
 }
 
 
@@ -554,23 +574,34 @@ const Data& Node::data() const {
 }
 
 std::shared_ptr<Data> Node::dataPtr() const {
+    if (auto deferred = std::dynamic_pointer_cast<DeferredData>(this->_data)) {
+        return deferred->load();
+    }
     return this->_data;
 }
 
 void Node::setData(std::shared_ptr<Data> d) {
     this->_data = std::move(d);
+    _dataFingerprintIsValid = false;
+    fingerprintChanged();
 }
 
 void Node::setData(const Data& d) {
     this->_data = d.clone();
+    _dataFingerprintIsValid = false;
+    fingerprintChanged();
 }
 
-std::string Node::type() const {
+const std::string& Node::type() const {
     return _type;
 }
 
 void Node::setType(const std::string& type) {
-    this->_type = type;
+    const std::string oldType = std::exchange(this->_type, type);
+    fingerprintChanged();
+    if (_treeIndex) {
+        _treeIndex->retype(*this, oldType);
+    }
 }
 
 bool Node::hasLinkTarget() const {
@@ -591,11 +622,13 @@ void Node::setLinkTarget(const std::string& targetFile, const std::string& targe
     }
     _linkTargetFile = targetFile;
     _linkTargetPath = targetPath;
+    fingerprintChanged();
 }
 
 void Node::clearLinkTarget() {
     _linkTargetFile.clear();
     _linkTargetPath.clear();
+    fingerprintChanged();
 }
 
 bool Node::noData() const {
@@ -654,18 +687,79 @@ std::vector<std::string> Node::getChildrenNames() const {
 }
 
 
+std::shared_ptr<Node> Node::childByName(
+    const std::string& name,
+    const Node* ignoredA,
+    const Node* ignoredB) const {
+
+    if (_childrenByNameIsBuilt) {
+        Node* match = nullptr;
+        size_t matchCount = 0;
+        auto [first, last] = _childrenByName.equal_range(name);
+        for (auto it = first; it != last; ++it) {
+            if (it->second != ignoredA && it->second != ignoredB) {
+                match = it->second;
+                matchCount += 1;
+            }
+        }
+        if (matchCount == 0) {
+            return nullptr;
+        }
+        if (matchCount == 1) {
+            return match->shared_from_this();
+        }
+        // children renamed into duplicates: keep the first one in insertion order
+    }
+
+    for (const auto& child : _children) {
+        if (child && child.get() != ignoredA && child.get() != ignoredB && child->name() == name) {
+            return child;
+        }
+    }
+    return nullptr;
+}
+
+void Node::indexChild(Node* child) {
+    if (_childrenByNameIsBuilt) {
+        _childrenByName.emplace(child->name(), child);
+        return;
+    }
+    if (_children.size() < kMinChildrenToIndex) {
+        return;
+    }
+    _childrenByName.reserve(_children.size());
+    for (const auto& sibling : _children) {
+        if (sibling) {
+            _childrenByName.emplace(sibling->name(), sibling.get());
+        }
+    }
+    _childrenByNameIsBuilt = true;
+}
+
+void Node::unindexChild(const Node* child) {
+    if (!_childrenByNameIsBuilt) {
+        return;
+    }
+    auto [first, last] = _childrenByName.equal_range(child->name());
+    for (auto it = first; it != last; ++it) {
+        if (it->second == child) {
+            _childrenByName.erase(it);
+            return;
+        }
+    }
+}
+
+
 std::vector<std::shared_ptr<Node>> Node::descendants() {
     std::vector<std::shared_ptr<Node>> descendants;
-    gatherAllDescendantsInList(shared_from_this(), descendants);
+    traversal::walk(*this, [&descendants](Node& node) {
+        descendants.push_back(node.shared_from_this());
+    });
     return descendants;
 }
 
-
-void Node::gatherAllDescendantsInList(std::shared_ptr<Node> node, std::vector<std::shared_ptr<Node>>& descendants) {
-    descendants.push_back(node);
-    for (const auto& child : node->children()) {
-        gatherAllDescendantsInList(child, descendants);
-    }
+std::vector<std::shared_ptr<Node>> Node::select(const std::string& expression) {
+    return PathQuery(expression).select(*this);
 }
 
 
@@ -675,22 +769,79 @@ std::weak_ptr<Node> Node::parent() const {
 
 
 std::shared_ptr<const Node> Node::root() const {
-    auto parent = this->_parent.lock();
-    if (!parent) return shared_from_this();
-    return parent->root();
+    return placement().root->shared_from_this();
 }
 
 
 size_t Node::level() const {
-    size_t level = 0;
-    std::weak_ptr<Node> weak_parent = _parent;
+    return placement().level;
+}
+
+bool Node::Placement::isCurrent() const {
+    // a fill publishes treeToCheck and generation last, so that the fields read
+    // after a successful check are complete
+    const TreeGeneration* checked = treeToCheck.load(std::memory_order_acquire);
+    return checked && generation.load(std::memory_order_acquire) == checked->load(std::memory_order_acquire);
+}
+
+void Node::structureChanged() {
+    std::shared_ptr<Node> ancestor = _parent.lock();
+    const Node* root = this;
+    while (ancestor) {
+        root = ancestor.get();
+        ancestor = ancestor->_parent.lock();
+    }
+    if (root->_treeGeneration) {
+        root->_treeGeneration->fetch_add(1, std::memory_order_release);
+    }
+}
+
+const Node::Placement& Node::placement() const {
+    if (_placement.isCurrent()) {
+        return _placement;
+    }
+
+    // fills are serialized: concurrent readers of a stale node compute it once
+    static std::mutex fillMutex;
+    std::lock_guard<std::mutex> lock(fillMutex);
 
-    while (auto parent = weak_parent.lock()) {
-        level += 1;
-        weak_parent = parent->_parent;
+    // climb to the first ancestor with a valid placement, then fill downwards
+    std::vector<const Node*> outdated;
+    std::shared_ptr<const Node> ancestor;
+    const Node* node = this;
+    while (node && !node->_placement.isCurrent()) {
+        outdated.push_back(node);
+        ancestor = node->_parent.lock();
+        node = ancestor.get();
     }
 
-    return level;
+    const Placement* above = node ? &node->_placement : nullptr;
+    for (auto it = outdated.rbegin(); it != outdated.rend(); ++it) {
+        Placement& placement = (*it)->_placement;
+        placement.previousTree = std::move(placement.tree);
+        if (above) {
+            placement.path = above->path;
+            if (!placement.path.empty()) {
+                placement.path += '/';
+            }
+            placement.path += (*it)->_name;
+            placement.level = above->level + 1;
+            placement.root = above->root;
+            placement.tree = above->tree;
+        } else {
+            placement.path = (*it)->_name;
+            placement.level = 0;
+            placement.root = *it;
+            if (!(*it)->_treeGeneration) {
+                (*it)->_treeGeneration = std::make_shared<TreeGeneration>(1);
+            }
+            placement.tree = (*it)->_treeGeneration;
+        }
+        placement.treeToCheck.store(placement.tree.get(), std::memory_order_release);
+        placement.generation.store(placement.tree->load(std::memory_order_acquire), std::memory_order_release);
+        above = &placement;
+    }
+    return _placement;
 }
 
 size_t Node::position() const {
@@ -715,6 +866,9 @@ void Node::detach() {
     std::shared_ptr<Node> parent = this->_parent.lock();
 
     if (parent) {
+        if (_treeIndex && _treeIndex != _ownedIndex.get()) {
+            _treeIndex->removeSubtree(*this);
+        }
         auto& siblings = parent->_children;
 
         // remove_if is more efficient than for loop + if
@@ -723,6 +877,9 @@ void Node::detach() {
                                             return node.get() == this;
                                         }),
                         siblings.end());
+        parent->unindexChild(this);
+        parent->structureChanged();
+        parent->fingerprintChanged();
     }
     this->_parent.reset();
 }
@@ -740,6 +897,10 @@ void Node::attachTo(
         throw std::runtime_error("attachTo: Stack-allocated nodes cannot be attached to heap-allocated nodes.");
     }
 
+    if (node->_treeIndex) {
+        TreeIndex::checkInsertable(*this);
+    }
+
     auto siblingWithSameName = findSiblingByNameExcluding(node, this->name(), this);
     if (siblingWithSameName) {
         if (overrideSiblingByName) {
@@ -750,6 +911,7 @@ void Node::attachTo(
     }
 
     this->detach();
+    structureChanged();
     this->_parent = node;
 
     auto& siblings = node->_children;
@@ -768,6 +930,11 @@ void Node::attachTo(
     }
 
     node->_children.emplace(siblings.begin() + emplacementIndex, thisPtr);
+    node->indexChild(this);
+    node->fingerprintChanged();
+    if (node->_treeIndex) {
+        node->_treeIndex->insertSubtree(*this);
+    }
 }
 
 
@@ -814,6 +981,10 @@ void Node::swap(std::shared_ptr<Node> node) {
         }
 
         std::iter_swap(thisIt, otherIt);
+        if (_treeIndex) {
+            _treeIndex->reorder(*thisParent);
+        }
+        thisParent->fingerprintChanged();
         return;
     }
 
@@ -826,6 +997,13 @@ void Node::swap(std::shared_ptr<Node> node) {
                                  "' into '" + otherParent->path() + "'");
     }
 
+    if (thisParent && thisParent->_treeIndex) {
+        TreeIndex::checkInsertable(*node);
+    }
+    if (otherParent && otherParent->_treeIndex) {
+        TreeIndex::checkInsertable(*this);
+    }
+
     const size_t thisPosition = position();
     const size_t otherPosition = node->position();
 
@@ -888,6 +1066,16 @@ std::shared_ptr<Node> Node::getAtPath(const std::string& path, bool pathIsRelati
         return nullptr;
     }
 
+    if (!pathIsRelative && startNode->_ownedIndex) {
+        std::string key = startNode->name();
+        for (size_t i = pathElements.front() == startNode->name() ? 1 : 0; i < pathElements.size(); ++i) {
+            key += "/" + pathElements[i];
+        }
+        if (Node* indexed = startNode->_ownedIndex->atPath(key)) {
+            return indexed->shared_from_this();
+        }
+    }
+
     size_t currentIndex = 0;
     if (pathElements.front() == startNode->name()) {
         currentIndex = 1;
@@ -941,13 +1129,18 @@ ParameterValue Node::getParameters(const std::string& containerName) const {
 
 void Node::reloadNodeData(const std::string& filename) {
     const bool flattenCgnsTreeRoot = io::file_flattens_cgns_tree_root(filename);
-    auto loadedTreeContainer = io::read(filename);
-    if (!loadedTreeContainer) {
-        throw std::runtime_error("reloadNodeData: could not load file '" + filename + "'");
-    }
-
     const std::string persistedPath = persistedPathForNode(*this, flattenCgnsTreeRoot);
-    auto updatedNode = persistedPath.empty() ? loadedTreeContainer : loadedTreeContainer->getAtPath(persistedPath);
+
+    std::shared_ptr<Node> updatedNode;
+    if (io::detect_format(filename) == io::FileFormat::Hdf5Cgns) {
+        updatedNode = io::read_node(filename, persistedPath);
+    } else {
+        auto loadedTreeContainer = io::read(filename);
+        if (!loadedTreeContainer) {
+            throw std::runtime_error("reloadNodeData: could not load file '" + filename + "'");
+        }
+        updatedNode = persistedPath.empty() ? loadedTreeContainer : loadedTreeContainer->getAtPath(persistedPath);
+    }
     if (!updatedNode) {
         throw std::runtime_error(
             "reloadNodeData: node path '" + this->path() + "' was not found in '" + filename + "'");
@@ -983,6 +1176,19 @@ void Node::saveThisNodeOnly(const std::string& filename, const std::string& back
         throw std::runtime_error("saveThisNodeOnly: node path is empty");
     }
 
+    if (io::detect_format(filename) == io::FileFormat::Hdf5Cgns) {
+        auto persistedNode = std::make_shared<Node>(pathElements.back(), this->type());
+        if (this->hasLinkTarget()) {
+            persistedNode->setLinkTarget(
+                this->linkTargetFile(),
+                persistedLinkTargetPathForNode(*this, this->linkTargetPath(), flattenCgnsTreeRoot));
+        } else {
+            persistedNode->setData(this->dataPtr());
+        }
+        io::update_node(filename, persistedPath, *persistedNode);
+        return;
+    }
+
     auto loadedTreeContainer = io::read(filename);
     if (!loadedTreeContainer) {
         throw std::runtime_error("saveThisNodeOnly: could not load file '" + filename + "'");
@@ -1042,30 +1248,88 @@ void Node::merge(std::shared_ptr<Node> node) {
 
 
 std::string Node::path() const {
-    std::vector<std::string> ancestors;
-    std::shared_ptr<Node> current = _parent.lock();
+    return placement().path;
+}
 
-    while (current) {
-        ancestors.push_back(current->name());
-        current = current->_parent.lock();
+void Node::fingerprintChanged() {
+    _fingerprintIsValid = false;
+    // a valid fingerprint implies valid ones below, so the climb stops at the first invalid ancestor
+    std::shared_ptr<Node> ancestor = _parent.lock();
+    while (ancestor && ancestor->_fingerprintIsValid) {
+        ancestor->_fingerprintIsValid = false;
+        ancestor = ancestor->_parent.lock();
     }
+}
 
-    std::reverse(ancestors.begin(), ancestors.end());
+void Node::invalidateFingerprint() {
+    _dataFingerprintIsValid = false;
+    fingerprintChanged();
+}
 
-    std::string path;
-    for (const auto& ancestor : ancestors) {
-        if (!path.empty()) {
-            path += "/";
+void Node::refreshFingerprint() {
+    traversal::walk(*this, [](Node& node) {
+        // payloads not hashed yet, or not loaded yet, cannot be stale
+        const auto deferred = std::dynamic_pointer_cast<DeferredData>(node._data);
+        if (!node._dataFingerprintIsValid || (deferred && !deferred->isLoaded())) {
+            return;
+        }
+        const std::uint64_t hashed = node._data->fingerprint();
+        if (hashed != node._dataFingerprint) {
+            node._dataFingerprint = hashed;
+            node.fingerprintChanged();
         }
-        path += ancestor;
+    });
+}
+
+std::uint64_t Node::dataFingerprint() const {
+    if (!_dataFingerprintIsValid) {
+        _dataFingerprint = _data->fingerprint();
+        _dataFingerprintIsValid = true;
     }
+    return _dataFingerprint;
+}
 
-    if (!path.empty()) {
-        path += "/";
+void Node::updateFingerprint() const {
+    utils::Hasher hasher;
+    hasher.update(_name);
+    hasher.update(_type);
+    hasher.update(_linkTargetFile);
+    hasher.update(_linkTargetPath);
+    hasher.update(dataFingerprint());
+    hasher.update(_children.size());
+    for (const auto& child : _children) {
+        hasher.update(child->_fingerprint);
     }
-    path += this->name();
+    _fingerprint = hasher.digest();
+    _fingerprintIsValid = true;
+}
 
-    return path;
+std::uint64_t Node::fingerprint() const {
+    // post-order over the nodes whose fingerprint is out of date
+    std::vector<std::pair<const Node*, size_t>> stack;
+    stack.emplace_back(this, 0);
+    while (!stack.empty() && !_fingerprintIsValid) {
+        auto& [node, next] = stack.back();
+        const auto& children = node->_children;
+        while (next < children.size() && children[next]->_fingerprintIsValid) {
+            ++next;
+        }
+        if (next < children.size()) {
+            const Node* child = children[next++].get();
+            stack.emplace_back(child, 0);
+            continue;
+        }
+        node->updateFingerprint();
+        stack.pop_back();
+    }
+    return _fingerprint;
+}
+
+std::optional<std::uint64_t> Node::cachedFingerprint() const {
+    if (!_fingerprintIsValid) {
+        return std::nullopt;
+    }
+    return _fingerprint;
 }
 
 
@@ -1208,3 +1472,7 @@ std::string Node::getInfo() const {
 void Node::write(const std::string& filename) {
     io::write_node(filename, shared_from_this());
 }
+
+void Node::write(const std::string& filename, const io::WriteOptions& options) {
+    io::write_node(filename, shared_from_this(), options);
+}
@@ -11,6 +11,7 @@
 # include "node/node.hpp"
 # include "node/node_group_pybind.hpp"
 # include "node/node_factory.hpp"
+# include "node/tree_diff.hpp"
 
 # include <algorithm>
 # include <cctype>
@@ -795,17 +796,164 @@ Return full path from root.
 
 See C++ counterpart: :ref:`cpp-node-path`.
 )doc")
-        .def("write", &Node::write, R"doc(
+        .def("write", [](Node& node,
+                         const std::string& filename,
+                         unsigned deflate_level,
+                         bool shuffle,
+                         const py::object& chunks,
+                         size_t chunk_bytes,
+                         size_t min_chunked_bytes,
+                         size_t staging_bytes,
+                         bool incremental) {
+            io::WriteOptions options;
+            options.deflateLevel = deflate_level;
+            options.shuffle = shuffle;
+            options.chunkBytes = chunk_bytes;
+            options.minChunkedBytes = min_chunked_bytes;
+            options.stagingBytes = staging_bytes;
+            options.incremental = incremental;
+            if (chunks.is_none()) {
+                options.chunkPolicy = io::ChunkPolicy::Auto;
+            } else if (py::isinstance<py::str>(chunks)) {
+                const std::string policy = chunks.cast<std::string>();
+                if (policy == "auto") {
+                    options.chunkPolicy = io::ChunkPolicy::Auto;
+                } else if (policy == "contiguous") {
+                    options.chunkPolicy = io::ChunkPolicy::Contiguous;
+                } else {
+                    throw py::value_error("write: chunks must be None, 'auto', 'contiguous' or a chunk shape");
+                }
+            } else {
+                options.chunkPolicy = io::ChunkPolicy::Fixed;
+                options.chunkShape = chunks.cast<std::vector<size_t>>();
+            }
+            node.write(filename, options);
+        }, R"doc(
 Write this subtree to file.
 
-The output format is inferred from the filename extension.
+The output format is inferred from the filename extension. Storage options
+only apply to HDF5/CGNS files; chunked and compressed datasets are read back
+transparently.
+
+Parameters
+----------
+filename : str
+    Output file path.
+deflate_level : int, optional
+    Deflate (gzip) compression level from 1 to 9. Defaults to 0 (no compression).
+shuffle : bool, optional
+    Apply the byte shuffle filter before compression. Defaults to ``False``.
+chunks : None, str or list[int], optional
+    Chunk shape policy: ``None`` or ``"auto"`` for automatic chunks (used only
+    when a filter is enabled), ``"contiguous"`` to never chunk, or an explicit
+    chunk shape in array axis order.
+chunk_bytes : int, optional
+    Target chunk size in bytes of automatic chunks. Defaults to 1 MiB.
+min_chunked_bytes : int, optional
+    Arrays smaller than this many bytes stay contiguous. Defaults to 0.
+staging_bytes : int, optional
+    Largest buffer used to reorder arrays that are not Fortran-contiguous;
+    Fortran-contiguous arrays are written without copy. Defaults to 4 MiB.
+incremental : bool, optional
+    Update a file previously written with ``incremental=True`` in place,
+    rewriting only the nodes changed since (compared by :py:meth:`fingerprint`,
+    after :py:meth:`refresh_fingerprint`, so arrays edited in place are seen).
+    Other files are written in full. Defaults to ``False``.
 
 See C++ counterpart: :ref:`cpp-node-write`.
-)doc")
+)doc",
+             py::arg("filename"),
+             py::arg("deflate_level")=0u,
+             py::arg("shuffle")=false,
+             py::arg("chunks")=py::none(),
+             py::arg("chunk_bytes")=size_t{1} << 20,
+             py::arg("min_chunked_bytes")=size_t{0},
+             py::arg("staging_bytes")=size_t{4} << 20,
+             py::arg("incremental")=false)
         .def("descendants", &Node::descendants, R"doc(
 Return this node and all descendants in depth-first order.
 
 See C++ counterpart: :ref:`cpp-node-descendants`.
+)doc")
+        .def("select", &Node::select, R"doc(
+Select nodes below this one with a path expression, evaluated in C++.
+
+Steps are separated by ``/`` (children) or ``//`` (descendants; ``//{n}``
+and ``//{m,n}`` bound the depth). A step is ``*``, a node type (a word
+ending with ``_t``) or a node name, globs allowed, followed by optional
+``[key op value]`` predicates on ``name``, ``type``, ``data`` or ``dtype``
+with ``=``, ``!=``, ``~`` (glob) or ``!~``. For example
+``root.select("CGNSBase_t/Zone_t[name~'blk*']//DataArray_t[dtype=float64]")``.
+
+Returns selected nodes in depth-first order.
+
+See C++ counterpart: :ref:`cpp-node-select`.
+)doc",
+             py::arg("expression"))
+        .def("enable_tree_index", [](Node& node) { node.enableTreeIndex(); }, R"doc(
+Index this node and its descendants by name, type and path.
+
+The index is kept up to date by ``attach_to``, ``detach``, ``set_name``,
+``set_type`` and ``swap``. Exact name and type searches of ``pick()`` and
+absolute ``get_at_path`` lookups then read it instead of walking the tree.
+Raises ``RuntimeError`` when an ancestor already indexes this node, or when
+a descendant owns an index; attaching a subtree holding an index below an
+indexed node raises too.
+
+See C++ counterpart: :ref:`cpp-node-enabletreeindex`.
+)doc")
+        .def("disable_tree_index", &Node::disableTreeIndex, R"doc(
+Drop the tree index owned by this node, if any.
+
+See C++ counterpart: :ref:`cpp-node-enabletreeindex`.
+)doc")
+        .def("has_tree_index", [](const Node& node) { return node.treeIndex() != nullptr; }, R"doc(
+Whether this node is covered by a tree index, its own or an ancestor's.
+
+See C++ counterpart: :ref:`cpp-node-enabletreeindex`.
+)doc")
+        .def("diff", [](const Node& node, const Node& other, double relativeTolerance, double absoluteTolerance) {
+                return TreePatch::diff(node, other, relativeTolerance, absoluteTolerance);
+            }, R"doc(
+Changes turning this tree into ``other``, as a :py:class:`TreePatch`.
+
+Payloads shared by both trees are not compared, and numeric payloads whose
+elements differ by at most ``absolute_tolerance + relative_tolerance`` times
+the larger magnitude are considered unchanged.
+
+See C++ counterpart: :ref:`cpp-node-treepatch`.
+)doc",
+             py::arg("other"),
+             py::arg("relative_tolerance")=0.0,
+             py::arg("absolute_tolerance")=0.0)
+        .def("apply_patch", [](Node& node, const TreePatch& patch) { patch.apply(node); }, R"doc(
+Replay a :py:class:`TreePatch` on this tree, in place.
+
+See C++ counterpart: :ref:`cpp-node-treepatch`.
+)doc",
+             py::arg("patch"))
+        .def("fingerprint", &Node::fingerprint, R"doc(
+Stable 64-bit hash of this subtree: names, types, link targets, payloads and
+order of children.
+
+Fingerprints are cached per node. Edits made through the node API only clear
+the cache of the edited node and its ancestors, so rehashing after a local
+change costs the edited payload and the path to the root. Arrays edited in
+place through NumPy need ``invalidate_fingerprint()`` on their node, or
+``refresh_fingerprint()`` on the subtree.
+
+See C++ counterpart: :ref:`cpp-node-fingerprint`.
+)doc")
+        .def("invalidate_fingerprint", &Node::invalidateFingerprint, R"doc(
+Forget the cached fingerprints of this node, its payload and its ancestors.
+
+See C++ counterpart: :ref:`cpp-node-fingerprint`.
+)doc")
+        .def("refresh_fingerprint", &Node::refreshFingerprint, R"doc(
+Rehash the loaded payloads of this subtree, forgetting the fingerprints they
+no longer match. Incremental writes call it themselves.
+
+See C++ counterpart: :ref:`cpp-node-fingerprint`.
 )doc")
 
 
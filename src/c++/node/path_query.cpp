@@ -0,0 +1,331 @@
+#include "node/path_query.hpp"
+#include "node/node.hpp"
+#include "node/traversal.hpp"
+#include "utils/comparator.hpp"
+#include "utils/string.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+using traversal::Action;
+
+namespace {
+
+constexpr size_t kUnboundedLevel = std::numeric_limits<size_t>::max();
+
+bool isGlob(const std::string& pattern) {
+    return pattern.find_first_of("*?") != std::string::npos;
+}
+
+/** True when the scalar payload @p data equals @p value, whatever its numeric dtype. */
+bool scalarEquals(const Data& data, double value) {
+    if (!data.isScalar()) {
+        return false;
+    }
+    const std::string dtype = data.dtype();
+    if (dtype == "float64") return data == value;
+    if (dtype == "float32") return data == static_cast<float>(value);
+    if (dtype == "bool") return data == !utils::approxEqual(value, 0.0);
+    if (!utils::approxEqual(std::floor(value), value)) {
+        return false;
+    }
+    return data.itemAsInt64(std::vector<size_t>(data.dimensions(), 0)) == static_cast<int64_t>(value);
+}
+
+} // namespace
+
+class PathQuery::Parser {
+
+public:
+    explicit Parser(const std::string& text) : _text(text) {}
+
+    /** Parse the whole expression into steps. */
+    std::vector<Step> parse() {
+        std::vector<Step> steps;
+        do {
+            Step step;
+            parseAxis(step.minLevel, step.maxLevel, steps.empty());
+            parseNodeTest(step.conditions);
+            parsePredicates(step.conditions);
+            // name and type are checked before dtype and data, which may read the payload
+            std::stable_sort(step.conditions.begin(), step.conditions.end(),
+                             [](const Condition& a, const Condition& b) { return a.field < b.field; });
+            steps.push_back(std::move(step));
+        } while (!atEnd());
+        return steps;
+    }
+
+    bool atEnd() const { return _pos == _text.size(); }
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::invalid_argument("PathQuery: " + message + " at position "
+                                    + std::to_string(_pos) + " in \"" + _text + "\"");
+    }
+
+    /** Parse an axis into the level bounds of the step that follows it. */
+    void parseAxis(size_t& minLevel, size_t& maxLevel, bool leading) {
+        minLevel = 1;
+        maxLevel = 1;
+        if (_text.compare(_pos, 2, "//") == 0) {
+            _pos += 2;
+            maxLevel = kUnboundedLevel;
+            if (peek() == '{') {
+                ++_pos;
+                const size_t first = parseCount();
+                if (peek() == ',') {
+                    ++_pos;
+                    minLevel = first;
+                    maxLevel = parseCount();
+                } else {
+                    maxLevel = first;
+                }
+                expect('}');
+                if (minLevel == 0 || minLevel > maxLevel) {
+                    fail("invalid level bounds");
+                }
+            }
+        } else if (peek() == '/') {
+            ++_pos;
+        } else if (!leading) {
+            fail("expected '/' or '//'");
+        }
+    }
+
+    /** Parse a node test; '*' adds no condition. */
+    void parseNodeTest(std::vector<Condition>& conditions) {
+        if (peek() == '\'' || peek() == '"') {
+            conditions.push_back(textCondition(Condition::Field::Name, false, false, parseQuoted()));
+            return;
+        }
+        const size_t begin = _pos;
+        while (!atEnd() && _text[_pos] != '/' && _text[_pos] != '[') {
+            ++_pos;
+        }
+        const std::string word = _text.substr(begin, _pos - begin);
+        if (word.empty()) {
+            fail("expected a node test");
+        }
+        if (word == "*") {
+            return;
+        }
+        const auto field = utils::stringEndsWith(word, "_t")
+            ? Condition::Field::Type
+            : Condition::Field::Name;
+        conditions.push_back(textCondition(field, isGlob(word), false, word));
+    }
+
+    /** Parse the predicates following a node test. */
+    void parsePredicates(std::vector<Condition>& conditions) {
+        while (peek() == '[') {
+            ++_pos;
+            skipSpaces();
+            const size_t keyBegin = _pos;
+            while (!atEnd() && std::isalpha(static_cast<unsigned char>(_text[_pos]))) {
+                ++_pos;
+            }
+            const std::string key = _text.substr(keyBegin, _pos - keyBegin);
+            Condition::Field field;
+            if (key == "name") field = Condition::Field::Name;
+            else if (key == "type") field = Condition::Field::Type;
+            else if (key == "dtype") field = Condition::Field::DType;
+            else if (key == "data") field = Condition::Field::Data;
+            else {
+                _pos = keyBegin;
+                fail("unknown predicate key '" + key + "'");
+            }
+
+            skipSpaces();
+            const bool negated = peek() == '!';
+            if (negated) ++_pos;
+            bool glob = false;
+            if (peek() == '~') {
+                glob = true;
+            } else if (peek() != '=') {
+                fail("expected '=', '!=', '~' or '!~'");
+            }
+            ++_pos;
+
+            skipSpaces();
+            const bool quoted = peek() == '\'' || peek() == '"';
+            std::string value;
+            if (quoted) {
+                value = parseQuoted();
+            } else {
+                const size_t valueBegin = _pos;
+                while (!atEnd() && _text[_pos] != ']') {
+                    ++_pos;
+                }
+                value = _text.substr(valueBegin, _pos - valueBegin);
+                while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back()))) {
+                    value.pop_back();
+                }
+                if (value.empty()) {
+                    fail("expected a predicate value");
+                }
+            }
+            skipSpaces();
+            expect(']');
+
+            Condition condition = textCondition(field, glob, negated, value);
+            if (field == Condition::Field::Data && !quoted && !glob) {
+                char* end = nullptr;
+                const double number = std::strtod(value.c_str(), &end);
+                if (end == value.c_str() + value.size()) {
+                    condition.compare = Condition::Compare::Number;
+                    condition.number = number;
+                }
+            }
+            conditions.push_back(condition);
+        }
+    }
+
+private:
+    const std::string& _text;
+    size_t _pos = 0;
+
+    char peek() const { return atEnd() ? '\0' : _text[_pos]; }
+
+    void skipSpaces() {
+        while (!atEnd() && std::isspace(static_cast<unsigned char>(_text[_pos]))) {
+            ++_pos;
+        }
+    }
+
+    void expect(char c) {
+        if (peek() != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        ++_pos;
+    }
+
+    size_t parseCount() {
+        const size_t begin = _pos;
+        size_t count = 0;
+        while (!atEnd() && std::isdigit(static_cast<unsigned char>(_text[_pos]))) {
+            count = count * 10 + static_cast<size_t>(_text[_pos] - '0');
+            ++_pos;
+        }
+        if (_pos == begin) {
+            fail("expected a level count");
+        }
+        return count;
+    }
+
+    std::string parseQuoted() {
+        const char quote = _text[_pos++];
+        const size_t end = _text.find(quote, _pos);
+        if (end == std::string::npos) {
+            fail("unterminated quoted string");
+        }
+        std::string value = _text.substr(_pos, end - _pos);
+        _pos = end + 1;
+        return value;
+    }
+
+    static Condition textCondition(
+        Condition::Field field, bool glob, bool negated, const std::string& text) {
+        Condition condition;
+        condition.field = field;
+        condition.compare = glob ? Condition::Compare::Glob : Condition::Compare::Equal;
+        condition.negated = negated;
+        condition.text = text;
+        condition.number = 0.0;
+        return condition;
+    }
+};
+
+
+PathQuery::PathQuery(const std::string& expression)
+    : _expression(expression), _steps(Parser(_expression).parse()) {}
+
+const std::string& PathQuery::expression() const {
+    return _expression;
+}
+
+bool PathQuery::Condition::matches(const Node& node) const {
+    bool matched = false;
+    switch (field) {
+        case Field::Name:
+            matched = compare == Compare::Glob ? utils::globMatch(node.name(), text) : node.name() == text;
+            break;
+        case Field::Type:
+            matched = compare == Compare::Glob ? utils::globMatch(node.type(), text) : node.type() == text;
+            break;
+        case Field::DType: {
+            const std::string dtype = node.data().dtype();
+            matched = compare == Compare::Glob ? utils::globMatch(dtype, text) : dtype == text;
+            break;
+        }
+        case Field::Data: {
+            const Data& data = node.data();
+            if (compare == Compare::Number) {
+                matched = scalarEquals(data, number);
+            } else if (data.hasString()) {
+                const std::string value = data.extractString();
+                matched = compare == Compare::Glob ? utils::globMatch(value, text) : value == text;
+            }
+            break;
+        }
+    }
+    return matched != negated;
+}
+
+bool PathQuery::Step::matches(const Node& node) const {
+    return std::all_of(conditions.begin(), conditions.end(),
+                       [&node](const Condition& condition) { return condition.matches(node); });
+}
+
+std::vector<std::shared_ptr<Node>> PathQuery::select(Node& start) const {
+    // A state is a step still to be matched, with the number of levels walked
+    // since the node that matched the previous step. Each node on the current
+    // walk path keeps its states; nodes left without any are not entered.
+    struct State {
+        size_t step;
+        size_t levels;
+        bool operator==(const State&) const = default;
+    };
+    std::vector<std::vector<State>> statesByLevel(1, std::vector<State>{{0, 0}});
+    std::vector<std::shared_ptr<Node>> selected;
+
+    traversal::walk(start, [&](Node& node, size_t level) {
+        if (level == 0) {
+            return Action::Continue;
+        }
+        if (statesByLevel.size() <= level) {
+            statesByLevel.resize(level + 1);
+        }
+        const std::vector<State>& parentStates = statesByLevel[level - 1];
+        std::vector<State>& states = statesByLevel[level];
+        states.clear();
+        auto keep = [&states](State state) {
+            if (std::find(states.begin(), states.end(), state) == states.end()) {
+                states.push_back(state);
+            }
+        };
+
+        bool isSelected = false;
+        for (const State& parentState : parentStates) {
+            const Step& step = _steps[parentState.step];
+            const size_t levels = parentState.levels + 1;
+            if (levels < step.maxLevel) {
+                keep({parentState.step, levels});
+            }
+            if (levels >= step.minLevel && step.matches(node)) {
+                if (parentState.step + 1 == _steps.size()) {
+                    isSelected = true;
+                } else {
+                    keep({parentState.step + 1, 0});
+                }
+            }
+        }
+        if (isSelected) {
+            selected.push_back(node.shared_from_this());
+        }
+        return states.empty() ? Action::SkipChildren : Action::Continue;
+    });
+    return selected;
+}
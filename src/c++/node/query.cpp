@@ -0,0 +1,223 @@
+#include "node/query.hpp"
+#include "node/node.hpp"
+#include "node/traversal.hpp"
+#include "utils/string.hpp"
+#include "utils/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+using traversal::Action;
+
+namespace {
+
+/** A node checked alone, or the subtree below it, searched by one worker of allParallel. */
+struct SearchTask {
+    Node* node;
+    size_t level;
+    bool wholeSubtree;
+};
+
+// allParallel splits the first levels until each worker has this many tasks to pick from
+constexpr size_t kTasksPerWorker = 16;
+constexpr size_t kMaxSplitLevels = 4;
+
+} // namespace
+
+NodeQuery::Pattern::Pattern(const std::string& pattern, Match match)
+    : _pattern(pattern), _match(match) {
+    if (_match == Match::Regex) {
+        _regex = std::regex(_pattern);
+    } else if (_match == Match::Glob && _pattern.find_first_of("*?") == std::string::npos) {
+        _match = Match::Exact;
+    }
+}
+
+bool NodeQuery::Pattern::matches(std::string_view text) const {
+    switch (_match) {
+        case Match::Exact: return text == _pattern;
+        case Match::Glob: return utils::globMatch(text, _pattern);
+        case Match::Regex: return std::regex_search(text.begin(), text.end(), _regex);
+    }
+    return false;
+}
+
+const std::string* NodeQuery::Pattern::exact() const {
+    return _match == Match::Exact ? &_pattern : nullptr;
+}
+
+NodeQuery& NodeQuery::name(const std::string& pattern, Match match) {
+    _name.emplace(pattern, match);
+    return *this;
+}
+
+NodeQuery& NodeQuery::type(const std::string& pattern, Match match) {
+    _type.emplace(pattern, match);
+    return *this;
+}
+
+NodeQuery& NodeQuery::data(const std::string& pattern, Match match) {
+    _data = [compiled = Pattern(pattern, match)](const Data& data) {
+        // one buffer per thread for the texts that cannot be viewed in place
+        thread_local std::string buffer;
+        return data.hasString() && compiled.matches(data.stringView(buffer));
+    };
+    return *this;
+}
+
+NodeQuery& NodeQuery::value(const ValuePredicate& predicate) {
+    _data = [predicate](const Data& data) {
+        return data.satisfies(predicate);
+    };
+    return *this;
+}
+
+bool NodeQuery::matches(const Node& node) const {
+    if (_name && !_name->matches(node.name())) return false;
+    if (_type && !_type->matches(node.type())) return false;
+    if (_data && !_data(node.data())) return false;
+    return true;
+}
+
+std::optional<std::vector<Node*>> NodeQuery::indexedCandidates(const Node& start, size_t depth) const {
+    const TreeIndex* index = start.treeIndex();
+    if (!index) {
+        return std::nullopt;
+    }
+    if (const std::string* name = _name ? _name->exact() : nullptr) {
+        return index->byName(start, *name, depth);
+    }
+    if (const std::string* type = _type ? _type->exact() : nullptr) {
+        return index->byType(start, *type, depth);
+    }
+    return std::nullopt;
+}
+
+std::shared_ptr<Node> NodeQuery::first(Node& start, size_t depth) const {
+    if (auto candidates = indexedCandidates(start, depth)) {
+        for (Node* candidate : *candidates) {
+            if (matches(*candidate)) {
+                return candidate->shared_from_this();
+            }
+        }
+        return nullptr;
+    }
+    std::shared_ptr<Node> found;
+    traversal::walk(start, [&](Node& node, size_t level) {
+        if (level == 0 || !matches(node)) return Action::Continue;
+        found = node.shared_from_this();
+        return Action::Stop;
+    }, traversal::Order::PreOrder, depth);
+    return found;
+}
+
+std::vector<std::shared_ptr<Node>> NodeQuery::all(Node& start, size_t depth) const {
+    std::vector<std::shared_ptr<Node>> found;
+    if (auto candidates = indexedCandidates(start, depth)) {
+        for (Node* candidate : *candidates) {
+            if (matches(*candidate)) {
+                found.push_back(candidate->shared_from_this());
+            }
+        }
+        return found;
+    }
+    traversal::walk(start, [&](Node& node, size_t level) {
+        if (level > 0 && matches(node)) {
+            found.push_back(node.shared_from_this());
+        }
+    }, traversal::Order::PreOrder, depth);
+    return found;
+}
+
+std::vector<std::shared_ptr<Node>> NodeQuery::allParallel(
+    Node& start,
+    size_t depth,
+    size_t threads,
+    size_t grainSize) const {
+
+    if (indexedCandidates(start, depth)) {
+        return all(start, depth);
+    }
+
+    // count nodes only as far as needed to know how many workers they keep busy
+    utils::ThreadPool& pool = utils::ThreadPool::shared();
+    size_t workers = threads == 0 ? pool.threads() : std::min(threads, pool.threads());
+    grainSize = std::max<size_t>(grainSize, 1);
+    const size_t countLimit = workers * grainSize;
+    size_t counted = 0;
+    traversal::walk(start, [&](Node&, size_t level) {
+        if (level == 0) return Action::Continue;
+        return ++counted < countLimit ? Action::Continue : Action::Stop;
+    }, traversal::Order::PreOrder, depth);
+    workers = std::min(workers, counted / grainSize);
+    if (workers <= 1) {
+        return all(start, depth);
+    }
+
+    // tasks in pre-order: a split subtree becomes its root alone followed by its child subtrees
+    std::vector<SearchTask> tasks;
+    for (const auto& child : start.children()) {
+        tasks.push_back({child.get(), 1, true});
+    }
+    for (size_t split = 1; split < kMaxSplitLevels && tasks.size() < workers * kTasksPerWorker; ++split) {
+        std::vector<SearchTask> finer;
+        finer.reserve(tasks.size());
+        for (const SearchTask& task : tasks) {
+            if (!task.wholeSubtree || task.level >= depth || !task.node->hasChildren()) {
+                finer.push_back(task);
+                continue;
+            }
+            finer.push_back({task.node, task.level, false});
+            for (const auto& child : task.node->children()) {
+                finer.push_back({child.get(), task.level + 1, true});
+            }
+        }
+        tasks.swap(finer);
+    }
+
+    std::vector<std::vector<Node*>> found(tasks.size());
+    std::vector<std::exception_ptr> errors(tasks.size());
+    std::atomic<size_t> next{0};
+    pool.parallelFor(workers, 1, [&](size_t, size_t) {
+        traversal::Walker walker;
+        for (size_t index = next++; index < tasks.size(); index = next++) {
+            const SearchTask& task = tasks[index];
+            std::vector<Node*>& taskFound = found[index];
+            try {
+                if (!task.wholeSubtree) {
+                    if (matches(*task.node)) {
+                        taskFound.push_back(task.node);
+                    }
+                    continue;
+                }
+                walker.walk(*task.node, [&](Node& node) {
+                    if (matches(node)) {
+                        taskFound.push_back(&node);
+                    }
+                }, traversal::Order::PreOrder, depth - task.level);
+            } catch (...) {
+                errors[index] = std::current_exception();
+            }
+        }
+    }, workers);
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    size_t total = 0;
+    for (const auto& taskFound : found) {
+        total += taskFound.size();
+    }
+    std::vector<std::shared_ptr<Node>> result;
+    result.reserve(total);
+    for (const auto& taskFound : found) {
+        for (Node* node : taskFound) {
+            result.push_back(node->shared_from_this());
+        }
+    }
+    return result;
+}
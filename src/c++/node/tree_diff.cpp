@@ -0,0 +1,257 @@
+#include "node/tree_diff.hpp"
+#include "node/navigation.hpp"
+#include "node/node.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+/** A node of the compared tree, its counterpart, and its path in the patched tree. */
+struct PairToCompare {
+    const Node* before;
+    const Node* after;
+    std::string path;
+};
+
+std::string childPath(const std::string& parentPath, const std::string& name) {
+    return parentPath.empty() ? name : parentPath + "/" + name;
+}
+
+std::shared_ptr<Node> resolve(Node& root, const std::string& path) {
+    std::shared_ptr<Node> node = root.selfPtr();
+    if (!node) {
+        throw std::runtime_error("TreePatch::apply: Stack-allocated nodes are not supported");
+    }
+    size_t begin = 0;
+    while (node && begin < path.size()) {
+        size_t end = path.find('/', begin);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        node = node->pick().childByName(path.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    if (!node) {
+        throw std::runtime_error("TreePatch::apply: no node at path '" + path + "'");
+    }
+    return node;
+}
+
+} // namespace
+
+TreePatch TreePatch::diff(
+    const Node& before,
+    const Node& after,
+    double relativeTolerance,
+    double absoluteTolerance) {
+
+    TreePatch patch;
+    std::vector<Change>& changes = patch._changes;
+    if (before.name() != after.name()) {
+        changes.push_back({Kind::Renamed, "", after.name(), 0, nullptr, nullptr});
+    }
+
+    std::vector<PairToCompare> pending;
+    pending.push_back({&before, &after, ""});
+    while (!pending.empty()) {
+        PairToCompare pair = std::move(pending.back());
+        pending.pop_back();
+        if (pair.before == pair.after) {
+            continue;
+        }
+        const Node& a = *pair.before;
+        const Node& b = *pair.after;
+
+        if (a.type() != b.type()) {
+            changes.push_back({Kind::Retyped, pair.path, b.type(), 0, nullptr, nullptr});
+        }
+        // placeholders of lazily read payloads are compared as stored, loading only what they must
+        const Data& dataBefore = a.data();
+        const Data& dataAfter = b.data();
+        if (&dataBefore != &dataAfter && !dataBefore.isCloseTo(dataAfter, relativeTolerance, absoluteTolerance)) {
+            changes.push_back({Kind::DataChanged, pair.path, "", 0, nullptr, b.dataPtr()});
+        }
+
+        // pair children by name, then unpaired ones of the same type as renames
+        const auto& childrenBefore = a.children();
+        const auto& childrenAfter = b.children();
+        std::unordered_map<std::string_view, size_t> indexByName;
+        indexByName.reserve(childrenBefore.size());
+        for (size_t i = 0; i < childrenBefore.size(); ++i) {
+            indexByName.emplace(childrenBefore[i]->name(), i);
+        }
+        constexpr size_t unpaired = std::numeric_limits<size_t>::max();
+        std::vector<size_t> counterpart(childrenAfter.size(), unpaired);
+        std::vector<bool> pairedBefore(childrenBefore.size(), false);
+        for (size_t j = 0; j < childrenAfter.size(); ++j) {
+            auto found = indexByName.find(childrenAfter[j]->name());
+            if (found != indexByName.end() && !pairedBefore[found->second]) {
+                counterpart[j] = found->second;
+                pairedBefore[found->second] = true;
+            }
+        }
+        std::vector<bool> renamed(childrenAfter.size(), false);
+        for (size_t j = 0, i = 0; j < childrenAfter.size(); ++j) {
+            if (counterpart[j] != unpaired) {
+                continue;
+            }
+            for (size_t k = i; k < childrenBefore.size(); ++k) {
+                if (!pairedBefore[k] && childrenBefore[k]->type() == childrenAfter[j]->type()) {
+                    counterpart[j] = k;
+                    pairedBefore[k] = true;
+                    renamed[j] = true;
+                    i = k + 1;
+                    break;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < childrenBefore.size(); ++i) {
+            if (!pairedBefore[i]) {
+                changes.push_back({Kind::Removed, childPath(pair.path, childrenBefore[i]->name()), "", 0, nullptr, nullptr});
+            }
+        }
+        const size_t firstPending = pending.size();
+        for (size_t j = 0; j < childrenAfter.size(); ++j) {
+            const Node& child = *childrenAfter[j];
+            if (counterpart[j] == unpaired) {
+                changes.push_back({Kind::Added, pair.path, "", j, childrenAfter[j], nullptr});
+                continue;
+            }
+            const Node& childBefore = *childrenBefore[counterpart[j]];
+            if (renamed[j]) {
+                changes.push_back({Kind::Renamed, childPath(pair.path, childBefore.name()), child.name(), 0, nullptr, nullptr});
+            }
+            pending.push_back({&childBefore, &child, childPath(pair.path, child.name())});
+        }
+        // compare the children in order once this level is recorded
+        std::reverse(pending.begin() + static_cast<std::ptrdiff_t>(firstPending), pending.end());
+    }
+    return patch;
+}
+
+const std::vector<TreePatch::Change>& TreePatch::changes() const {
+    return _changes;
+}
+
+bool TreePatch::empty() const {
+    return _changes.empty();
+}
+
+size_t TreePatch::size() const {
+    return _changes.size();
+}
+
+void TreePatch::apply(Node& root) const {
+    for (const Change& change : _changes) {
+        std::shared_ptr<Node> node = resolve(root, change.path);
+        switch (change.kind) {
+            case Kind::Added: {
+                const size_t count = node->children().size();
+                const bool append = change.position >= count
+                    || change.position > static_cast<size_t>(std::numeric_limits<int16_t>::max());
+                change.subtree->copy()->attachTo(node, append ? -1 : static_cast<int16_t>(change.position));
+                break;
+            }
+            case Kind::Removed:
+                node->detach();
+                break;
+            case Kind::Renamed:
+                node->setName(change.value);
+                break;
+            case Kind::Retyped:
+                node->setType(change.value);
+                break;
+            case Kind::DataChanged:
+                node->setData(change.data);
+                break;
+        }
+    }
+}
+
+const char* TreePatch::kindName(Kind kind) {
+    switch (kind) {
+        case Kind::Added: return "Added";
+        case Kind::Removed: return "Removed";
+        case Kind::Renamed: return "Renamed";
+        case Kind::Retyped: return "Retyped";
+        case Kind::DataChanged: return "DataChanged";
+    }
+    return "";
+}
+
+std::shared_ptr<Node> TreePatch::toNode() const {
+    auto patchNode = std::make_shared<Node>("TreePatch", "UserDefinedData_t");
+    for (size_t i = 0; i < _changes.size(); ++i) {
+        const Change& change = _changes[i];
+        auto changeNode = std::make_shared<Node>("Change." + std::to_string(i), kindName(change.kind));
+        changeNode->setData("/" + change.path);
+        changeNode->attachTo(patchNode);
+
+        if (change.kind == Kind::Renamed || change.kind == Kind::Retyped) {
+            auto value = std::make_shared<Node>("Value", "DataArray_t");
+            value->setData(change.value);
+            value->attachTo(changeNode);
+        } else if (change.kind == Kind::Added) {
+            auto position = std::make_shared<Node>("Position", "DataArray_t");
+            position->setData(static_cast<int64_t>(change.position));
+            position->attachTo(changeNode);
+            auto subtree = std::make_shared<Node>("Subtree", "UserDefinedData_t");
+            subtree->attachTo(changeNode);
+            change.subtree->copy()->attachTo(subtree);
+        } else if (change.kind == Kind::DataChanged) {
+            auto data = std::make_shared<Node>("Data", "DataArray_t");
+            data->setData(change.data);
+            data->attachTo(changeNode);
+        }
+    }
+    return patchNode;
+}
+
+TreePatch TreePatch::fromNode(const Node& node) {
+    auto child = [](const Node& changeNode, const std::string& name) {
+        std::shared_ptr<Node> found = changeNode.pick().childByName(name);
+        if (!found) {
+            throw std::runtime_error("TreePatch::fromNode: change '" + changeNode.name()
+                + "' has no child '" + name + "'");
+        }
+        return found;
+    };
+
+    TreePatch patch;
+    for (const auto& changeNode : node.children()) {
+        Change change{};
+        const std::string& type = changeNode->type();
+        if (type == "Added") change.kind = Kind::Added;
+        else if (type == "Removed") change.kind = Kind::Removed;
+        else if (type == "Renamed") change.kind = Kind::Renamed;
+        else if (type == "Retyped") change.kind = Kind::Retyped;
+        else if (type == "DataChanged") change.kind = Kind::DataChanged;
+        else throw std::runtime_error("TreePatch::fromNode: unknown change kind '" + type + "'");
+
+        change.path = changeNode->data().extractString();
+        if (!change.path.empty() && change.path.front() == '/') {
+            change.path.erase(0, 1);
+        }
+        if (change.kind == Kind::Renamed || change.kind == Kind::Retyped) {
+            change.value = child(*changeNode, "Value")->data().extractString();
+        } else if (change.kind == Kind::Added) {
+            change.position = static_cast<size_t>(child(*changeNode, "Position")->data().itemAsInt64({0}));
+            const auto& subtrees = child(*changeNode, "Subtree")->children();
+            if (subtrees.size() != 1) {
+                throw std::runtime_error("TreePatch::fromNode: change '" + changeNode->name()
+                    + "' should hold one added subtree");
+            }
+            change.subtree = subtrees.front();
+        } else if (change.kind == Kind::DataChanged) {
+            change.data = child(*changeNode, "Data")->dataPtr();
+        }
+        patch._changes.push_back(std::move(change));
+    }
+    return patch;
+}
@@ -0,0 +1,95 @@
+# ifndef TREE_DIFF_PYBIND_HPP
+# define TREE_DIFF_PYBIND_HPP
+
+# include <pybind11/pybind11.h>
+# include <pybind11/stl.h>
+
+# include "node/node.hpp"
+# include "node/tree_diff.hpp"
+
+namespace py = pybind11;
+
+void bindTreePatch(py::module_ &m) {
+    py::class_<TreePatch> treePatch(
+        m,
+        "TreePatch",
+        R"doc(
+Structural difference between two trees, applicable to the first to obtain the second.
+
+Built by :py:meth:`TreePatch.diff` (or :py:meth:`Node.diff`). Children are
+paired by name, and a removed and an added child of the same type are
+recorded as a rename. Payloads shared by both trees are not compared, and
+numeric payloads are compared element-wise on their typed buffers, up to the
+given tolerances.
+
+See C++ counterpart: :ref:`cpp-node-treepatch`.
+
+Example
+-------
+.. literalinclude:: ../../../tests/python/node/test_node.py
+   :language: python
+   :start-after: # docs:start tree_diff_example
+   :end-before: # docs:end tree_diff_example
+   :dedent: 4
+)doc");
+
+    py::enum_<TreePatch::Kind>(treePatch, "Kind", "What a change does to the node at its path.")
+        .value("Added", TreePatch::Kind::Added)
+        .value("Removed", TreePatch::Kind::Removed)
+        .value("Renamed", TreePatch::Kind::Renamed)
+        .value("Retyped", TreePatch::Kind::Retyped)
+        .value("DataChanged", TreePatch::Kind::DataChanged);
+
+    py::class_<TreePatch::Change>(treePatch, "Change", R"doc(
+One change of a :py:class:`TreePatch`; fields not used by its kind are empty.
+
+``path`` is relative to the patched root (empty for the root itself), and
+is the parent path for ``Added`` changes.
+)doc")
+        .def_readonly("kind", &TreePatch::Change::kind)
+        .def_readonly("path", &TreePatch::Change::path)
+        .def_readonly("value", &TreePatch::Change::value, "new name (Renamed) or type (Retyped)")
+        .def_readonly("position", &TreePatch::Change::position, "position among the children (Added)")
+        .def_readonly("subtree", &TreePatch::Change::subtree, "added subtree (Added)")
+        .def_readonly("data", &TreePatch::Change::data, "new payload (DataChanged)");
+
+    treePatch
+        .def_static("diff", &TreePatch::diff, R"doc(
+Changes turning ``before`` into ``after``.
+
+Parameters
+----------
+before : Node
+    Root of the tree the patch applies to.
+after : Node
+    Root of the tree the patch rebuilds.
+relative_tolerance : float, optional
+    Relative tolerance on numeric payloads. Defaults to 0.
+absolute_tolerance : float, optional
+    Absolute tolerance on numeric payloads. Defaults to 0.
+
+Returns
+-------
+TreePatch
+)doc",
+            py::arg("before"),
+            py::arg("after"),
+            py::arg("relative_tolerance")=0.0,
+            py::arg("absolute_tolerance")=0.0)
+        .def("changes", &TreePatch::changes, "Changes in replay order.")
+        .def("empty", &TreePatch::empty, "True when the compared trees are equal.")
+        .def("__len__", &TreePatch::size)
+        .def("apply", &TreePatch::apply, R"doc(
+Replay the changes on the tree rooted at ``root``, in place.
+
+Raises ``RuntimeError`` when a path does not lead to a node of the tree.
+)doc",
+            py::arg("root"))
+        .def("to_node", &TreePatch::toNode, R"doc(
+The patch as a tree, to be written with :py:meth:`Node.write` and read back
+with :py:meth:`TreePatch.from_node`.
+)doc")
+        .def_static("from_node", &TreePatch::fromNode, "Patch encoded by to_node.", py::arg("node"));
+}
+
+# endif
@@ -0,0 +1,311 @@
+#include "node/tree_index.hpp"
+#include "node/node.hpp"
+#include "node/traversal.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/** @brief Last label of the owner range, leaving room for ``last + 1`` without overflow. */
+constexpr std::uint64_t kLastLabel = std::numeric_limits<std::uint64_t>::max() / 2;
+
+/** @brief An attached subtree takes this fraction of the free labels around it. */
+constexpr std::uint64_t kFreeLabelShare = 16;
+
+} // namespace
+
+TreeIndex::TreeIndex(Node& owner) : _owner(owner) {
+    checkInsertable(owner);
+    insertSubtree(owner);
+}
+
+Node& TreeIndex::owner() const {
+    return _owner;
+}
+
+size_t TreeIndex::size() const {
+    return _entries.size();
+}
+
+std::vector<Node*> TreeIndex::byName(const Node& start, const std::string& name, size_t depth) const {
+    auto found = _byName.find(name);
+    if (found == _byName.end()) {
+        return {};
+    }
+    return below(found->second, start, depth);
+}
+
+std::vector<Node*> TreeIndex::byType(const Node& start, const std::string& type, size_t depth) const {
+    auto found = _byType.find(type);
+    if (found == _byType.end()) {
+        return {};
+    }
+    return below(found->second, start, depth);
+}
+
+Node* TreeIndex::atPath(const std::string& path) const {
+    auto [first, last] = _byPath.equal_range(path);
+    if (first == last || std::next(first) != last) {
+        return nullptr;
+    }
+    return first->second;
+}
+
+void TreeIndex::checkInsertable(Node& subtreeRoot) {
+    traversal::walk(subtreeRoot, [](Node& node) {
+        if (node._ownedIndex) {
+            throw std::runtime_error("TreeIndex: node '" + node.path()
+                                     + "' owns a tree index; disable it before indexing it from an ancestor");
+        }
+    });
+}
+
+void TreeIndex::insertSubtree(Node& subtreeRoot) {
+    std::string prefix;
+    size_t firstLevel = 0;
+    if (&subtreeRoot != &_owner) {
+        const Entry& parentEntry = _entries.at(subtreeRoot._parent.lock().get());
+        prefix = parentEntry.path + "/";
+        firstLevel = parentEntry.level + 1;
+    }
+    std::vector<std::string> pathByLevel;
+    size_t inserted = 0;
+    traversal::walk(subtreeRoot, [&](Node& node, size_t level) {
+        std::string path = level == 0 ? prefix + node.name() : pathByLevel[level - 1] + "/" + node.name();
+        pathByLevel.resize(level + 1);
+        insert(node, path, firstLevel + level);
+        pathByLevel[level] = std::move(path);
+        ++inserted;
+    });
+
+    if (&subtreeRoot == &_owner) {
+        label(_owner, 0, kLastLabel);
+    } else {
+        place(subtreeRoot, inserted);
+    }
+}
+
+void TreeIndex::removeSubtree(Node& subtreeRoot) {
+    traversal::walk(subtreeRoot, [this](Node& node) {
+        erase(node);
+    });
+}
+
+void TreeIndex::rename(Node& node, const std::string& oldName) {
+    const Entry& entry = _entries.at(&node);
+    eraseFrom(_byName, oldName, entry.first);
+    _byName[node.name()].emplace(entry.first, &node);
+
+    const std::string& oldPath = entry.path;
+    const size_t parentPathLength = oldPath.size() - oldName.size();
+    updatePaths(node, oldPath.substr(0, parentPathLength) + node.name());
+}
+
+void TreeIndex::retype(Node& node, const std::string& oldType) {
+    const Entry& entry = _entries.at(&node);
+    eraseFrom(_byType, oldType, entry.first);
+    _byType[node.type()].emplace(entry.first, &node);
+}
+
+void TreeIndex::reorder(Node& parent) {
+    const Entry& entry = _entries.at(&parent);
+    label(parent, entry.first, entry.last);
+}
+
+void TreeIndex::release() {
+    for (auto& [node, entry] : _entries) {
+        const_cast<Node*>(node)->_treeIndex = nullptr;
+    }
+    _entries.clear();
+    _byName.clear();
+    _byType.clear();
+    _byPath.clear();
+}
+
+void TreeIndex::insert(Node& node, const std::string& path, size_t level) {
+    node._treeIndex = this;
+    Entry& entry = _entries[&node];
+    entry.path = path;
+    entry.level = level;
+    _byPath.emplace(path, &node);
+}
+
+void TreeIndex::erase(Node& node) {
+    auto entry = _entries.find(&node);
+    if (entry == _entries.end()) {
+        return;
+    }
+    if (entry->second.isLabeled) {
+        eraseFrom(_byName, node.name(), entry->second.first);
+        eraseFrom(_byType, node.type(), entry->second.first);
+    }
+    auto [first, last] = _byPath.equal_range(entry->second.path);
+    for (auto it = first; it != last; ++it) {
+        if (it->second == &node) {
+            _byPath.erase(it);
+            break;
+        }
+    }
+    _entries.erase(entry);
+    node._treeIndex = nullptr;
+}
+
+void TreeIndex::updatePaths(Node& subtreeRoot, const std::string& path) {
+    const std::string oldRootPath = _entries.at(&subtreeRoot).path;
+    traversal::walk(subtreeRoot, [&](Node& node) {
+        Entry& entry = _entries.at(&node);
+        auto [first, last] = _byPath.equal_range(entry.path);
+        for (auto it = first; it != last; ++it) {
+            if (it->second == &node) {
+                _byPath.erase(it);
+                break;
+            }
+        }
+        entry.path = path + entry.path.substr(oldRootPath.size());
+        _byPath.emplace(entry.path, &node);
+    });
+}
+
+void TreeIndex::place(Node& subtreeRoot, size_t size) {
+    // the free labels between the ranges of the previous and next siblings
+    Node& parent = *subtreeRoot._parent.lock();
+    const Entry& parentEntry = _entries.at(&parent);
+    const auto& siblings = parent._children;
+    const size_t position = siblings.back().get() == &subtreeRoot ? siblings.size() - 1 : subtreeRoot.position();
+    const std::uint64_t first = position > 0
+        ? _entries.at(siblings[position - 1].get()).last + 1
+        : parentEntry.first + 1;
+    const std::uint64_t last = position + 1 < siblings.size()
+        ? _entries.at(siblings[position + 1].get()).first - 1
+        : parentEntry.last;
+    const std::uint64_t freeLabels = first <= last ? last - first + 1 : 0;
+    const std::uint64_t width = freeLabels / kFreeLabelShare;
+    if (width >= size) {
+        // appended subtrees take the start of the free labels, prepended ones
+        // their end and others their middle, leaving room for the next ones
+        std::uint64_t start = first + (freeLabels - width) / 2;
+        if (position + 1 == siblings.size()) {
+            start = first;
+        } else if (position == 0) {
+            start = last - width + 1;
+        }
+        label(subtreeRoot, start, start + width - 1);
+        return;
+    }
+
+    // label again the smallest enclosing subtree whose range is twice its size
+    for (Node* ancestor = &parent;; ancestor = ancestor->_parent.lock().get()) {
+        size_t subtreeSize = 0;
+        traversal::walk(*ancestor, [&subtreeSize](Node&) {
+            ++subtreeSize;
+        });
+        const Entry& entry = _entries.at(ancestor);
+        if (ancestor == &_owner || (entry.last - entry.first) / 2 >= subtreeSize) {
+            label(*ancestor, entry.first, entry.last);
+            return;
+        }
+    }
+}
+
+void TreeIndex::label(Node& subtreeRoot, std::uint64_t first, std::uint64_t last) {
+    Entry& rootEntry = _entries.at(&subtreeRoot);
+    if (subtreeRoot._children.empty()) {
+        if (rootEntry.isLabeled) {
+            eraseFrom(_byName, subtreeRoot.name(), rootEntry.first);
+            eraseFrom(_byType, subtreeRoot.type(), rootEntry.first);
+        }
+        rootEntry.first = first;
+        rootEntry.last = last;
+        rootEntry.isLabeled = true;
+        _byName[subtreeRoot.name()].emplace(first, &subtreeRoot);
+        _byType[subtreeRoot.type()].emplace(first, &subtreeRoot);
+        return;
+    }
+
+    // the subtree in pre-order, with the size of the subtree of each node
+    std::vector<Node*> nodes;
+    std::vector<size_t> sizes;
+    std::vector<size_t> open;
+    traversal::walk(subtreeRoot, [&](Node& node, size_t level) {
+        while (open.size() > level) {
+            sizes[open.back()] = nodes.size() - open.back();
+            open.pop_back();
+        }
+        open.push_back(nodes.size());
+        nodes.push_back(&node);
+        sizes.push_back(1);
+    });
+    for (size_t index : open) {
+        sizes[index] = nodes.size() - index;
+    }
+
+    for (Node* node : nodes) {
+        Entry& entry = _entries.at(node);
+        if (entry.isLabeled) {
+            eraseFrom(_byName, node->name(), entry.first);
+            eraseFrom(_byType, node->type(), entry.first);
+        }
+    }
+
+    rootEntry.first = first;
+    rootEntry.last = last;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        Entry& entry = _entries.at(nodes[i]);
+        entry.isLabeled = true;
+        _byName[nodes[i]->name()].emplace(entry.first, nodes[i]);
+        _byType[nodes[i]->type()].emplace(entry.first, nodes[i]);
+
+        // children share the labels after the node's own in proportion to
+        // their sizes; a quarter of the spare labels is left free between
+        // them and a quarter after the last one, where nodes are mostly added
+        const std::uint64_t needed = sizes[i] - 1;
+        if (needed == 0) {
+            continue;
+        }
+        size_t childCount = 0;
+        for (size_t child = i + 1; child < i + sizes[i]; child += sizes[child]) {
+            ++childCount;
+        }
+        const std::uint64_t spare = entry.last - entry.first - needed;
+        const std::uint64_t gap = spare / 4 / childCount;
+        const std::uint64_t labelsPerNode = 1 + spare / 2 / needed;
+        std::uint64_t cursor = entry.first + 1 + gap;
+        for (size_t child = i + 1; child < i + sizes[i]; child += sizes[child]) {
+            Entry& childEntry = _entries.at(nodes[child]);
+            childEntry.first = cursor;
+            childEntry.last = cursor + sizes[child] * labelsPerNode - 1;
+            cursor = childEntry.last + 1 + gap;
+        }
+    }
+}
+
+std::vector<Node*> TreeIndex::below(
+    const NodesByLabel& candidates,
+    const Node& start,
+    size_t depth) const {
+
+    const Entry& startEntry = _entries.at(&start);
+    std::vector<Node*> nodes;
+    for (auto it = candidates.upper_bound(startEntry.first);
+         it != candidates.end() && it->first <= startEntry.last; ++it) {
+        if (_entries.at(it->second).level - startEntry.level <= depth) {
+            nodes.push_back(it->second);
+        }
+    }
+    return nodes;
+}
+
+void TreeIndex::eraseFrom(
+    std::unordered_map<std::string, NodesByLabel>& map,
+    const std::string& key,
+    std::uint64_t label) {
+    auto found = map.find(key);
+    if (found == map.end()) {
+        return;
+    }
+    found->second.erase(label);
+    if (found->second.empty()) {
+        map.erase(found);
+    }
+}
@@ -31,4 +31,72 @@ std::string utils::clipStringIfTooLong(const std::string& longString, const size
     clippedString.append(longString.substr(longString.length() - secondHalfLength));
 
     return clippedString;
-}
\ No newline at end of file
+}
+
+std::string utils::globToRegexPattern(const std::string& globPattern) {
+    std::string regexPattern;
+    regexPattern.reserve(globPattern.size() * 2 + 2);
+    regexPattern += "^";
+
+    for (char c : globPattern) {
+        switch (c) {
+            case '*':
+                regexPattern += ".*";
+                break;
+            case '?':
+                regexPattern += ".";
+                break;
+            case '.':
+            case '^':
+            case '$':
+            case '+':
+            case '(':
+            case ')':
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case '|':
+            case '\\':
+                regexPattern += "\\";
+                regexPattern += c;
+                break;
+            default:
+                regexPattern += c;
+                break;
+        }
+    }
+
+    regexPattern += "$";
+    return regexPattern;
+}
+
+bool utils::globMatch(std::string_view text, std::string_view globPattern) {
+    size_t t = 0;
+    size_t p = 0;
+    // position of the last '*' seen and of the text it was first tried against
+    size_t starPattern = std::string_view::npos;
+    size_t starText = 0;
+
+    while (t < text.size()) {
+        if (p < globPattern.size() && (globPattern[p] == '?' || globPattern[p] == text[t])
+            && globPattern[p] != '*') {
+            ++t;
+            ++p;
+        } else if (p < globPattern.size() && globPattern[p] == '*') {
+            starPattern = p++;
+            starText = t;
+        } else if (starPattern != std::string_view::npos) {
+            // let the last '*' absorb one more character and retry
+            p = starPattern + 1;
+            t = ++starText;
+        } else {
+            return false;
+        }
+    }
+
+    while (p < globPattern.size() && globPattern[p] == '*') {
+        ++p;
+    }
+    return p == globPattern.size();
+}
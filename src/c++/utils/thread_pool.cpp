@@ -0,0 +1,174 @@
+# include "utils/thread_pool.hpp"
+
+# include <algorithm>
+# include <atomic>
+# include <cstdlib>
+# include <exception>
+# include <stdexcept>
+# include <string>
+
+namespace {
+
+// set on the workers and on callers running tasks: loops started there run inline
+thread_local bool insideTask = false;
+
+size_t threadsFromEnvironment() {
+    const char* value = std::getenv("NODER_NUM_THREADS");
+    if (value == nullptr) {
+        return 0;
+    }
+    char* end = nullptr;
+    const unsigned long long threads = std::strtoull(value, &end, 10);
+    return end != value && *end == '\0' ? static_cast<size_t>(threads) : 0;
+}
+
+} // namespace
+
+namespace utils {
+
+size_t hardwareThreads() {
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+/** Ranges of one parallelFor() call, claimed one at a time by the threads running them. */
+struct ThreadPool::Loop {
+    const std::function<void(size_t, size_t)>& task;
+    const size_t count;
+    const size_t tasks;
+    std::atomic<size_t> next{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t done = 0;
+    std::exception_ptr error;
+
+    Loop(const std::function<void(size_t, size_t)>& loopTask, size_t loopCount, size_t loopTasks) noexcept
+        : task(loopTask), count(loopCount), tasks(loopTasks) {}
+
+    void runTasks() {
+        for (size_t index = next++; index < tasks; index = next++) {
+            std::exception_ptr taskError;
+            try {
+                task(count * index / tasks, count * (index + 1) / tasks);
+            } catch (...) {
+                taskError = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (taskError && !error) {
+                error = taskError;
+            }
+            if (++done == tasks) {
+                finished.notify_all();
+            }
+        }
+    }
+};
+
+ThreadPool::ThreadPool(size_t threads) {
+    setThreads(threads);
+}
+
+ThreadPool::~ThreadPool() {
+    stopWorkers();
+}
+
+ThreadPool& ThreadPool::shared() {
+    // never destroyed: joining threads while the library unloads can deadlock
+    static ThreadPool* pool = new ThreadPool(threadsFromEnvironment());
+    return *pool;
+}
+
+size_t ThreadPool::threads() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _workers.size() + 1;
+}
+
+void ThreadPool::setThreads(size_t threads) {
+    if (insideTask) {
+        throw std::logic_error("utils::ThreadPool::setThreads: cannot resize the pool from one of its tasks");
+    }
+    std::lock_guard<std::mutex> resizing(_resizing);
+    stopWorkers();
+    const size_t workers = (threads == 0 ? hardwareThreads() : threads) - 1;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = false;
+    _workers.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        _workers.emplace_back([this]() { work(); });
+    }
+}
+
+void ThreadPool::parallelFor(
+    size_t count,
+    size_t minimumPerTask,
+    const std::function<void(size_t, size_t)>& task,
+    size_t maximumTasks) {
+
+    if (count == 0) {
+        return;
+    }
+    size_t tasks = std::min(threads(), count / std::max<size_t>(minimumPerTask, 1));
+    if (maximumTasks != 0) {
+        tasks = std::min(tasks, maximumTasks);
+    }
+    if (tasks <= 1 || insideTask) {
+        task(0, count);
+        return;
+    }
+
+    auto loop = std::make_shared<Loop>(task, count, tasks);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _loops.push_back(loop);
+    }
+    _wakeUp.notify_all();
+
+    // the caller takes ranges too, and finishes alone if the workers are busy elsewhere
+    insideTask = true;
+    loop->runTasks();
+    insideTask = false;
+    {
+        std::unique_lock<std::mutex> lock(loop->mutex);
+        loop->finished.wait(lock, [&loop]() { return loop->done == loop->tasks; });
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _loops.erase(std::remove(_loops.begin(), _loops.end(), loop), _loops.end());
+    }
+    if (loop->error) {
+        std::rethrow_exception(loop->error);
+    }
+}
+
+void ThreadPool::work() {
+    insideTask = true;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _wakeUp.wait(lock, [this]() { return _stopping || !_loops.empty(); });
+        if (_stopping) {
+            return;
+        }
+        const std::shared_ptr<Loop> loop = _loops.front();
+        if (loop->next.load() >= loop->tasks) {
+            _loops.pop_front();
+            continue;
+        }
+        lock.unlock();
+        loop->runTasks();
+        lock.lock();
+    }
+}
+
+void ThreadPool::stopWorkers() {
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        workers.swap(_workers);
+    }
+    _wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace utils
@@ -24,6 +24,9 @@ __all__ = [
     # Factory utilities
     "factory",
     "registerDefaultFactory",
+    # Thread pool of array operations
+    "setThreadPoolSize",
+    "threadPoolSize",
     # Convenience functions
     "new_node",
     "zeros",
@@ -44,6 +47,8 @@ __all__ = [
 
 from .core import (
     registerDefaultFactory,
+    setThreadPoolSize,
+    threadPoolSize,
     factory,
     Node,
     Array,
@@ -5,6 +5,8 @@ import typing
 
 from .core import (
     registerDefaultFactory,
+    setThreadPoolSize,
+    threadPoolSize,
     factory,
     Node,
     Array,
@@ -24,6 +26,8 @@ __all__: list[str] = [
     "Zone",
     "factory",
     "registerDefaultFactory",
+    "setThreadPoolSize",
+    "threadPoolSize",
     "new_node",
     "zeros",
     "new_base",
@@ -38,6 +38,8 @@ class Base(noder.core.Node):
         ...
     def physical_dimension(self) -> int:
         ...
+    def reduce_field(self, field_name: str, reduction: noder.core.Data.Reduction, container: str = 'FlowSolution', skip_nan: bool = False) -> float:
+        ...
     def remove_empty_zones(self) -> None:
         ...
     def set_cell_dimension(self, cell_dimension: typing.SupportsInt | typing.SupportsIndex) -> None:
@@ -89,6 +91,8 @@ class Tree(noder.core.Node):
         ...
     def number_of_zones(self) -> int:
         ...
+    def reduce_field(self, field_name: str, reduction: noder.core.Data.Reduction, container: str = 'FlowSolution', skip_nan: bool = False) -> float:
+        ...
     def remove_empty_zones(self) -> None:
         ...
     def set_unique_base_names(self) -> None:
@@ -155,6 +159,8 @@ class Zone(noder.core.Node):
         ...
     def number_of_points(self) -> int:
         ...
+    def reduce_field(self, field_name: str, reduction: noder.core.Data.Reduction, container: str = 'FlowSolution', skip_nan: bool = False) -> float:
+        ...
     def remove_fields(self, field_names: typing.Any, container: str = 'FlowSolution') -> None:
         ...
     def shape(self) -> list[int]:
@@ -4,12 +4,14 @@ import numpy
 import typing
 from . import factory
 from . import io
-__all__: list[str] = ['Array', 'Data', 'Navigation', 'Node', 'factory', 'io', 'new_node', 'nodeToPyCGNS', 'pyCGNSToNode', 'registerDefaultFactory']
+__all__: list[str] = ['Array', 'Data', 'Navigation', 'Node', 'TreePatch', 'ValuePredicate', 'factory', 'io', 'new_node', 'nodeToPyCGNS', 'pyCGNSToNode', 'registerDefaultFactory', 'setThreadPoolSize', 'threadPoolSize']
 class Array(Data):
     """
     
     Pure C++ array payload exposed to Python through a NumPy bridge.
     """
+    def __add__(self, arg0: typing.Any) -> typing.Any:
+        ...
     def __getitem__(self, arg0: typing.Any) -> Array:
         ...
     @typing.overload
@@ -18,12 +20,91 @@ class Array(Data):
     @typing.overload
     def __init__(self, arg0: typing.Any) -> None:
         ...
+    def __mul__(self, arg0: typing.Any) -> typing.Any:
+        ...
+    def __radd__(self, arg0: typing.Any) -> typing.Any:
+        ...
     def __repr__(self) -> str:
         ...
+    def __rmul__(self, arg0: typing.Any) -> typing.Any:
+        ...
+    def __rsub__(self, arg0: typing.Any) -> typing.Any:
+        ...
+    def __rtruediv__(self, arg0: typing.Any) -> typing.Any:
+        ...
     def __setitem__(self, arg0: typing.Any, arg1: typing.Any) -> None:
         ...
+    def __sub__(self, arg0: typing.Any) -> typing.Any:
+        ...
+    def __truediv__(self, arg0: typing.Any) -> typing.Any:
+        ...
+    def add(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Add another operand item by item, as ``numpy.add``.
+        
+        Operands of any numeric types and broadcastable shapes are accepted. The
+        result type is promoted as by NumPy 2: Python ints and floats take the type
+        of this array when they fit it, other operands are converted to arrays with
+        their own type. Items are converted by blocks and combined by vectorized
+        kernels, with the GIL released.
+        
+        Parameters
+        ----------
+        other : Array, numpy.ndarray, int or float
+            Second operand.
+        out : Array or numpy.ndarray, optional
+            Array of the broadcast shape receiving the results, instead of a new
+            array. Its type may be wider than the result type, or of a smaller size
+            of the same kind (``same_kind`` casting). It may overlap the operands,
+            so that ``a.add(b, out=a)`` updates ``a`` in place.
+        
+        Returns
+        -------
+        Array
+            The results, or ``out`` when given.
+        
+        Raises
+        ------
+        ValueError
+            For string and None operands, shapes that do not broadcast, and outputs
+            of another shape or of a narrower kind.
+        OverflowError
+            For Python ints out of the bounds of the integer type of this array.
+        
+        Example
+        -------
+        .. literalinclude:: ../../../tests/python/array/test_arithmetic.py
+           :language: python
+           :pyobject: test_operationsWithOutput
+        """
+    def copy(self, order: str = 'A', threads: typing.SupportsInt = 0) -> Array:
+        """
+        Return a deep copy stored contiguously in the requested order.
+        
+        Parameters
+        ----------
+        order : str, optional
+            ``"C"``, ``"F"`` or ``"A"`` (Fortran order when this array is Fortran- but
+            not C-contiguous, C order otherwise). Defaults to ``"A"``.
+        threads : int, optional
+            Maximum number of threads of the shared thread pool sharing large copies;
+            0 uses all of them. Defaults to 0. The GIL is released during the copy.
+        """
     def dimensions(self) -> int:
         ...
+    def divide(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Divide by another operand item by item, as ``numpy.true_divide``.
+        
+        Same operands and ``out`` as :py:meth:`add`. Integers are divided as float64.
+        """
+    def equal(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Test the items of this array and another operand for equality, as ``numpy.equal``.
+        
+        Same operands and ``out`` as :py:meth:`add`. Results are bool, one per
+        item; ``out`` may also be numeric.
+        """
     def extractString(self) -> str:
         ...
     def getFlatIndex(self, arg0: collections.abc.Sequence[typing.SupportsInt | typing.SupportsIndex]) -> int:
@@ -34,6 +115,18 @@ class Array(Data):
         ...
     def getPyArray(self) -> numpy.ndarray:
         ...
+    def greater(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Compare the items of this array to another operand, as ``numpy.greater``.
+        
+        Same operands and ``out`` as :py:meth:`equal`.
+        """
+    def greaterEqual(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Compare the items of this array to another operand, as ``numpy.greater_equal``.
+        
+        Same operands and ``out`` as :py:meth:`equal`.
+        """
     def hasString(self) -> bool:
         ...
     def info(self) -> str:
@@ -48,6 +141,48 @@ class Array(Data):
         ...
     def isScalar(self) -> bool:
         ...
+    def less(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Compare the items of this array to another operand, as ``numpy.less``.
+        
+        Same operands and ``out`` as :py:meth:`equal`.
+        
+        Example
+        -------
+        .. literalinclude:: ../../../tests/python/array/test_arithmetic.py
+           :language: python
+           :pyobject: test_comparisons
+        """
+    def lessEqual(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Compare the items of this array to another operand, as ``numpy.less_equal``.
+        
+        Same operands and ``out`` as :py:meth:`equal`.
+        """
+    def maximum(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Larger of the items of this array and another operand, as ``numpy.maximum``.
+        
+        Same operands and ``out`` as :py:meth:`add`. NaN items are propagated.
+        """
+    def minimum(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Smaller of the items of this array and another operand, as ``numpy.minimum``.
+        
+        Same operands and ``out`` as :py:meth:`add`. NaN items are propagated.
+        """
+    def multiply(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Multiply by another operand item by item, as ``numpy.multiply``.
+        
+        Same operands and ``out`` as :py:meth:`add`.
+        """
+    def notEqual(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Test the items of this array and another operand for inequality, as ``numpy.not_equal``.
+        
+        Same operands and ``out`` as :py:meth:`equal`.
+        """
     def print(self, arg0: typing.SupportsInt | typing.SupportsIndex) -> None:
         ...
     def shape(self) -> list[int]:
@@ -56,6 +191,12 @@ class Array(Data):
         ...
     def strides(self) -> list[int]:
         ...
+    def subtract(self, other: typing.Any, out: typing.Any = None) -> typing.Any:
+        """
+        Subtract another operand item by item, as ``numpy.subtract``.
+        
+        Same operands and ``out`` as :py:meth:`add`. Bool arrays cannot be subtracted.
+        """
 class Data:
     """
     
@@ -66,6 +207,73 @@ class Data:
     
     See C++ counterpart: :ref:`cpp-data-class`.
     """
+    class Reduction:
+        """
+        
+        Reduction computed by :py:meth:`Data.reduce`.
+        
+        ``Sum``, ``Min``, ``Max``, ``Mean`` and ``Norm`` (Euclidean) are typed as in
+        NumPy; ``ArgMin`` and ``ArgMax`` give the C-order flat index of the first
+        extremum; ``Any`` and ``All`` test items against zero; ``Count`` gives the
+        number of items, not counting NaN when they are skipped.
+        
+        Members:
+        
+          Sum
+        
+          Min
+        
+          Max
+        
+          Mean
+        
+          Norm
+        
+          ArgMin
+        
+          ArgMax
+        
+          Any
+        
+          All
+        
+          Count
+        """
+        All: typing.ClassVar[Data.Reduction]  # value = <Reduction.All: 8>
+        Any: typing.ClassVar[Data.Reduction]  # value = <Reduction.Any: 7>
+        ArgMax: typing.ClassVar[Data.Reduction]  # value = <Reduction.ArgMax: 6>
+        ArgMin: typing.ClassVar[Data.Reduction]  # value = <Reduction.ArgMin: 5>
+        Count: typing.ClassVar[Data.Reduction]  # value = <Reduction.Count: 9>
+        Max: typing.ClassVar[Data.Reduction]  # value = <Reduction.Max: 2>
+        Mean: typing.ClassVar[Data.Reduction]  # value = <Reduction.Mean: 3>
+        Min: typing.ClassVar[Data.Reduction]  # value = <Reduction.Min: 1>
+        Norm: typing.ClassVar[Data.Reduction]  # value = <Reduction.Norm: 4>
+        Sum: typing.ClassVar[Data.Reduction]  # value = <Reduction.Sum: 0>
+        __members__: typing.ClassVar[dict[str, Data.Reduction]]  # value = {'Sum': <Reduction.Sum: 0>, 'Min': <Reduction.Min: 1>, 'Max': <Reduction.Max: 2>, 'Mean': <Reduction.Mean: 3>, 'Norm': <Reduction.Norm: 4>, 'ArgMin': <Reduction.ArgMin: 5>, 'ArgMax': <Reduction.ArgMax: 6>, 'Any': <Reduction.Any: 7>, 'All': <Reduction.All: 8>, 'Count': <Reduction.Count: 9>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt | typing.SupportsIndex) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt | typing.SupportsIndex) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
     def extractString(self) -> str:
         """
         Extract the payload as a Python string.
@@ -135,6 +343,58 @@ class Data:
            :language: python
            :pyobject: test_isScalar
         """
+    def reduce(self, reduction: Data.Reduction, axis: typing.SupportsInt | typing.SupportsIndex | None = None, skipNaN: bool = False) -> Data:
+        """
+        Reduce the numeric elements of this payload, or its slices along an axis.
+        
+        Contiguous runs go through vectorized kernels, floating-point sums are
+        pairwise or compensated, and large payloads are shared between the threads
+        of the shared pool (see :py:func:`noder.core.setThreadPoolSize`).
+        
+        Parameters
+        ----------
+        reduction : Data.Reduction
+            Reduction to compute.
+        axis : int, optional
+            Axis reduced away. Defaults to None, which reduces every element into a
+            payload of shape ``(1,)``.
+        skipNaN : bool, optional
+            Ignore NaN elements, like ``numpy.nansum`` and its siblings, instead of
+            propagating them. Defaults to False.
+        
+        Returns
+        -------
+        Data
+            Result typed as in NumPy.
+        
+        Raises
+        ------
+        ValueError
+            For string and None payloads, an out-of-range axis, and extrema of no
+            elements.
+        
+        Example
+        -------
+        .. literalinclude:: ../../../tests/python/array/test_reductions.py
+           :language: python
+           :pyobject: test_reduce
+        """
+    def satisfies(self, predicate: ValuePredicate) -> bool:
+        """
+        Test the numeric elements of this payload against a value predicate.
+        
+        The elements are read from the typed buffer, without conversion to text.
+        
+        Parameters
+        ----------
+        predicate : ValuePredicate
+            Interval and quantifier to test.
+        
+        Returns
+        -------
+        bool
+            ``False`` for None, empty and string payloads.
+        """
 class Navigation:
     """
     
@@ -164,6 +424,10 @@ class Navigation:
         """
         get all nodes by glob conditions on name, type and string data recursively
         """
+    def all_by_and_glob_parallel(self, name: str = '', type: str = '', data: str = '', depth: typing.SupportsInt | typing.SupportsIndex = 100, threads: typing.SupportsInt | typing.SupportsIndex = 0, grain_size: typing.SupportsInt | typing.SupportsIndex = 4096) -> list[Node]:
+        """
+        get all nodes by glob conditions on name, type and string data, searching subtrees on several threads
+        """
     def all_by_and_int16(self, name: str = '', type: str = '', data: typing.SupportsInt | typing.SupportsIndex, depth: typing.SupportsInt | typing.SupportsIndex = 100) -> list[Node]:
         """
         Get all nodes by name/type and scalar data recursively (typed overload)
@@ -180,6 +444,10 @@ class Navigation:
         """
         Get all nodes by name/type and scalar data recursively (typed overload)
         """
+    def all_by_and_parallel(self, name: str = '', type: str = '', data: str = '', depth: typing.SupportsInt | typing.SupportsIndex = 100, threads: typing.SupportsInt | typing.SupportsIndex = 0, grain_size: typing.SupportsInt | typing.SupportsIndex = 4096) -> list[Node]:
+        """
+        get all nodes by exact conditions on name, type and string data, searching subtrees on several threads
+        """
     def all_by_and_uint16(self, name: str = '', type: str = '', data: typing.SupportsInt | typing.SupportsIndex, depth: typing.SupportsInt | typing.SupportsIndex = 100) -> list[Node]:
         """
         Get all nodes by name/type and scalar data recursively (typed overload)
@@ -272,6 +540,10 @@ class Navigation:
         """
         get all nodes by regex-pattern type recursively
         """
+    def all_by_value(self, predicate: ValuePredicate, depth: typing.SupportsInt | typing.SupportsIndex = 100) -> list[Node]:
+        """
+        get all nodes whose numeric data satisfies a ValuePredicate recursively
+        """
     def by_and(self, name: str = '', type: str = '', data: typing.Any = '', depth: typing.SupportsInt | typing.SupportsIndex = 100) -> Node:
         """
         get node by and condition using name, type and data recursively (string or scalar)
@@ -400,6 +672,10 @@ class Navigation:
         """
         get node by regex-pattern type recursively
         """
+    def by_value(self, predicate: ValuePredicate, depth: typing.SupportsInt | typing.SupportsIndex = 100) -> Node:
+        """
+        get node whose numeric data satisfies a ValuePredicate recursively
+        """
     def child_by_data(self, data: typing.Any) -> Node:
         """
         Get child node by data (string or scalar)
@@ -519,6 +795,12 @@ class Node:
         
         See C++ counterpart: :ref:`cpp-node-addchildren`.
         """
+    def apply_patch(self, patch: TreePatch) -> None:
+        """
+        Replay a :py:class:`TreePatch` on this tree, in place.
+        
+        See C++ counterpart: :ref:`cpp-node-treepatch`.
+        """
     def attach_to(self, node: Node, position: typing.SupportsInt | typing.SupportsIndex = -1, override_sibling_by_name: bool = True) -> None:
         """
         Attach this node to another parent.
@@ -561,12 +843,54 @@ class Node:
         
         See C++ counterpart: :ref:`cpp-node-detach`.
         """
+    def diff(self, other: Node, relative_tolerance: typing.SupportsFloat | typing.SupportsIndex = 0.0, absolute_tolerance: typing.SupportsFloat | typing.SupportsIndex = 0.0) -> TreePatch:
+        """
+        Changes turning this tree into ``other``, as a :py:class:`TreePatch`.
+        
+        Payloads shared by both trees are not compared, and numeric payloads whose
+        elements differ by at most ``absolute_tolerance + relative_tolerance`` times
+        the larger magnitude are considered unchanged.
+        
+        See C++ counterpart: :ref:`cpp-node-treepatch`.
+        """
+    def disable_tree_index(self) -> None:
+        """
+        Drop the tree index owned by this node, if any.
+        
+        See C++ counterpart: :ref:`cpp-node-enabletreeindex`.
+        """
+    def enable_tree_index(self) -> None:
+        """
+        Index this node and its descendants by name, type and path.
+        
+        The index is kept up to date by ``attach_to``, ``detach``, ``set_name``,
+        ``set_type`` and ``swap``. Exact name and type searches of ``pick()`` and
+        absolute ``get_at_path`` lookups then read it instead of walking the tree.
+        Raises ``RuntimeError`` when an ancestor already indexes this node, or when
+        a descendant owns an index; attaching a subtree holding an index below an
+        indexed node raises too.
+        
+        See C++ counterpart: :ref:`cpp-node-enabletreeindex`.
+        """
     def get(self, name: str = '', type: str = '', data: str = '', depth: typing.SupportsInt | typing.SupportsIndex = 100) -> Node:
         """
         Return the first descendant matching glob conditions on name, type and string data.
         
         This is a Python-only alias for ``pick().by_and_glob(...)``.
         """
+    def fingerprint(self) -> int:
+        """
+        Stable 64-bit hash of this subtree: names, types, link targets, payloads and
+        order of children.
+        
+        Fingerprints are cached per node. Edits made through the node API only clear
+        the cache of the edited node and its ancestors, so rehashing after a local
+        change costs the edited payload and the path to the root. Arrays edited in
+        place through NumPy need ``invalidate_fingerprint()`` on their node, or
+        ``refresh_fingerprint()`` on the subtree.
+        
+        See C++ counterpart: :ref:`cpp-node-fingerprint`.
+        """
     def get_at_path(self, path: str, path_is_relative: bool = False) -> Node:
         """
         Resolve a node by path (absolute by default).
@@ -617,6 +941,12 @@ class Node:
         
         See C++ counterpart: :ref:`cpp-node-hassiblings`.
         """
+    def has_tree_index(self) -> bool:
+        """
+        Whether this node is covered by a tree index, its own or an ancestor's.
+        
+        See C++ counterpart: :ref:`cpp-node-enabletreeindex`.
+        """
     def interpret_data(self, split_strings_logic: typing.Any = 'spaces') -> typing.Any:
         """
         Return node payload as readable Python data.
@@ -632,6 +962,12 @@ class Node:
         
         Numeric arrays are returned as NumPy arrays and empty payloads return None.
         """
+    def invalidate_fingerprint(self) -> None:
+        """
+        Forget the cached fingerprints of this node, its payload and its ancestors.
+        
+        See C++ counterpart: :ref:`cpp-node-fingerprint`.
+        """
     def level(self) -> int:
         """
         Return depth from root.
@@ -698,6 +1034,13 @@ class Node:
         
         See C++ counterpart: :ref:`cpp-node-printtree`.
         """
+    def refresh_fingerprint(self) -> None:
+        """
+        Rehash the loaded payloads of this subtree, forgetting the fingerprints they
+        no longer match. Incremental writes call it themselves.
+        
+        See C++ counterpart: :ref:`cpp-node-fingerprint`.
+        """
     def reload_node_data(self, filename: str) -> None:
         """
         Reload this node payload from file using this node path.
@@ -716,6 +1059,21 @@ class Node:
         
         See C++ counterpart: :ref:`cpp-node-savethisnodeonly`.
         """
+    def select(self, expression: str) -> list[Node]:
+        """
+        Select nodes below this one with a path expression, evaluated in C++.
+        
+        Steps are separated by ``/`` (children) or ``//`` (descendants; ``//{n}``
+        and ``//{m,n}`` bound the depth). A step is ``*``, a node type (a word
+        ending with ``_t``) or a node name, globs allowed, followed by optional
+        ``[key op value]`` predicates on ``name``, ``type``, ``data`` or ``dtype``
+        with ``=``, ``!=``, ``~`` (glob) or ``!~``. For example
+        ``root.select("CGNSBase_t/Zone_t[name~'blk*']//DataArray_t[dtype=float64]")``.
+        
+        Returns selected nodes in depth-first order.
+        
+        See C++ counterpart: :ref:`cpp-node-select`.
+        """
     def set_data(self, arg0: typing.Any) -> None:
         """
         Set node payload from scalar, string, NumPy array, list/tuple (converted via numpy.asarray), or Data.
@@ -770,14 +1128,254 @@ class Node:
         
         See C++ counterpart: :ref:`cpp-node-type`.
         """
-    def write(self, arg0: str) -> None:
+    def write(self, filename: str, deflate_level: typing.SupportsInt = 0, shuffle: bool = False, chunks: typing.Any = None, chunk_bytes: typing.SupportsInt = 1048576, min_chunked_bytes: typing.SupportsInt = 0, staging_bytes: typing.SupportsInt = 4194304, incremental: bool = False) -> None:
         """
         Write this subtree to file.
         
-        The output format is inferred from the filename extension.
+        The output format is inferred from the filename extension. Storage options
+        only apply to HDF5/CGNS files; chunked and compressed datasets are read back
+        transparently.
+        
+        Parameters
+        ----------
+        filename : str
+            Output file path.
+        deflate_level : int, optional
+            Deflate (gzip) compression level from 1 to 9. Defaults to 0 (no compression).
+        shuffle : bool, optional
+            Apply the byte shuffle filter before compression. Defaults to ``False``.
+        chunks : None, str or list[int], optional
+            Chunk shape policy: ``None`` or ``"auto"`` for automatic chunks (used only
+            when a filter is enabled), ``"contiguous"`` to never chunk, or an explicit
+            chunk shape in array axis order.
+        chunk_bytes : int, optional
+            Target chunk size in bytes of automatic chunks. Defaults to 1 MiB.
+        min_chunked_bytes : int, optional
+            Arrays smaller than this many bytes stay contiguous. Defaults to 0.
+        staging_bytes : int, optional
+            Largest buffer used to reorder arrays that are not Fortran-contiguous;
+            Fortran-contiguous arrays are written without copy. Defaults to 4 MiB.
+        incremental : bool, optional
+            Update a file previously written with ``incremental=True`` in place,
+            rewriting only the nodes changed since (compared by :py:meth:`fingerprint`,
+            after :py:meth:`refresh_fingerprint`, so arrays edited in place are seen).
+            Other files are written in full. Defaults to ``False``.
         
         See C++ counterpart: :ref:`cpp-node-write`.
         """
+class TreePatch:
+    """
+    
+    Structural difference between two trees, applicable to the first to obtain the second.
+    
+    Built by :py:meth:`TreePatch.diff` (or :py:meth:`Node.diff`). Children are
+    paired by name, and a removed and an added child of the same type are
+    recorded as a rename. Payloads shared by both trees are not compared, and
+    numeric payloads are compared element-wise on their typed buffers, up to the
+    given tolerances.
+    
+    See C++ counterpart: :ref:`cpp-node-treepatch`.
+    
+    Example
+    -------
+    .. literalinclude:: ../../../tests/python/node/test_node.py
+       :language: python
+       :start-after: # docs:start tree_diff_example
+       :end-before: # docs:end tree_diff_example
+       :dedent: 4
+    """
+    class Change:
+        """
+        
+        One change of a :py:class:`TreePatch`; fields not used by its kind are empty.
+        
+        ``path`` is relative to the patched root (empty for the root itself), and
+        is the parent path for ``Added`` changes.
+        """
+        @property
+        def data(self) -> Data:
+            """
+            new payload (DataChanged)
+            """
+        @property
+        def kind(self) -> TreePatch.Kind:
+            ...
+        @property
+        def path(self) -> str:
+            ...
+        @property
+        def position(self) -> int:
+            """
+            position among the children (Added)
+            """
+        @property
+        def subtree(self) -> Node:
+            """
+            added subtree (Added)
+            """
+        @property
+        def value(self) -> str:
+            """
+            new name (Renamed) or type (Retyped)
+            """
+    class Kind:
+        """
+        What a change does to the node at its path.
+        
+        Members:
+        
+          Added
+        
+          Removed
+        
+          Renamed
+        
+          Retyped
+        
+          DataChanged
+        """
+        Added: typing.ClassVar[TreePatch.Kind]  # value = <Kind.Added: 0>
+        DataChanged: typing.ClassVar[TreePatch.Kind]  # value = <Kind.DataChanged: 4>
+        Removed: typing.ClassVar[TreePatch.Kind]  # value = <Kind.Removed: 1>
+        Renamed: typing.ClassVar[TreePatch.Kind]  # value = <Kind.Renamed: 2>
+        Retyped: typing.ClassVar[TreePatch.Kind]  # value = <Kind.Retyped: 3>
+        __members__: typing.ClassVar[dict[str, TreePatch.Kind]]  # value = {'Added': <Kind.Added: 0>, 'Removed': <Kind.Removed: 1>, 'Renamed': <Kind.Renamed: 2>, 'Retyped': <Kind.Retyped: 3>, 'DataChanged': <Kind.DataChanged: 4>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt | typing.SupportsIndex) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt | typing.SupportsIndex) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    @staticmethod
+    def diff(before: Node, after: Node, relative_tolerance: typing.SupportsFloat | typing.SupportsIndex = 0.0, absolute_tolerance: typing.SupportsFloat | typing.SupportsIndex = 0.0) -> TreePatch:
+        """
+        Changes turning ``before`` into ``after``.
+        
+        Parameters
+        ----------
+        before : Node
+            Root of the tree the patch applies to.
+        after : Node
+            Root of the tree the patch rebuilds.
+        relative_tolerance : float, optional
+            Relative tolerance on numeric payloads. Defaults to 0.
+        absolute_tolerance : float, optional
+            Absolute tolerance on numeric payloads. Defaults to 0.
+        
+        Returns
+        -------
+        TreePatch
+        """
+    @staticmethod
+    def from_node(node: Node) -> TreePatch:
+        """
+        Patch encoded by to_node.
+        """
+    def __len__(self) -> int:
+        ...
+    def apply(self, root: Node) -> None:
+        """
+        Replay the changes on the tree rooted at ``root``, in place.
+        
+        Raises ``RuntimeError`` when a path does not lead to a node of the tree.
+        """
+    def changes(self) -> list[TreePatch.Change]:
+        """
+        Changes in replay order.
+        """
+    def empty(self) -> bool:
+        """
+        True when the compared trees are equal.
+        """
+    def to_node(self) -> Node:
+        """
+        The patch as a tree, to be written with :py:meth:`Node.write` and read back
+        with :py:meth:`TreePatch.from_node`.
+        """
+class ValuePredicate:
+    """
+    
+    Numeric test on the elements of a payload, evaluated on its typed buffer.
+    
+    A predicate is an interval and a quantifier: by default every element must
+    lie in the interval, :py:meth:`any` makes one element enough. Elements are
+    compared as float; None, empty and string payloads never satisfy a predicate.
+    
+    See C++ counterpart: :ref:`cpp-navigation-value-predicates`.
+    
+    Example
+    -------
+    .. literalinclude:: ../../../tests/python/node/test_navigation.py
+       :language: python
+       :start-after: # docs:start all_by_value_example
+       :end-before: # docs:end all_by_value_example
+       :dedent: 4
+    """
+    @staticmethod
+    def at_least(value: typing.SupportsFloat | typing.SupportsIndex) -> ValuePredicate:
+        """
+        Elements greater than or equal to value.
+        """
+    @staticmethod
+    def at_most(value: typing.SupportsFloat | typing.SupportsIndex) -> ValuePredicate:
+        """
+        Elements less than or equal to value.
+        """
+    @staticmethod
+    def between(lower: typing.SupportsFloat | typing.SupportsIndex, upper: typing.SupportsFloat | typing.SupportsIndex) -> ValuePredicate:
+        """
+        Elements in [lower, upper].
+        """
+    @staticmethod
+    def equal_to(value: typing.SupportsFloat | typing.SupportsIndex) -> ValuePredicate:
+        """
+        Elements equal to value.
+        """
+    @staticmethod
+    def greater_than(value: typing.SupportsFloat | typing.SupportsIndex) -> ValuePredicate:
+        """
+        Elements strictly greater than value.
+        """
+    @staticmethod
+    def less_than(value: typing.SupportsFloat | typing.SupportsIndex) -> ValuePredicate:
+        """
+        Elements strictly less than value.
+        """
+    @staticmethod
+    def near(value: typing.SupportsFloat | typing.SupportsIndex, tolerance: typing.SupportsFloat | typing.SupportsIndex) -> ValuePredicate:
+        """
+        Elements within tolerance of value (bounds included).
+        """
+    def all(self) -> ValuePredicate:
+        """
+        Same interval, satisfied when every element lies in it.
+        """
+    def any(self) -> ValuePredicate:
+        """
+        Same interval, satisfied when at least one element lies in it.
+        """
+    def contains(self, value: typing.SupportsFloat | typing.SupportsIndex) -> bool:
+        """
+        Whether value lies in the interval.
+        """
 class _NodeGroup:
     """
     
@@ -880,3 +1478,30 @@ def registerDefaultFactory() -> None:
     -------
     None
     """
+def setThreadPoolSize(threads: typing.SupportsInt) -> None:
+    """
+    Resize the thread pool shared by array operations, deep copies and fills.
+    
+    Loops over large arrays are split between the threads of the pool, with the
+    GIL released. The initial size is given by the ``NODER_NUM_THREADS``
+    environment variable, or the number of hardware threads when unset.
+    
+    Parameters
+    ----------
+    threads : int
+        Number of threads, counting the calling one; 0 uses all hardware threads
+        and 1 runs every loop on the calling thread.
+    
+    Returns
+    -------
+    None
+    """
+def threadPoolSize() -> int:
+    """
+    Number of threads of the pool shared by array operations.
+    
+    Returns
+    -------
+    int
+        Threads counting the calling one.
+    """
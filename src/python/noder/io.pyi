@@ -6,9 +6,11 @@ See C++ counterpart: :ref:`cpp-io-module`.
 """
 from __future__ import annotations
 from noder.core import Node
+import collections.abc
 import numpy
-__all__: list[str] = ['ENABLE_HDF5_IO', 'Node', 'read', 'read_numpy', 'write_numpy']
-def read(filename: str, order: str = 'F') -> Node:
+import typing
+__all__: list[str] = ['ENABLE_HDF5_IO', 'Node', 'read', 'read_numpy', 'read_slab', 'write_numpy', 'write_slab']
+def read(filename: str, order: str = 'F', lazy: bool = False, include: list[str] = [], exclude: list[str] = [], max_depth: typing.SupportsInt | typing.SupportsIndex | None = None, threads: typing.SupportsInt | typing.SupportsIndex = 1) -> Node:
     """
     Read a Node hierarchy from file.
     
@@ -20,6 +22,29 @@ def read(filename: str, order: str = 'F') -> Node:
         Input file path.
     order : str, optional
         Memory order of arrays when read (``"C"`` or ``"F"``). Defaults to ``"F"`` (CGNS/Fortran convention).
+    lazy : bool, optional
+        If ``True``, only the hierarchy and array metadata are read upfront; each
+        array is read from disk the first time its values are accessed. The file
+        stays open until all deferred arrays are loaded. Only used for HDF5/CGNS
+        format. Defaults to ``False``.
+    include : list[str], optional
+        Only read nodes whose path matches one of these patterns. Patterns are
+        ``/``-separated paths relative to the file root whose elements are globs
+        with the semantics of :py:meth:`noder.core.Navigation.by_name_glob`
+        (for example ``"Base/*/GridCoordinates"``). Matching nodes are read with
+        their subtree and their ancestors without payload. Only used for
+        HDF5/CGNS format. Defaults to reading every node.
+    exclude : list[str], optional
+        Skip nodes matching one of these patterns, together with their subtree.
+        Takes precedence over ``include``. Only used for HDF5/CGNS format.
+    max_depth : int or None, optional
+        Deepest level read, the file root being level 0. Only used for HDF5/CGNS
+        format. Defaults to no limit.
+    threads : int, optional
+        Maximum number of threads of the shared thread pool reading and converting
+        arrays once the hierarchy is known; ``0`` uses all of them. The result does
+        not depend on the thread count. Ignored when ``lazy`` is ``True``. Only used
+        for HDF5/CGNS format. Defaults to ``1``.
     
     Returns
     -------
@@ -56,6 +81,64 @@ def read_numpy(filename: str, dataset_name: str = 'numpy', order: str = 'F') ->
        :language: python
        :pyobject: test_write_and_read_numerical_numpy
     """
+def read_parallel(filename: str, comm: typing.Any, order: str = 'F', lazy: bool = False) -> Node:
+    """
+    Read on each MPI rank only the zones assigned to it; ranks read on their own,
+    without collective calls.
+    
+    Zones are split in contiguous blocks, in read order: the k-th of n zones goes
+    to rank ``k * size // n``. Nodes outside zones are read on every rank.
+    
+    Parameters
+    ----------
+    filename : str
+        Input file path (HDF5/CGNS format only).
+    comm : mpi4py.MPI.Comm
+        Communicator of the reading ranks.
+    order : str, optional
+        Memory order of arrays when read (``"C"`` or ``"F"``). Defaults to ``"F"``.
+    lazy : bool, optional
+        Defer array reads until first access, as in :py:func:`read`. Defaults to ``False``.
+    
+    Returns
+    -------
+    Node
+        Tree holding the zones of the calling rank.
+    
+    See C++ counterpart: :ref:`cpp-io-module`.
+    """
+def read_slab(filename: str, path: str, start: collections.abc.Sequence[typing.SupportsInt | typing.SupportsIndex], count: collections.abc.Sequence[typing.SupportsInt | typing.SupportsIndex], stride: collections.abc.Sequence[typing.SupportsInt | typing.SupportsIndex] = [], order: str = 'F') -> numpy.ndarray:
+    """
+    Read a strided block of a node payload from a CGNS/HDF5 file.
+    
+    Only the selected elements are read from disk.
+    
+    Parameters
+    ----------
+    filename : str
+        Input file path.
+    path : str
+        Path of the node relative to the file root (for example ``"Base/Zone/GridCoordinates/CoordinateX"``).
+    start : list[int]
+        First selected index along each axis.
+    count : list[int]
+        Number of selected indices along each axis.
+    stride : list[int], optional
+        Step between selected indices along each axis. Defaults to 1 everywhere.
+    order : str, optional
+        Memory order of returned array (``"C"`` or ``"F"``).
+    
+    Returns
+    -------
+    numpy.ndarray
+        Array of shape ``count``.
+    
+    Example
+    -------
+    .. literalinclude:: ../../../tests/python/io/test_io.py
+       :language: python
+       :pyobject: test_read_and_write_slab
+    """
 def write_numpy(array: numpy.ndarray, filename: str, dataset_name: str = 'numpy') -> None:
     """
     Write a NumPy array to a dataset in an HDF5 file.
@@ -79,4 +162,58 @@ def write_numpy(array: numpy.ndarray, filename: str, dataset_name: str = 'numpy'
        :language: python
        :pyobject: test_write_and_read_numerical_numpy
     """
+def write_parallel(node: Node, filename: str, comm: typing.Any, collective: bool = True) -> None:
+    """
+    Write into one file the trees held by all MPI ranks (collective call).
+    
+    Each rank passes its own tree, typically its bases holding only its zones.
+    The file contains the union of the nodes of all ranks; a node held by several
+    ranks must have the same label on each of them, and its payload is written by
+    the first rank holding one.
+    
+    Parameters
+    ----------
+    node : Node
+        Tree of the calling rank.
+    filename : str
+        Output file path (HDF5/CGNS format only).
+    comm : mpi4py.MPI.Comm
+        Communicator of the writing ranks.
+    collective : bool, optional
+        Use collective MPI-IO transfers; independent transfers otherwise. Only
+        used when HDF5 is built with parallel support. Defaults to ``True``.
+    
+    Returns
+    -------
+    None
+    
+    See C++ counterpart: :ref:`cpp-io-module`.
+    """
+def write_slab(array: typing.Any, filename: str, path: str, start: collections.abc.Sequence[typing.SupportsInt | typing.SupportsIndex], stride: collections.abc.Sequence[typing.SupportsInt | typing.SupportsIndex] = []) -> None:
+    """
+    Overwrite a strided block of an existing node payload in a CGNS/HDF5 file.
+    
+    Parameters
+    ----------
+    array : numpy.ndarray
+        Values to write; their shape gives the number of selected indices per axis.
+    filename : str
+        Existing file path.
+    path : str
+        Path of the node relative to the file root.
+    start : list[int]
+        First selected index along each axis.
+    stride : list[int], optional
+        Step between selected indices along each axis. Defaults to 1 everywhere.
+    
+    Returns
+    -------
+    None
+    
+    Example
+    -------
+    .. literalinclude:: ../../../tests/python/io/test_io.py
+       :language: python
+       :pyobject: test_read_and_write_slab
+    """
 ENABLE_HDF5_IO: bool = True
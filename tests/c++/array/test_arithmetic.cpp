@@ -0,0 +1,270 @@
+# include "test_arithmetic.hpp"
+
+# include <cmath>
+# include <limits>
+# include <tuple>
+# include <type_traits>
+
+# include <pybind11/pybind11.h>
+
+# include "array/factory/c_to_py.hpp"
+# include "array/factory/strings.hpp"
+# include "utils/template_instantiator.hpp"
+
+namespace py = pybind11;
+
+using arraymath::Operation;
+
+namespace {
+
+Array iota(const std::vector<size_t>& shape, double start = 0.0) {
+    Array array = arrayfactory::empty<double>(shape, 'C');
+    double* items = static_cast<double*>(array.rawData());
+    for (size_t i = 0; i < array.size(); ++i) {
+        items[i] = start + static_cast<double>(i);
+    }
+    return array;
+}
+
+bool hasItems(const Array& array, const std::vector<double>& expected) {
+    if (array.size() != expected.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const double item = array.itemAsDouble({i});
+        if (!(item == expected[i] || (std::isnan(item) && std::isnan(expected[i])))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+
+template <typename T>
+void test_operateConsideringAllTypes() {
+    using Quotient = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+    constexpr bool isBool = std::is_same_v<T, bool>;
+    const int64_t modulo = isBool ? 2 : 50;
+
+    Array a = arrayfactory::empty<T>({4, 5}, 'C');
+    Array b = arrayfactory::empty<T>({4, 5}, 'C');
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            const int64_t k = static_cast<int64_t>(5 * i + j);
+            a.setItemFromInt64({i, j}, k % modulo);
+            b.setItemFromInt64({i, j}, isBool ? (k / 2) % 2 : (37 * k + 11) % modulo);
+        }
+    }
+
+    Array sums = arraymath::add(a, b);
+    Array maxima = arraymath::maximum(a, b);
+    Array less = arraymath::less(a, b);
+    Array quotients = arraymath::divide(a, Array(T(1)));
+    Array scaled = a * Array(2.5);
+    if (sums.shape() != a.shape() || !sums.template hasDataOfType<T>() || !maxima.template hasDataOfType<T>()
+        || !less.hasDataOfType<bool>() || !quotients.template hasDataOfType<Quotient>()
+        || !scaled.hasDataOfType<double>()) {
+        throw py::value_error("expected results typed as in NumPy");
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            const int64_t x = a.itemAsInt64({i, j});
+            const int64_t y = b.itemAsInt64({i, j});
+            const int64_t sum = isBool ? (x || y) : x + y;
+            if (sums.itemAsInt64({i, j}) != sum || maxima.itemAsInt64({i, j}) != std::max(x, y)
+                || less.itemAsInt64({i, j}) != (x < y)) {
+                throw py::value_error("expected the sums, maxima and comparisons of the items");
+            }
+            if (quotients.itemAsDouble({i, j}) != static_cast<double>(x)
+                || scaled.itemAsDouble({i, j}) != 2.5 * static_cast<double>(x)) {
+                throw py::value_error("expected the items divided by one and scaled");
+            }
+        }
+    }
+}
+
+void test_promoteTypesAsNumPy() {
+    using Id = ArrayTypeId;
+    const std::vector<std::tuple<Id, Id, Id>> promotions = {
+        {Id::Bool, Id::Bool, Id::Bool},
+        {Id::Bool, Id::UInt8, Id::UInt8},
+        {Id::Int8, Id::UInt8, Id::Int16},
+        {Id::UInt32, Id::Int32, Id::Int64},
+        {Id::Int64, Id::UInt64, Id::Float64},
+        {Id::Int16, Id::Float32, Id::Float32},
+        {Id::Int32, Id::Float32, Id::Float64},
+        {Id::Float32, Id::Float64, Id::Float64}};
+    for (const auto& [a, b, expected] : promotions) {
+        if (arraymath::promoteTypes(a, b) != expected || arraymath::promoteTypes(b, a) != expected) {
+            throw py::value_error("expected the types promoted as by numpy.promote_types");
+        }
+    }
+    if (arraymath::resultType(Operation::Divide, Id::Int8, Id::UInt8) != Id::Float64
+        || arraymath::resultType(Operation::Divide, Id::Float32, Id::Int8) != Id::Float32
+        || arraymath::resultType(Operation::Less, Id::Float64, Id::Int8) != Id::Bool) {
+        throw py::value_error("expected divisions of integers to float64 and comparisons to bool");
+    }
+}
+
+void test_broadcastRowsAndColumns() {
+    Array column = iota({3, 1});
+    Array row = arrayfactory::toArray1D(std::vector<int32_t>({10, 20, 30, 40}));
+
+    if (arraymath::broadcastShapes(column.shape(), row.shape()) != std::vector<size_t>{3, 4}) {
+        throw py::value_error("expected axes of extent 1 repeated along the other shape");
+    }
+
+    Array sums = column + row;
+    Array halves = row / 2.0;
+    if (sums.shape() != std::vector<size_t>{3, 4} || !sums.hasDataOfType<double>()) {
+        throw py::value_error("expected a float64 result of the broadcast shape");
+    }
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            if (sums.itemAsDouble({i, j}) != static_cast<double>(i + 10 * (j + 1))) {
+                throw py::value_error("expected each column item added to each row item");
+            }
+        }
+    }
+    if (!hasItems(halves, {5.0, 10.0, 15.0, 20.0})) {
+        throw py::value_error("expected one-item arrays to act as scalars");
+    }
+}
+
+void test_writeToOutputOfAnotherType() {
+    Array a = iota({100});
+    Array b = iota({100}, 0.5);
+    Array out = arrayfactory::empty<float>({100}, 'C');
+    const void* items = out.rawData();
+
+    Array& result = arraymath::add(a, b, out);
+    if (&result != &out || out.rawData() != items || !out.hasDataOfType<float>()) {
+        throw py::value_error("expected the results written to the output, without allocation");
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        if (out.itemAsDouble({i}) != static_cast<double>(static_cast<float>(2.0 * static_cast<double>(i) + 0.5))) {
+            throw py::value_error("expected the float64 results cast to float32");
+        }
+    }
+
+    Array counts = arrayfactory::zeros<int64_t>({100}, 'C');
+    arraymath::less(a, Array(49.5), counts);
+    arraymath::add(counts, arraymath::greater(b, Array(90.0)), counts);
+    if (counts.reduce(Data::Reduction::Sum)->itemAsInt64({0}) != 50 + 10) {
+        throw py::value_error("expected bool results counted in an integer output");
+    }
+}
+
+void test_computePressureFromConservativeVariables() {
+    const size_t count = 1000;
+    const double gamma = 1.4;
+    Array rho = arrayfactory::uniformFromCount<double>(1.0, 2.0, count);
+    Array rhoU = arrayfactory::uniformFromCount<double>(-1.0, 1.0, count);
+    Array rhoV = arrayfactory::full<double>({count}, 0.5);
+    Array rhoW = arrayfactory::zeros<float>({count});
+    Array rhoE = arrayfactory::uniformFromCount<double>(2.5, 5.0, count);
+
+    // p = (gamma - 1) * (rhoE - (rhoU^2 + rhoV^2 + rhoW^2) / (2 rho)), in two buffers
+    Array pressure = arrayfactory::empty<double>({count});
+    Array buffer = arrayfactory::empty<double>({count});
+    arraymath::multiply(rhoU, rhoU, pressure);
+    arraymath::multiply(rhoV, rhoV, buffer);
+    arraymath::add(pressure, buffer, pressure);
+    arraymath::multiply(rhoW, rhoW, buffer);
+    arraymath::add(pressure, buffer, pressure);
+    arraymath::multiply(rho, 2.0, buffer);
+    arraymath::divide(pressure, buffer, pressure);
+    arraymath::subtract(rhoE, pressure, pressure);
+    arraymath::multiply(pressure, gamma - 1.0, pressure);
+
+    for (size_t i = 0; i < count; ++i) {
+        const double u = rhoU.itemAsDouble({i});
+        const double v = rhoV.itemAsDouble({i});
+        const double expected = (gamma - 1.0) * (rhoE.itemAsDouble({i}) - (u * u + v * v) / (2.0 * rho.itemAsDouble({i})));
+        if (std::abs(pressure.itemAsDouble({i}) - expected) > 1e-12) {
+            throw py::value_error("expected the pressure computed item by item");
+        }
+    }
+}
+
+void test_operateOnOverlappingOutput() {
+    Array a = iota({4, 4});
+    const std::vector<size_t> strides = a.strides();
+    Array transposed(a.typeId(), a.itemsize(), a.rawData(), {4, 4}, {strides[1], strides[0]});
+    arraymath::add(a, a, transposed);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            if (a.itemAsDouble({j, i}) != 2.0 * static_cast<double>(4 * i + j)) {
+                throw py::value_error("expected the operands read before the transposed output is written");
+            }
+        }
+    }
+
+    Array base = arrayfactory::empty<int64_t>({11}, 'C');
+    for (size_t i = 0; i < 11; ++i) {
+        base.setItemFromInt64({i}, static_cast<int64_t>(i * i));
+    }
+    int64_t* items = static_cast<int64_t*>(base.rawData());
+    Array head(base.typeId(), base.itemsize(), items, {10}, {base.itemsize()});
+    Array tail(base.typeId(), base.itemsize(), items + 1, {10}, {base.itemsize()});
+    arraymath::add(head, Array(int64_t(1)), tail);
+    for (size_t i = 0; i < 10; ++i) {
+        if (base.itemAsInt64({i + 1}) != static_cast<int64_t>(i * i + 1)) {
+            throw py::value_error("expected the operand read before the shifted output is written");
+        }
+    }
+}
+
+void test_compareNaN() {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    Array x = arrayfactory::toArray1D(std::vector<double>({nan, 1.0, 2.0}));
+    Array y = arrayfactory::toArray1D(std::vector<double>({1.0, nan, 2.0}));
+
+    if (!hasItems(arraymath::equal(x, y), {0.0, 0.0, 1.0})
+        || !hasItems(arraymath::notEqual(x, y), {1.0, 1.0, 0.0})
+        || !hasItems(arraymath::less(x, y), {0.0, 0.0, 0.0})
+        || !hasItems(arraymath::greaterEqual(x, y), {0.0, 0.0, 1.0})) {
+        throw py::value_error("expected comparisons with NaN false, except notEqual");
+    }
+    if (!hasItems(arraymath::minimum(x, y), {nan, nan, 2.0}) || !hasItems(arraymath::maximum(x, y), {nan, nan, 2.0})) {
+        throw py::value_error("expected NaN propagated by minimum and maximum");
+    }
+}
+
+void test_catchErrorsOfOperandsAndOutput() {
+    Array a = iota({3});
+    Array integers = arrayfactory::zeros<int32_t>({3}, 'C');
+    Array flags = arrayfactory::zeros<bool>({3}, 'C');
+    Array small = arrayfactory::zeros<double>({2}, 'C');
+
+    const auto throwsInvalidArgument = [](auto&& operate) {
+        try {
+            operate();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+    if (!throwsInvalidArgument([&]() { arraymath::add(a, iota({4})); })
+        || !throwsInvalidArgument([&]() { arraymath::subtract(flags, flags); })
+        || !throwsInvalidArgument([&]() { arraymath::add(a, arrayfactory::arrayFromString("text")); })
+        || !throwsInvalidArgument([&]() { arraymath::multiply(Array(), a); })
+        || !throwsInvalidArgument([&]() { arraymath::add(a, a, integers); })
+        || !throwsInvalidArgument([&]() { arraymath::add(integers, integers, flags); })
+        || !throwsInvalidArgument([&]() { arraymath::add(a, a, small); })) {
+        throw std::runtime_error("should have raised an error");
+    }
+}
+
+
+template <typename... T>
+struct InstantiatorScalars {
+    template <typename... U>
+    void operator()() const {
+        (utils::forceSymbol(&test_operateConsideringAllTypes<U>), ...);
+    }
+};
+
+template void utils::instantiateFromTypeList<InstantiatorScalars, utils::ScalarTypes>();
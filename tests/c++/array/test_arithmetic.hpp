@@ -0,0 +1,26 @@
+# ifndef TEST_ARRAY_ARITHMETIC_HPP
+# define TEST_ARRAY_ARITHMETIC_HPP
+
+# include <array/array.hpp>
+# include <array/arithmetic.hpp>
+# include <array/factory/matrices.hpp>
+# include <array/factory/vectors.hpp>
+
+template <typename T>
+void test_operateConsideringAllTypes();
+
+void test_promoteTypesAsNumPy();
+
+void test_broadcastRowsAndColumns();
+
+void test_writeToOutputOfAnotherType();
+
+void test_computePressureFromConservativeVariables();
+
+void test_operateOnOverlappingOutput();
+
+void test_compareNaN();
+
+void test_catchErrorsOfOperandsAndOutput();
+
+# endif
@@ -0,0 +1,22 @@
+# ifndef TEST_ARRAY_ARITHMETIC_PYBIND_HPP
+# define TEST_ARRAY_ARITHMETIC_PYBIND_HPP
+
+# include "utils/template_binder.hpp"
+# include "test_arithmetic.hpp"
+
+void bindTestsOfArrayArithmetic(py::module_ &m) {
+
+    utils::bindForScalarTypes(m, "operateConsideringAllTypes",
+        []<typename T>(utils::TypeTag<T>) { return &test_operateConsideringAllTypes<T>; }
+    );
+
+    m.def("promoteTypesAsNumPy", &test_promoteTypesAsNumPy);
+    m.def("broadcastRowsAndColumns", &test_broadcastRowsAndColumns);
+    m.def("writeToOutputOfAnotherType", &test_writeToOutputOfAnotherType);
+    m.def("computePressureFromConservativeVariables", &test_computePressureFromConservativeVariables);
+    m.def("operateOnOverlappingOutput", &test_operateOnOverlappingOutput);
+    m.def("compareNaN", &test_compareNaN);
+    m.def("catchErrorsOfOperandsAndOutput", &test_catchErrorsOfOperandsAndOutput);
+}
+
+# endif
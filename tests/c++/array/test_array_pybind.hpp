@@ -11,6 +11,9 @@
 # include "test_comparisons_pybind.hpp"
 # include "test_modifiers_pybind.hpp"
 # include "test_assertions_pybind.hpp"
+# include "test_relayout_pybind.hpp"
+# include "test_reductions_pybind.hpp"
+# include "test_arithmetic_pybind.hpp"
 
 void bindTestsOfArray(py::module_ &m) {
 
@@ -61,6 +64,9 @@ void bindTestsOfArray(py::module_ &m) {
     bindTestsOfArrayComparisons(sm);
     bindTestsOfArrayModifiers(sm);
     bindTestsOfArrayAssertions(sm);
+    bindTestsOfArrayRelayout(sm);
+    bindTestsOfArrayReductions(sm);
+    bindTestsOfArrayArithmetic(sm);
 }
 
 # endif
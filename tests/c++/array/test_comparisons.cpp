@@ -170,6 +170,126 @@ void test_numericalArrayDifferentToString() {
 }
 
 
+void test_arraySatisfiesValuePredicates() {
+    Array range = arrayfactory::uniformFromStep<int32_t>(0, 10);
+
+    if (!range.satisfies(ValuePredicate::between(0, 9))) {
+        throw py::value_error("0..9 should lie in [0, 9]");
+    }
+    if (range.satisfies(ValuePredicate::between(1, 9))) {
+        throw py::value_error("0 should not lie in [1, 9]");
+    }
+    if (!range.satisfies(ValuePredicate::equalTo(5).any())) {
+        throw py::value_error("one element of 0..9 should equal 5");
+    }
+    if (!range.satisfies(ValuePredicate::atLeast(0)) || range.satisfies(ValuePredicate::greaterThan(0))) {
+        throw py::value_error("min of 0..9 should be 0");
+    }
+    if (!range.satisfies(ValuePredicate::greaterThan(8).any()) || range.satisfies(ValuePredicate::greaterThan(9).any())) {
+        throw py::value_error("max of 0..9 should be 9");
+    }
+    if (!range.satisfies(ValuePredicate::lessThan(10)) || range.satisfies(ValuePredicate::atMost(8))) {
+        throw py::value_error("0..9 should lie below 10 but not all at most 8");
+    }
+
+    if (!Array(1.0 + 1e-12).satisfies(ValuePredicate::near(1.0, 1e-9))) {
+        throw py::value_error("1 + 1e-12 should be near 1");
+    }
+    if (Array(1.1).satisfies(ValuePredicate::near(1.0, 1e-9))) {
+        throw py::value_error("1.1 should not be near 1");
+    }
+    if (!Array(true).satisfies(ValuePredicate::equalTo(1))) {
+        throw py::value_error("true should equal 1");
+    }
+
+    // every other element of a buffer: only the strided elements are tested
+    std::vector<double> values = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0};
+    Array strided(Array::typeIdFor<double>(), sizeof(double), values.data(), {3}, {2 * sizeof(double)});
+    if (strided.isContiguous() || !strided.satisfies(ValuePredicate::between(1.0, 3.0))) {
+        throw py::value_error("strided view should hold 1, 2 and 3");
+    }
+    Array transposed(Array::typeIdFor<double>(), sizeof(double), values.data(), {3, 2}, {sizeof(double), 3 * sizeof(double)});
+    if (!transposed.satisfies(ValuePredicate::equalTo(-3.0).any()) || transposed.satisfies(ValuePredicate::atLeast(-2.0))) {
+        throw py::value_error("transposed view should visit every element");
+    }
+
+    if (Array("12").satisfies(ValuePredicate::atLeast(0)) || Array().satisfies(ValuePredicate::atLeast(0))) {
+        throw py::value_error("string and None arrays should not satisfy value predicates");
+    }
+    if (arrayfactory::uniformFromStep<double>(0, 0).satisfies(ValuePredicate::atLeast(0))) {
+        throw py::value_error("empty arrays should not satisfy value predicates");
+    }
+}
+
+void test_stringViewMatchesExtractedString() {
+    char bytes[] = {'a', 'b', '\0', 'c', 'd', '\0'};
+    char32_t codePoints[] = {U'a', U'\0', U'ρ', U'b'};
+    std::vector<Array> arrays = {
+        Array("CGNSBase_t"),
+        Array::bytesView(bytes, 3, {2}, {3}),
+        Array::bytesView(bytes, 1, {6}, {1}),
+        Array::bytesView(bytes, 1, {3}, {2}),
+        arrayfactory::arrayFromUnicodeString("ρω"),
+        Array::unicodeView(codePoints, 2 * sizeof(char32_t), {2}, {2 * sizeof(char32_t)}),
+        arrayfactory::uniformFromStep<int32_t>(0, 3)
+    };
+
+    std::string buffer;
+    for (const Array& array : arrays) {
+        if (array.stringView(buffer) != array.extractString()) {
+            throw py::value_error("stringView should hold the same text as extractString: "
+                + array.extractString());
+        }
+    }
+
+    // a Fortran-ordered (32, N) name list is read in C order, like extractString
+    char names[] = {'a', 'c', 'b', 'd'};
+    Array nameList = Array::bytesView(names, 1, {2, 2}, {1, 2});
+    if (nameList.stringView(buffer) != nameList.extractString() || nameList.stringView(buffer) != "abcd") {
+        throw py::value_error("stringView of a Fortran-ordered array should follow the C order: "
+            + std::string(nameList.stringView(buffer)));
+    }
+    if (nameList.fingerprint() != nameList.copyWithOrder('C').fingerprint()) {
+        throw py::value_error("C and Fortran copies of the same text should have the same fingerprint");
+    }
+
+    // a run of bytes is viewed in place
+    Array text("ZoneType_t");
+    if (text.stringView(buffer).data() != static_cast<const char*>(text.rawData())) {
+        throw py::value_error("stringView of a contiguous byte string should not copy it");
+    }
+}
+
+void test_stridedViewsAreComparedByIndex() {
+    Array base = arrayfactory::empty<double>({5, 6}, 'C');
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 6; ++j) {
+            base.setItemFromInt64({i, j}, static_cast<int64_t>(6 * i + j));
+        }
+    }
+    const std::vector<size_t> strides = base.strides();
+    Array transposed(base.typeId(), base.itemsize(), base.rawData(), {6, 5}, {strides[1], strides[0]});
+    Array fortran = arrayfactory::empty<double>({6, 5}, 'F');
+    fortran = transposed;
+    Array everyOtherColumn(base.typeId(), base.itemsize(), base.rawData(), {5, 3}, {strides[0], 2 * strides[1]});
+    Array evenItems = arrayfactory::uniformFromStep<double>(0, 30, 2);
+
+    assertEqualArraysAndNotDifferent(transposed, fortran);
+    assertEqualArraysAndNotDifferent(everyOtherColumn, evenItems);
+    if (!transposed.isCloseTo(fortran) || !everyOtherColumn.satisfies(ValuePredicate::between(0, 28))) {
+        throw py::value_error("expected strided views to be compared item by item");
+    }
+
+    fortran.setItemFromInt64({5, 4}, -1);
+    if (transposed == fortran || transposed.isCloseTo(fortran)) {
+        throw py::value_error("expected the last item of the transposed view to be compared");
+    }
+    if (everyOtherColumn.satisfies(ValuePredicate::greaterThan(28).any())) {
+        throw py::value_error("expected the skipped columns to be left out of the predicate");
+    }
+}
+
+
 void assertEqualArraysAndNotDifferent(const Array& array1, const Array& array2) {
     bool arraysAreEqual = array1 == array2;
     bool arraysAreDifferent = array1 != array2;
@@ -4,6 +4,7 @@
 # include <array/array.hpp>
 # include <array/factory/vectors.hpp>
 # include <array/factory/matrices.hpp>
+# include <array/factory/strings.hpp>
 
 template <typename T>
 void test_twoIdenticalArraysAreEqual();
@@ -46,6 +47,10 @@ void test_arrayEqualToUnicodeString();
 void test_arrayDifferentToString();
 void test_numericalArrayDifferentToString();
 
+void test_arraySatisfiesValuePredicates();
+void test_stringViewMatchesExtractedString();
+void test_stridedViewsAreComparedByIndex();
+
 
 
 
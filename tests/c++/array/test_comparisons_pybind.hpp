@@ -44,6 +44,10 @@ void bindTestsOfArrayComparisons(py::module_ &m) {
     m.def("arrayEqualToUnicodeString", &test_arrayEqualToUnicodeString);
     m.def("arrayDifferentToString", &test_arrayDifferentToString);
     m.def("numericalArrayDifferentToString", &test_numericalArrayDifferentToString);
+
+    m.def("arraySatisfiesValuePredicates", &test_arraySatisfiesValuePredicates);
+    m.def("stringViewMatchesExtractedString", &test_stringViewMatchesExtractedString);
+    m.def("stridedViewsAreComparedByIndex", &test_stridedViewsAreComparedByIndex);
 }
 
 
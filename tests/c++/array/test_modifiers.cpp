@@ -280,6 +280,116 @@ void test_divideFromArrayToRange() {
 }
 
 
+template <typename T>
+void test_vectorizedKernelsMatchPortableLoops() {
+    // 67 items: whole vectors of every width, followed by a tail
+    const size_t size = 67;
+    const arraysimd::Level active = arraysimd::activeLevel();
+    std::vector<std::vector<T>> results;
+    for (int level = 0; level <= static_cast<int>(arraysimd::supportedLevel()); ++level) {
+        arraysimd::useLevel(static_cast<arraysimd::Level>(level));
+        Array array = arrayfactory::empty<T>({size});
+        Array other = arrayfactory::empty<T>({size});
+        for (size_t i = 0; i < size; ++i) {
+            array.getItemAtIndex<T>(i) = static_cast<T>(i % 11 + 10);
+            other.getItemAtIndex<T>(i) = static_cast<T>(i % 5 + 1);
+        }
+        array += other;
+        array *= other;
+        array -= other;
+        array /= other;
+        array += T(3);
+        array *= T(2);
+        array /= T(2);
+
+        Array copy = array.copyWithOrder('C');
+        const bool equal = array == copy && !(array != copy) && array.isCloseTo(copy);
+        // operator!= holds when every item differs
+        copy.getItemAtIndex<T>(size - 1) += T(1);
+        bool different = !(array == copy) && !(array != copy) && !array.isCloseTo(copy);
+        copy += T(1);
+        different = different && array != copy;
+        arraysimd::useLevel(active);
+        if (!equal || !different) {
+            throw py::value_error(std::string("expected the last item to be compared at level ")
+                + arraysimd::levelName(static_cast<arraysimd::Level>(level)));
+        }
+
+        results.emplace_back(size);
+        for (size_t i = 0; i < size; ++i) {
+            results.back()[i] = array.getItemAtIndex<T>(i);
+        }
+        if (results.back() != results.front()) {
+            throw py::value_error(std::string("expected the same items as the portable loops at level ")
+                + arraysimd::levelName(static_cast<arraysimd::Level>(level)));
+        }
+    }
+}
+
+
+void test_largeArraysAreSharedBetweenThreads() {
+    // 8 MiB arrays, and every other column of one of them
+    const size_t rows = 1024;
+    const size_t columns = 1024;
+    utils::ThreadPool& pool = utils::ThreadPool::shared();
+    const size_t threads = pool.threads();
+    std::vector<Array> results;
+    for (size_t poolSize : {size_t{1}, size_t{4}}) {
+        pool.setThreads(poolSize);
+        Array array = arrayfactory::full<double>({rows, columns}, 2.0);
+        Array other = arrayfactory::uniformFromStep<double>(0, static_cast<double>(rows * columns));
+        const std::vector<size_t> strides = array.strides();
+        Array everyOtherColumn(array.typeId(), array.itemsize(), array.rawData(),
+                               {rows, columns / 2}, {strides[0], 2 * strides[1]});
+        array *= other;
+        everyOtherColumn += 1.0;
+        const bool compared = array == array.copyWithOrder('F') && !(array == other) && everyOtherColumn.isCloseTo(everyOtherColumn.copyWithOrder('C'));
+        results.push_back(array.copyWithOrder('C', 1));
+        if (!compared) {
+            pool.setThreads(threads);
+            throw py::value_error("expected large arrays to be compared on the thread pool");
+        }
+    }
+    pool.setThreads(threads);
+    if (results[0] != results[1] || results[1].getItemAtIndex<double>(3) != 6.0 || results[1].getItemAtIndex<double>(2) != 5.0) {
+        throw py::value_error("expected the same items on one and several threads");
+    }
+}
+
+
+void test_modifyStridedViews() {
+    Array base = arrayfactory::empty<int64_t>({6, 8}, 'C');
+    Array reference = arrayfactory::empty<int64_t>({6, 8}, 'C');
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            base.setItemFromInt64({i, j}, static_cast<int64_t>(10 * i + j));
+        }
+    }
+    const std::vector<size_t> strides = base.strides();
+    // transposed base, and every other column of its last 3 rows
+    Array transposed(base.typeId(), base.itemsize(), base.rawData(), {8, 6}, {strides[1], strides[0]});
+    Array sliced(base.typeId(), base.itemsize(), static_cast<std::uint8_t*>(base.rawData()) + 3 * strides[0], {3, 4}, {strides[0], 2 * strides[1]});
+    Array fortran = arrayfactory::empty<int64_t>({8, 6}, 'F');
+    fortran = transposed;
+    Array flat = arrayfactory::toArray1D(std::vector<int64_t>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}));
+
+    transposed += fortran;
+    sliced *= flat;
+    sliced -= int64_t(1);
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            int64_t expected = static_cast<int64_t>(2 * (10 * i + j));
+            if (i >= 3 && j % 2 == 0) {
+                expected = expected * static_cast<int64_t>(4 * (i - 3) + j / 2 + 1) - 1;
+            }
+            reference.setItemFromInt64({i, j}, expected);
+        }
+    }
+    if (base != reference) {
+        throw py::value_error("expected strided views to be modified item by item, by flat index");
+    }
+}
+
 /*
     template instantiations
 */
@@ -305,6 +415,7 @@ struct InstantiatorFloatingAndIntegrals {
         (utils::forceSymbol(&test_substractFromArrayConsideringAllTypes<U>), ...);
         (utils::forceSymbol(&test_multiplyFromArrayConsideringAllTypes<U>), ...);
         (utils::forceSymbol(&test_divideFromArrayConsideringAllTypes<U>), ...);
+        (utils::forceSymbol(&test_vectorizedKernelsMatchPortableLoops<U>), ...);
     }
 };
 
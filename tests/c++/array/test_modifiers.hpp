@@ -5,6 +5,8 @@
 # include <array/factory/vectors.hpp>
 # include <array/factory/matrices.hpp>
 # include <array/factory/c_to_py.hpp>
+# include <array/simd.hpp>
+# include <utils/thread_pool.hpp>
 
 template <typename T>
 void test_setArrayToScalar();
@@ -46,4 +48,10 @@ template <typename T>
 void test_divideFromArrayConsideringAllTypes();
 void test_divideFromArrayToRange();
 
+void test_modifyStridedViews();
+void test_largeArraysAreSharedBetweenThreads();
+
+template <typename T>
+void test_vectorizedKernelsMatchPortableLoops();
+
 # endif
\ No newline at end of file
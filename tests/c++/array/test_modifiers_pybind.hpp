@@ -67,6 +67,12 @@ void bindTestsOfArrayModifiers(py::module_ &m) {
     );
 
     m.def("divideFromArrayToRange", &test_divideFromArrayToRange);
+    m.def("modifyStridedViews", &test_modifyStridedViews);
+    m.def("largeArraysAreSharedBetweenThreads", &test_largeArraysAreSharedBetweenThreads);
+
+    utils::bindForFloatingAndIntegralTypes(m, "vectorizedKernelsMatchPortableLoops",
+        []<typename T>(utils::TypeTag<T>) { return &test_vectorizedKernelsMatchPortableLoops<T>; }
+    );
 }
 
 # endif
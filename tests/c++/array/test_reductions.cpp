@@ -0,0 +1,245 @@
+# include "test_reductions.hpp"
+
+# include <cmath>
+# include <limits>
+# include <type_traits>
+
+# include <pybind11/pybind11.h>
+
+# include "array/factory/strings.hpp"
+# include "utils/template_instantiator.hpp"
+# include "utils/thread_pool.hpp"
+
+namespace py = pybind11;
+
+using Reduction = Data::Reduction;
+
+namespace {
+
+double reduced(const Array& array, Reduction reduction, bool skipNaN = false) {
+    return array.reduce(reduction, skipNaN)->itemAsDouble({0});
+}
+
+template <typename T>
+bool reducesToType(const Array& array, Reduction reduction) {
+    return std::dynamic_pointer_cast<Array>(array.reduce(reduction))->hasDataOfType<T>();
+}
+
+Array reducedAlong(const Array& array, size_t axis, Reduction reduction, bool skipNaN = false) {
+    return *std::dynamic_pointer_cast<Array>(array.reduceAlong(axis, reduction, skipNaN));
+}
+
+} // namespace
+
+
+template <typename T>
+void test_reduceConsideringAllTypes() {
+    using Sum = std::conditional_t<std::is_floating_point_v<T>, T,
+        std::conditional_t<std::is_unsigned_v<T> && !std::is_same_v<T, bool>, uint64_t, int64_t>>;
+    using Mean = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+    const int64_t modulo = std::is_same_v<T, bool> ? 2 : 100;
+
+    Array array = arrayfactory::empty<T>({3, 50}, 'C');
+    int64_t sum = 0;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 50; ++j) {
+            const int64_t value = static_cast<int64_t>(i * 50 + j) % modulo;
+            array.setItemFromInt64({i, j}, value);
+            sum += value;
+        }
+    }
+
+    if (!reducesToType<Sum>(array, Reduction::Sum) || reduced(array, Reduction::Sum) != static_cast<double>(sum)) {
+        throw py::value_error("expected the sum typed as in NumPy");
+    }
+    if (!reducesToType<T>(array, Reduction::Max) || reduced(array, Reduction::Min) != 0.0
+        || reduced(array, Reduction::Max) != static_cast<double>(modulo - 1)) {
+        throw py::value_error("expected the extrema typed as the items");
+    }
+    if (reduced(array, Reduction::ArgMin) != 0.0 || reduced(array, Reduction::ArgMax) != static_cast<double>(modulo - 1)) {
+        throw py::value_error("expected the flat index of the first extremum");
+    }
+    if (!reducesToType<Mean>(array, Reduction::Mean)
+        || std::abs(reduced(array, Reduction::Mean) - static_cast<double>(sum) / 150.0) > 1e-5 * static_cast<double>(sum)) {
+        throw py::value_error("expected the mean typed as in NumPy");
+    }
+    if (reduced(array, Reduction::Any) != 1.0 || reduced(array, Reduction::All) != 0.0
+        || reduced(array, Reduction::Count) != 150.0) {
+        throw py::value_error("expected any, all and count of the items");
+    }
+
+    Array columns = reducedAlong(array, 0, Reduction::Sum);
+    Array rows = reducedAlong(array, 1, Reduction::Max);
+    if (columns.shape() != std::vector<size_t>{50} || rows.shape() != std::vector<size_t>{3}) {
+        throw py::value_error("expected the reduced axis to be removed");
+    }
+    for (size_t j = 0; j < 50; ++j) {
+        int64_t expected = 0;
+        for (size_t i = 0; i < 3; ++i) {
+            expected += static_cast<int64_t>(i * 50 + j) % modulo;
+        }
+        if (columns.itemAsInt64({j}) != expected) {
+            throw py::value_error("wrong sum along the first axis");
+        }
+    }
+}
+
+
+void test_reduceAlongEachAxisOfStridedView() {
+    Array base = arrayfactory::empty<double>({6, 8, 10}, 'C');
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            for (size_t k = 0; k < 10; ++k) {
+                base.setItemFromInt64({i, j, k}, static_cast<int64_t>(100 * i + 10 * j + k));
+            }
+        }
+    }
+    // every other item along the last axis
+    const std::vector<size_t> strides = base.strides();
+    Array view(base.typeId(), base.itemsize(), base.rawData(), {6, 8, 5}, {strides[0], strides[1], 2 * strides[2]});
+
+    for (size_t axis = 0; axis < 3; ++axis) {
+        Array sums = reducedAlong(view, axis, Reduction::Sum);
+        Array maxima = reducedAlong(view, axis, Reduction::Max);
+        Array firstMinima = reducedAlong(view, axis, Reduction::ArgMin);
+        for (size_t a = 0; a < sums.shape()[0]; ++a) {
+            for (size_t b = 0; b < sums.shape()[1]; ++b) {
+                double expected = 0.0;
+                double largest = 0.0;
+                for (size_t n = 0; n < view.shape()[axis]; ++n) {
+                    std::vector<size_t> indices{a, b};
+                    indices.insert(indices.begin() + static_cast<std::ptrdiff_t>(axis), n);
+                    const double value = view.itemAsDouble(indices);
+                    expected += value;
+                    largest = std::max(largest, value);
+                }
+                if (sums.itemAsDouble({a, b}) != expected || maxima.itemAsDouble({a, b}) != largest
+                    || firstMinima.itemAsInt64({a, b}) != 0) {
+                    throw py::value_error("wrong reduction along axis " + std::to_string(axis));
+                }
+            }
+        }
+    }
+
+    Array fortran = base.copyWithOrder('F');
+    if (!reducedAlong(fortran, 1, Reduction::Mean).isContiguousInStyleFortran()
+        || reducedAlong(fortran, 1, Reduction::Mean) != reducedAlong(base, 1, Reduction::Mean)) {
+        throw py::value_error("expected results in the memory order of Fortran arrays");
+    }
+}
+
+
+void test_skipNaN() {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    Array array = arrayfactory::empty<double>({5}, 'C');
+    const double values[] = {nan, 1.0, 2.0, nan, -4.0};
+    for (size_t i = 0; i < 5; ++i) {
+        array.getPointerOfModifiableDataFast<double>()[i] = values[i];
+    }
+
+    if (!std::isnan(reduced(array, Reduction::Sum)) || !std::isnan(reduced(array, Reduction::Max))
+        || reduced(array, Reduction::ArgMax) != 0.0) {
+        throw py::value_error("expected NaN to propagate");
+    }
+    if (reduced(array, Reduction::Sum, true) != -1.0 || reduced(array, Reduction::Max, true) != 2.0
+        || reduced(array, Reduction::ArgMax, true) != 2.0 || reduced(array, Reduction::Count, true) != 3.0
+        || reduced(array, Reduction::Mean, true) != -1.0 / 3.0) {
+        throw py::value_error("expected NaN to be skipped");
+    }
+
+    // items counted in the same pass, over contiguous runs and item by item
+    Array everyOther(array.typeId(), array.itemsize(), array.rawData(), {3}, {2 * array.itemsize()});
+    const Data::CountedReduction largest = array.reduceCounted(Reduction::Max, true);
+    const Data::CountedReduction sum = everyOther.reduceCounted(Reduction::Sum, true);
+    if (largest.value->itemAsDouble({0}) != 2.0 || largest.items != 3
+        || sum.value->itemAsDouble({0}) != -2.0 || sum.items != 2
+        || array.reduceCounted(Reduction::Min).items != 5 || everyOther.reduceCounted(Reduction::Min).items != 3) {
+        throw py::value_error("expected the items reduced to be counted");
+    }
+
+    Array allNaN = arrayfactory::full<double>({2, 3}, nan);
+    if (!std::isnan(reducedAlong(allNaN, 1, Reduction::Min, true).itemAsDouble({1}))
+        || reducedAlong(allNaN, 0, Reduction::Sum, true).itemAsDouble({2}) != 0.0) {
+        throw py::value_error("expected NumPy results for slices of skipped NaN");
+    }
+}
+
+
+void test_compensatedSumOfFloats() {
+    // a float accumulated item by item drifts by more than 1% over these sums
+    const size_t items = 1000000;
+    const double expected = static_cast<double>(0.1f) * static_cast<double>(items);
+    Array array = arrayfactory::full<float>({items}, 0.1f);
+    Array columns = arrayfactory::full<float>({items / 4, 4}, 0.1f);
+
+    if (std::abs(reduced(array, Reduction::Sum) - expected) > 0.02) {
+        throw py::value_error("expected a pairwise sum of contiguous floats");
+    }
+    if (std::abs(reducedAlong(columns, 0, Reduction::Sum).itemAsDouble({3}) - expected / 4) > 0.02) {
+        throw py::value_error("expected a compensated sum along strided slices");
+    }
+}
+
+
+void test_reductionsSharedBetweenThreads() {
+    // 8 MiB array, whose largest item is met twice
+    const size_t rows = 1024;
+    const size_t columns = 1024;
+    utils::ThreadPool& pool = utils::ThreadPool::shared();
+    const size_t threads = pool.threads();
+    std::vector<Array> results;
+    for (size_t poolSize : {size_t{1}, size_t{4}}) {
+        pool.setThreads(poolSize);
+        Array array = arrayfactory::uniformFromStep<double>(0, static_cast<double>(rows * columns));
+        array.getPointerOfModifiableDataFast<double>()[700000] = 1e7;
+        array.getPointerOfModifiableDataFast<double>()[900000] = 1e7;
+        Array matrix(array.typeId(), array.itemsize(), array.rawData(), {rows, columns}, {columns * 8, 8});
+        const double sum = static_cast<double>(rows * columns) * static_cast<double>(rows * columns - 1) / 2.0;
+        const bool matches = array.reduce(Reduction::Sum)->itemAsDouble({0}) == sum - 1600000.0 + 2e7
+            && array.reduce(Reduction::ArgMax)->itemAsDouble({0}) == 700000.0;
+        results.push_back(reducedAlong(matrix, 0, Reduction::Max));
+        results.push_back(reducedAlong(matrix, 1, Reduction::Sum));
+        if (!matches) {
+            pool.setThreads(threads);
+            throw py::value_error("expected large arrays to be reduced on the thread pool");
+        }
+    }
+    pool.setThreads(threads);
+    if (results[0] != results[2] || results[1] != results[3] || results[0].itemAsDouble({700000 % columns}) != 1e7) {
+        throw py::value_error("expected the same reductions on one and several threads");
+    }
+}
+
+
+void test_catchErrorWhenReducingStringsOrNoItems() {
+    Array empty = arrayfactory::zeros<double>({0, 3});
+    if (reduced(empty, Reduction::Sum) != 0.0 || reducedAlong(empty, 0, Reduction::Count).itemAsInt64({2}) != 0) {
+        throw py::value_error("expected sums and counts of no items");
+    }
+
+    const auto throwsInvalidArgument = [](auto&& reduce) {
+        try {
+            reduce();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+    if (!throwsInvalidArgument([&]() { empty.reduce(Reduction::Max); })
+        || !throwsInvalidArgument([&]() { empty.reduceAlong(0, Reduction::ArgMin); })
+        || !throwsInvalidArgument([&]() { empty.reduceAlong(2, Reduction::Sum); })
+        || !throwsInvalidArgument([]() { arrayfactory::arrayFromString("text").reduce(Reduction::Sum); })) {
+        throw std::runtime_error("should have raised an error");
+    }
+}
+
+
+template <typename... T>
+struct InstantiatorScalars {
+    template <typename... U>
+    void operator()() const {
+        (utils::forceSymbol(&test_reduceConsideringAllTypes<U>), ...);
+    }
+};
+
+template void utils::instantiateFromTypeList<InstantiatorScalars, utils::ScalarTypes>();
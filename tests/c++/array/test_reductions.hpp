@@ -0,0 +1,21 @@
+# ifndef TEST_ARRAY_REDUCTIONS_HPP
+# define TEST_ARRAY_REDUCTIONS_HPP
+
+# include <array/array.hpp>
+# include <array/factory/matrices.hpp>
+# include <array/factory/vectors.hpp>
+
+template <typename T>
+void test_reduceConsideringAllTypes();
+
+void test_reduceAlongEachAxisOfStridedView();
+
+void test_skipNaN();
+
+void test_compensatedSumOfFloats();
+
+void test_reductionsSharedBetweenThreads();
+
+void test_catchErrorWhenReducingStringsOrNoItems();
+
+# endif
@@ -0,0 +1,20 @@
+# ifndef TEST_ARRAY_REDUCTIONS_PYBIND_HPP
+# define TEST_ARRAY_REDUCTIONS_PYBIND_HPP
+
+# include "utils/template_binder.hpp"
+# include "test_reductions.hpp"
+
+void bindTestsOfArrayReductions(py::module_ &m) {
+
+    utils::bindForScalarTypes(m, "reduceConsideringAllTypes",
+        []<typename T>(utils::TypeTag<T>) { return &test_reduceConsideringAllTypes<T>; }
+    );
+
+    m.def("reduceAlongEachAxisOfStridedView", &test_reduceAlongEachAxisOfStridedView);
+    m.def("skipNaN", &test_skipNaN);
+    m.def("compensatedSumOfFloats", &test_compensatedSumOfFloats);
+    m.def("reductionsSharedBetweenThreads", &test_reductionsSharedBetweenThreads);
+    m.def("catchErrorWhenReducingStringsOrNoItems", &test_catchErrorWhenReducingStringsOrNoItems);
+}
+
+# endif
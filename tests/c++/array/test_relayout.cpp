@@ -0,0 +1,126 @@
+# include "test_relayout.hpp"
+
+# include <cstring>
+# include <type_traits>
+
+# include <pybind11/pybind11.h>
+
+# include "utils/template_instantiator.hpp"
+
+namespace py = pybind11;
+
+
+template <typename T>
+void test_copyInOrderConsideringAllTypes() {
+    const int64_t modulo = std::is_same_v<T, bool> ? 2 : 100;
+    Array array = arrayfactory::empty<T>({7, 40, 33}, 'C');
+    for (size_t i = 0; i < 7; ++i) {
+        for (size_t j = 0; j < 40; ++j) {
+            for (size_t k = 0; k < 33; ++k) {
+                array.setItemFromInt64({i, j, k}, static_cast<int64_t>(i * 7 + j * 3 + k) % modulo);
+            }
+        }
+    }
+
+    Array fortran = array.copyWithOrder('F');
+    Array backToC = fortran.copyWithOrder('C');
+    if (!fortran.isContiguousInStyleFortran() || !backToC.isContiguousInStyleC()) {
+        throw py::value_error("expected copies laid out in the requested order");
+    }
+    if (fortran.copyWithOrder('A').isContiguousInStyleC() || !backToC.copyWithOrder('A').isContiguousInStyleC()) {
+        throw py::value_error("expected order 'A' to keep the layout of the copied array");
+    }
+    for (size_t i = 0; i < 7; ++i) {
+        for (size_t j = 0; j < 40; ++j) {
+            for (size_t k = 0; k < 33; ++k) {
+                const int64_t expected = static_cast<int64_t>(i * 7 + j * 3 + k) % modulo;
+                if (fortran.itemAsInt64({i, j, k}) != expected || backToC.itemAsInt64({i, j, k}) != expected) {
+                    throw py::value_error("expected copies to keep the values of the array");
+                }
+            }
+        }
+    }
+    if (fortran.rawData() == array.rawData()) {
+        throw py::value_error("expected a deep copy");
+    }
+}
+
+void test_copyStridedTransposesView() {
+    Array base = arrayfactory::empty<int32_t>({37, 70}, 'C');
+    for (size_t i = 0; i < 37; ++i) {
+        for (size_t j = 0; j < 70; ++j) {
+            base.setItemFromInt64({i, j}, static_cast<int64_t>(100 * i + j));
+        }
+    }
+    // every other column of the base array
+    const std::vector<size_t> baseStrides = base.strides();
+    Array view(base.typeId(), base.itemsize(), base.rawData(), {37, 35}, {baseStrides[0], 2 * baseStrides[1]});
+
+    for (char order : {'C', 'F'}) {
+        Array copied = arrayfactory::empty<int32_t>({37, 35}, order);
+        arraylayout::copyToContiguous(view, copied.rawData(), order);
+        for (size_t i = 0; i < 37; ++i) {
+            for (size_t j = 0; j < 35; ++j) {
+                if (copied.itemAsInt64({i, j}) != static_cast<int64_t>(100 * i + 2 * j)) {
+                    throw py::value_error(std::string("wrong value after copying a view in order ") + order);
+                }
+            }
+        }
+    }
+}
+
+void test_copyStridedSharedBetweenThreads() {
+    Array array = arrayfactory::empty<double>({300, 700, 2}, 'F');
+    for (size_t i = 0; i < 300; ++i) {
+        for (size_t j = 0; j < 700; ++j) {
+            for (size_t k = 0; k < 2; ++k) {
+                array.setItemFromInt64({i, j, k}, static_cast<int64_t>(i + 1000 * j + 1000000 * k));
+            }
+        }
+    }
+
+    Array copied = array.copyWithOrder('C', 4);
+    Array reference = array.copyWithOrder('C', 1);
+    if (!(copied == reference)) {
+        throw py::value_error("expected the same copy whatever the number of threads");
+    }
+    if (copied.itemAsInt64({299, 699, 1}) != 299 + 1000 * 699 + 1000000) {
+        throw py::value_error("wrong value after a multithreaded copy");
+    }
+}
+
+void test_copyStridedWithOddItemSize() {
+    // 3-byte items, shape (4, 5) in C order copied to F order
+    std::vector<std::uint8_t> source(4 * 5 * 3);
+    for (size_t n = 0; n < source.size(); ++n) {
+        source[n] = static_cast<std::uint8_t>(n);
+    }
+    std::vector<std::uint8_t> destination(source.size(), 0);
+    arraylayout::copyStrided(source.data(), {15, 3}, destination.data(), {3, 12}, {4, 5}, 3);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            if (std::memcmp(destination.data() + 3 * i + 12 * j, source.data() + 15 * i + 3 * j, 3) != 0) {
+                throw py::value_error("wrong item after copying 3-byte items");
+            }
+        }
+    }
+}
+
+void test_catchErrorWhenCopyingInUnknownOrder() {
+    Array array = arrayfactory::zeros<int32_t>({2, 3});
+    try {
+        array.copyWithOrder('X');
+        throw std::runtime_error("should have raised an error");
+    } catch (const std::invalid_argument&) {
+    }
+}
+
+template <typename... T>
+struct InstantiatorScalars {
+    template <typename... U>
+    void operator()() const {
+        (utils::forceSymbol(&test_copyInOrderConsideringAllTypes<U>), ...);
+    }
+};
+
+template void utils::instantiateFromTypeList<InstantiatorScalars, utils::ScalarTypes>();
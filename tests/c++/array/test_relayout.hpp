@@ -0,0 +1,19 @@
+# ifndef TEST_ARRAY_RELAYOUT_HPP
+# define TEST_ARRAY_RELAYOUT_HPP
+
+# include <array/array.hpp>
+# include <array/relayout.hpp>
+# include <array/factory/matrices.hpp>
+
+template <typename T>
+void test_copyInOrderConsideringAllTypes();
+
+void test_copyStridedTransposesView();
+
+void test_copyStridedSharedBetweenThreads();
+
+void test_copyStridedWithOddItemSize();
+
+void test_catchErrorWhenCopyingInUnknownOrder();
+
+# endif
@@ -0,0 +1,19 @@
+# ifndef TEST_ARRAY_RELAYOUT_PYBIND_HPP
+# define TEST_ARRAY_RELAYOUT_PYBIND_HPP
+
+# include "utils/template_binder.hpp"
+# include "test_relayout.hpp"
+
+void bindTestsOfArrayRelayout(py::module_ &m) {
+
+    utils::bindForScalarTypes(m, "copyInOrderConsideringAllTypes",
+        []<typename T>(utils::TypeTag<T>) { return &test_copyInOrderConsideringAllTypes<T>; }
+    );
+
+    m.def("copyStridedTransposesView", &test_copyStridedTransposesView);
+    m.def("copyStridedSharedBetweenThreads", &test_copyStridedSharedBetweenThreads);
+    m.def("copyStridedWithOddItemSize", &test_copyStridedWithOddItemSize);
+    m.def("catchErrorWhenCopyingInUnknownOrder", &test_catchErrorWhenCopyingInUnknownOrder);
+}
+
+# endif
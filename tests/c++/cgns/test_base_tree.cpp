@@ -9,6 +9,8 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -153,3 +155,51 @@ void test_newZoneFromArrays() {
         throw py::value_error("unexpected Pressure shape");
     }
 }
+
+void test_reduce_field_over_zones() {
+    auto zoneA = makeCartesianZone("ZoneA", {3, 3, 3});
+    auto zoneB = makeCartesianZone("ZoneB", {4, 3, 2});
+    auto base = newBase("BaseA", {zoneA});
+    auto tree = std::make_shared<Tree>();
+    tree->add(base);
+    tree->add(newBase("BaseB", {zoneB}));
+    zoneA->newFields({{"q", 7.0}});
+    zoneB->newFields({{"q", -2.0}});
+
+    if (zoneA->reduceField("q", Data::Reduction::Max) != 7.0) throw py::value_error("expected zone maximum 7");
+    if (base->reduceField("q", Data::Reduction::Sum) != 189.0) throw py::value_error("expected base sum 189");
+    if (tree->reduceField("q", Data::Reduction::Min) != -2.0) throw py::value_error("expected tree minimum -2");
+    if (tree->reduceField("q", Data::Reduction::Max) != 7.0) throw py::value_error("expected tree maximum 7");
+    if (tree->reduceField("q", Data::Reduction::Count) != 51.0) throw py::value_error("expected 51 items");
+    if (std::abs(tree->reduceField("q", Data::Reduction::Mean) - 141.0 / 51.0) > 1e-12) {
+        throw py::value_error("expected the mean over all items");
+    }
+    if (std::abs(tree->reduceField("q", Data::Reduction::Norm) - std::sqrt(1419.0)) > 1e-12) {
+        throw py::value_error("expected the norm over all items");
+    }
+
+    auto q = std::dynamic_pointer_cast<Array>(zoneB->field("q"));
+    q->getPointerOfModifiableDataFast<double>()[0] = std::numeric_limits<double>::quiet_NaN();
+    if (!std::isnan(tree->reduceField("q", Data::Reduction::Min))) throw py::value_error("expected NaN to propagate");
+    if (tree->reduceField("q", Data::Reduction::Min, "FlowSolution", true) != -2.0
+        || tree->reduceField("q", Data::Reduction::Count, "FlowSolution", true) != 50.0
+        || std::abs(tree->reduceField("q", Data::Reduction::Mean, "FlowSolution", true) - 143.0 / 50.0) > 1e-12) {
+        throw py::value_error("expected NaN to be skipped");
+    }
+
+    bool raised = false;
+    try {
+        (void)tree->reduceField("q", Data::Reduction::ArgMax);
+    } catch (const std::invalid_argument&) {
+        raised = true;
+    }
+    if (!raised) throw py::value_error("argmax should be rejected over several zones");
+
+    raised = false;
+    try {
+        (void)tree->reduceField("missing", Data::Reduction::Sum);
+    } catch (const std::runtime_error&) {
+        raised = true;
+    }
+    if (!raised) throw py::value_error("missing fields should be reported");
+}
@@ -6,5 +6,6 @@ void test_base_aggregates_zones();
 void test_tree_aggregates_bases_and_zones();
 void test_new_base_rejects_incoherent_dimensions();
 void test_newZoneFromArrays();
+void test_reduce_field_over_zones();
 
 #endif
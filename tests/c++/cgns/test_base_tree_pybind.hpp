@@ -12,6 +12,7 @@ void bindTestsOfBaseTree(py::module_& m) {
     sm.def("test_tree_aggregates_bases_and_zones", &test_tree_aggregates_bases_and_zones);
     sm.def("test_new_base_rejects_incoherent_dimensions", &test_new_base_rejects_incoherent_dimensions);
     sm.def("test_newZoneFromArrays", &test_newZoneFromArrays);
+    sm.def("test_reduce_field_over_zones", &test_reduce_field_over_zones);
 }
 
 #endif
@@ -5,16 +5,19 @@
 # include <io/io.hpp>
 # include <array/factory/vectors.hpp>
 # include <node/node_factory.hpp>
+# include <data/deferred_data.hpp>
+# include <node/tree_diff.hpp>
 # include <hdf5.h>
 # include <sstream>
+# include <thread>
 # include <vector>
 
 using namespace std::string_literals;
 using namespace io;
 using namespace arrayfactory;
-
-namespace test_io {
-
+
+namespace test_io {
+
 void test_write_nodes( std::string filename = "test.cgns") {
      auto a = newNode("a", "DataArray_t");
      Array arrA = uniformFromStep<int32_t>(0, 10);
@@ -32,29 +35,480 @@ void test_write_nodes( std::string filename = "test.cgns") {
 
      auto d = newNode("d", "DataArray_t");
      d->attachTo(b);
-
-     write_node(filename, a);
-}
-
-std::shared_ptr<Node> test_read( std::string tmp_filename = "test_read.cgns") {
-     test_write_nodes(tmp_filename);
-     auto node = read(tmp_filename);
-     return node;
-}
-
+
+     write_node(filename, a);
+}
+
+std::shared_ptr<Node> test_read( std::string tmp_filename = "test_read.cgns") {
+     test_write_nodes(tmp_filename);
+     auto node = read(tmp_filename);
+     return node;
+}
+
+void test_read_lazy( std::string tmp_filename = "test_read_lazy.cgns") {
+     test_write_nodes(tmp_filename);
+     ReadOptions options;
+     options.lazy = true;
+     auto node = read(tmp_filename, options);
+
+     auto b = node->pick().byName("b");
+     if (!b) throw std::runtime_error("lazy read: node b not found");
+     auto deferred = std::dynamic_pointer_cast<DeferredData>(b->data().clone());
+     if (!deferred) throw std::runtime_error("lazy read: expected a deferred payload");
+     if (b->data().shape() != std::vector<size_t>{5} || b->data().dtype() != "float32") {
+          throw std::runtime_error("lazy read: wrong deferred metadata");
+     }
+     std::ostringstream tree;
+     tree << node->printTree();
+     if (deferred->isLoaded()) throw std::runtime_error("lazy read: metadata access loaded payload");
+
+     auto array = std::dynamic_pointer_cast<Array>(b->dataPtr());
+     if (!array || array->size() != 5) throw std::runtime_error("lazy read: wrong loaded payload");
+     if (!deferred->isLoaded()) throw std::runtime_error("lazy read: payload not shared with clones");
+
+     if (node->pick().byName("c")->data().extractString() != "toto") {
+          throw std::runtime_error("lazy read: wrong string payload");
+     }
+
+     // concurrent loads share one payload, and the node keeps its placeholder
+     auto a = node->pick().byName("a");
+     std::vector<std::shared_ptr<Data>> loaded(4);
+     std::vector<std::thread> threads;
+     for (size_t i = 0; i < loaded.size(); ++i) {
+          threads.emplace_back([&a, &loaded, i]() { loaded[i] = a->dataPtr(); });
+     }
+     for (auto& thread : threads) {
+          thread.join();
+     }
+     for (const auto& payload : loaded) {
+          if (payload != loaded[0] || !std::dynamic_pointer_cast<Array>(payload)) {
+               throw std::runtime_error("lazy read: concurrent loads should share one payload");
+          }
+     }
+     if (!dynamic_cast<const DeferredData*>(&a->data()) || a->dataPtr() != loaded[0]) {
+          throw std::runtime_error("lazy read: the placeholder should forward to the loaded payload");
+     }
+}
+
+void test_diff_lazy( std::string tmp_filename = "test_diff_lazy.cgns") {
+     const std::string otherFilename = tmp_filename + ".other.cgns";
+     test_write_nodes(tmp_filename);
+     auto other = read(tmp_filename);
+     other->pick().byName("b")->setData(uniformFromCount<float>(-1, 1, 6));
+     write_node(otherFilename, other);
+
+     ReadOptions options;
+     options.lazy = true;
+     auto before = read(tmp_filename, options);
+     auto after = read(otherFilename, options);
+     const TreePatch patch = TreePatch::diff(*before, *after);
+     if (patch.size() != 1 || patch.changes()[0].kind != TreePatch::Kind::DataChanged
+          || !std::dynamic_pointer_cast<Array>(patch.changes()[0].data)
+          || patch.changes()[0].data->size() != 6) {
+          throw std::runtime_error("lazy diff: expected the changed payload of b only");
+     }
+
+     // payloads of different shapes are told apart from their placeholders
+     const auto* deferred = dynamic_cast<const DeferredData*>(&before->pick().byName("b")->data());
+     if (!deferred || deferred->isLoaded()) {
+          throw std::runtime_error("lazy diff: payloads of different shapes should not be loaded");
+     }
+}
+
+void test_read_filtered( std::string tmp_filename = "test_read_filtered.cgns") {
+     test_write_nodes(tmp_filename);
+
+     ReadOptions options;
+     options.includePatterns = {"?/b"};
+     auto node = read(tmp_filename, options);
+     if (node->children().size() != 1 || node->children()[0]->name() != "a") {
+          throw std::runtime_error("filtered read: expected only 'a' at root level");
+     }
+     auto a = node->children()[0];
+     if (!a->noData()) throw std::runtime_error("filtered read: ancestor payload should not be read");
+     if (a->children().size() != 1 || a->children()[0]->name() != "b") {
+          throw std::runtime_error("filtered read: expected only 'b' under 'a'");
+     }
+     if (a->children()[0]->data().size() != 5 || a->children()[0]->children().size() != 1) {
+          throw std::runtime_error("filtered read: selected subtree not fully read");
+     }
+
+     options.excludePatterns = {"a/b/d"};
+     node = read(tmp_filename, options);
+     if (!node->getAtPath("a/b")->children().empty()) {
+          throw std::runtime_error("filtered read: excluded node was read");
+     }
+
+     ReadOptions depthOptions;
+     depthOptions.maxDepth = 1;
+     node = read(tmp_filename, depthOptions);
+     if (node->children().size() != 2 || !node->getAtPath("a")->children().empty()) {
+          throw std::runtime_error("filtered read: maxDepth not honoured");
+     }
+}
+
+void test_read_write_slab( std::string tmp_filename = "test_read_write_slab.cgns") {
+     auto root = newNode("root", "UserDefinedData_t");
+     auto field = newNode("field", "DataArray_t");
+     Array values = arrayfactory::empty<int32_t>({4, 3}, 'F');
+     for (size_t i = 0; i < 4; ++i) {
+          for (size_t j = 0; j < 3; ++j) {
+               values.setItemFromInt64({i, j}, static_cast<int64_t>(10 * i + j));
+          }
+     }
+     field->setData(values);
+     field->attachTo(root);
+     write_node(tmp_filename, root);
+
+     Hyperslab slab;
+     slab.start = {1, 0};
+     slab.count = {2, 2};
+     slab.stride = {2, 2};
+     for (char order : {'C', 'F'}) {
+          Array block = read_data_slab(tmp_filename, "root/field", slab, order);
+          if (block.shape() != std::vector<size_t>{2, 2}
+              || block.itemAsInt64({0, 0}) != 10 || block.itemAsInt64({0, 1}) != 12
+              || block.itemAsInt64({1, 0}) != 30 || block.itemAsInt64({1, 1}) != 32) {
+               throw std::runtime_error("slab read: wrong values");
+          }
+     }
+
+     Array face = arrayfactory::empty<int32_t>({1, 3}, 'C');
+     for (size_t j = 0; j < 3; ++j) face.setItemFromInt64({0, j}, -1);
+     Hyperslab faceSlab;
+     faceSlab.start = {3, 0};
+     write_data_slab(tmp_filename, "/root/field/", face, faceSlab);
+
+     auto loaded = read(tmp_filename)->getAtPath("root/field");
+     if (loaded->data().itemAsInt64({3, 2}) != -1 || loaded->data().itemAsInt64({2, 2}) != 22) {
+          throw std::runtime_error("slab write: wrong values");
+     }
+
+     // strided selections, from a C-ordered block and from a Fortran one
+     Array rows = arrayfactory::empty<int32_t>({2, 3}, 'C');
+     for (size_t i = 0; i < 2; ++i) {
+          for (size_t j = 0; j < 3; ++j) rows.setItemFromInt64({i, j}, static_cast<int64_t>(100 + 10 * i + j));
+     }
+     Hyperslab rowsSlab;
+     rowsSlab.start = {0, 0};
+     rowsSlab.stride = {2, 1};
+     write_data_slab(tmp_filename, "root/field", rows, rowsSlab);
+     Array corner = arrayfactory::empty<int32_t>({1, 2}, 'F');
+     corner.setItemFromInt64({0, 0}, -5);
+     corner.setItemFromInt64({0, 1}, -6);
+     Hyperslab cornerSlab;
+     cornerSlab.start = {1, 0};
+     cornerSlab.stride = {1, 2};
+     write_data_slab(tmp_filename, "root/field", corner, cornerSlab);
+
+     const std::vector<int64_t> expected = {100, 101, 102, -5, 11, -6, 110, 111, 112, -1, -1, -1};
+     loaded = read(tmp_filename)->getAtPath("root/field");
+     for (size_t i = 0; i < 4; ++i) {
+          for (size_t j = 0; j < 3; ++j) {
+               if (loaded->data().itemAsInt64({i, j}) != expected[3 * i + j]) {
+                    throw std::runtime_error("slab write: wrong values from a strided selection");
+               }
+          }
+     }
+
+     ReadOptions options;
+     options.lazy = true;
+     auto lazyField = read(tmp_filename, options)->getAtPath("root/field");
+     auto deferred = std::dynamic_pointer_cast<DeferredData>(lazyField->data().clone());
+     auto row = lazyField->data().take(-1, 0);
+     if (!deferred || deferred->isLoaded() || row->shape() != std::vector<size_t>{3} || row->itemAsInt64({1}) != -1) {
+          throw std::runtime_error("slab read: deferred take should read one row only");
+     }
+
+     bool raised = false;
+     try {
+          Hyperslab outside;
+          outside.start = {4, 0};
+          outside.count = {1, 1};
+          read_data_slab(tmp_filename, "root/field", outside);
+     } catch (const std::out_of_range&) {
+          raised = true;
+     }
+     if (!raised) throw std::runtime_error("slab read: out of bounds selection not rejected");
+}
+
+void test_read_parallel( std::string tmp_filename = "test_read_parallel.cgns") {
+     auto base = newNode("Base", "CGNSBase_t");
+     for (size_t z = 0; z < 12; ++z) {
+          auto zone = newNode("Zone" + std::to_string(z), "Zone_t");
+          Array dims = arrayfactory::empty<int64_t>({3, 2}, 'F');
+          for (size_t i = 0; i < 3; ++i) {
+               dims.setItemFromInt64({i, 0}, static_cast<int64_t>(z + i));
+               dims.setItemFromInt64({i, 1}, static_cast<int64_t>(z * i));
+          }
+          zone->setData(dims);
+          zone->attachTo(base);
+          auto field = newNode("Field", "DataArray_t");
+          Array values = arrayfactory::empty<float>({5, 4, 3}, 'F');
+          for (size_t i = 0; i < 5; ++i) {
+               for (size_t j = 0; j < 4; ++j) {
+                    for (size_t k = 0; k < 3; ++k) {
+                         values.setItemFromInt64({i, j, k}, static_cast<int64_t>(z + 100 * i + 10 * j + k));
+                    }
+               }
+          }
+          field->setData(values);
+          field->attachTo(zone);
+          auto family = newNode("FamilyName", "FamilyName_t");
+          family->setData("Family" + std::to_string(z));
+          family->attachTo(zone);
+     }
+     write_node(tmp_filename, base);
+
+     for (char order : {'C', 'F'}) {
+          ReadOptions serialOptions;
+          serialOptions.order = order;
+          auto serial = read(tmp_filename, serialOptions)->descendants();
+          for (size_t threads : {size_t{0}, size_t{4}}) {
+               ReadOptions parallelOptions = serialOptions;
+               parallelOptions.threads = threads;
+               auto parallel = read(tmp_filename, parallelOptions)->descendants();
+               if (parallel.size() != serial.size()) {
+                    throw std::runtime_error("parallel read: wrong number of nodes");
+               }
+               for (size_t n = 0; n < serial.size(); ++n) {
+                    const Data& expected = serial[n]->data();
+                    const Data& got = parallel[n]->data();
+                    if (serial[n]->path() != parallel[n]->path() || expected.shape() != got.shape()
+                         || expected.dtype() != got.dtype()) {
+                         throw std::runtime_error("parallel read: different node at " + serial[n]->path());
+                    }
+                    if (!expected.isNone()
+                         && !(dynamic_cast<const Array&>(expected) == dynamic_cast<const Array&>(got))) {
+                         throw std::runtime_error("parallel read: different values at " + serial[n]->path());
+                    }
+               }
+          }
+     }
+}
+
+void test_write_compressed( std::string tmp_filename = "test_write_compressed.cgns") {
+     auto root = newNode("root", "UserDefinedData_t");
+     auto field = newNode("field", "DataArray_t");
+     Array values = arrayfactory::empty<double>({64, 32}, 'F');
+     for (size_t i = 0; i < 64; ++i) {
+          for (size_t j = 0; j < 32; ++j) {
+               values.setItemFromInt64({i, j}, static_cast<int64_t>(i % 4));
+          }
+     }
+     field->setData(values);
+     field->attachTo(root);
+     auto small = newNode("small", "DataArray_t");
+     small->setData(arrayfactory::empty<int32_t>({2}, 'F'));
+     small->attachTo(root);
+
+     WriteOptions options;
+     options.deflateLevel = 4;
+     options.shuffle = true;
+     options.chunkPolicy = ChunkPolicy::Fixed;
+     options.chunkShape = {16, 32};
+     options.minChunkedBytes = 64;
+     write_node(tmp_filename, root, options);
+
+     auto layoutOf = [&tmp_filename](const std::string& path, int& filterCount, std::vector<hsize_t>& chunk) {
+          hid_t file = H5Fopen(tmp_filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+          hid_t dset = H5Dopen2(file, path.c_str(), H5P_DEFAULT);
+          hid_t dcpl = H5Dget_create_plist(dset);
+          H5D_layout_t layout = H5Pget_layout(dcpl);
+          filterCount = H5Pget_nfilters(dcpl);
+          chunk.assign(2, 0);
+          if (layout == H5D_CHUNKED) H5Pget_chunk(dcpl, 2, chunk.data());
+          H5Pclose(dcpl);
+          H5Dclose(dset);
+          H5Fclose(file);
+          return layout;
+     };
+     int filterCount = 0;
+     std::vector<hsize_t> chunk;
+     if (layoutOf("/root/field/ data", filterCount, chunk) != H5D_CHUNKED || filterCount != 2
+         || chunk != std::vector<hsize_t>{32, 16}) {
+          throw std::runtime_error("compressed write: field should be chunked with shuffle and deflate");
+     }
+     if (layoutOf("/root/small/ data", filterCount, chunk) != H5D_CONTIGUOUS) {
+          throw std::runtime_error("compressed write: arrays below the size threshold should stay contiguous");
+     }
+
+     auto loaded = read(tmp_filename)->getAtPath("root/field");
+     if (loaded->data().shape() != std::vector<size_t>{64, 32}
+         || loaded->data().itemAsInt64({7, 31}) != 3 || loaded->data().itemAsInt64({62, 0}) != 2) {
+          throw std::runtime_error("compressed write: wrong values read back");
+     }
+
+     bool raised = false;
+     try {
+          WriteOptions invalid;
+          invalid.deflateLevel = 1;
+          invalid.chunkPolicy = ChunkPolicy::Contiguous;
+          write_node(tmp_filename, root, invalid);
+     } catch (const std::invalid_argument&) {
+          raised = true;
+     }
+     if (!raised) throw std::runtime_error("compressed write: filters without chunks not rejected");
+}
+
+void test_write_staged_layouts( std::string tmp_filename = "test_write_staged_layouts.cgns") {
+     Array base = arrayfactory::empty<double>({10, 6, 4}, 'C');
+     for (size_t i = 0; i < 10; ++i) {
+          for (size_t j = 0; j < 6; ++j) {
+               for (size_t k = 0; k < 4; ++k) {
+                    base.setItemFromInt64({i, j, k}, static_cast<int64_t>(100 * i + 10 * j + k));
+               }
+          }
+     }
+     const std::vector<size_t> strides = base.strides();
+     Array strided(base.typeId(), base.itemsize(), base.rawData(), {5, 6, 2},
+                   {2 * strides[0], strides[1], 2 * strides[2]});
+     Array fortran = arrayfactory::empty<double>({10, 6, 4}, 'F');
+     for (size_t i = 0; i < 10; ++i) {
+          for (size_t j = 0; j < 6; ++j) {
+               for (size_t k = 0; k < 4; ++k) {
+                    fortran.setItemFromInt64({i, j, k}, base.itemAsInt64({i, j, k}));
+               }
+          }
+     }
+
+     auto root = newNode("root", "UserDefinedData_t");
+     const std::vector<std::pair<std::string, Array>> fields = {
+          {"fortran", fortran}, {"c", base}, {"strided", strided}};
+     for (const auto& [name, values] : fields) {
+          auto field = newNode(name, "DataArray_t");
+          field->setData(values);
+          field->attachTo(root);
+     }
+
+     // staging buffers smaller than a disk row, a few rows and the whole array
+     for (size_t stagingBytes : {size_t{16}, size_t{200}, size_t{1} << 20}) {
+          WriteOptions options;
+          options.stagingBytes = stagingBytes;
+          write_node(tmp_filename, root, options);
+          auto loaded = read(tmp_filename);
+          for (const auto& [name, values] : fields) {
+               const Data& got = loaded->getAtPath("root/" + name)->data();
+               const std::vector<size_t> shape = values.shape();
+               if (got.shape() != shape) {
+                    throw std::runtime_error("staged write: wrong shape read back for " + name);
+               }
+               for (size_t i = 0; i < shape[0]; ++i) {
+                    for (size_t j = 0; j < shape[1]; ++j) {
+                         for (size_t k = 0; k < shape[2]; ++k) {
+                              if (got.itemAsInt64({i, j, k}) != values.itemAsInt64({i, j, k})) {
+                                   throw std::runtime_error("staged write: wrong values read back for " + name);
+                              }
+                         }
+                    }
+               }
+          }
+     }
+}
+
+void test_write_incremental( std::string tmp_filename = "test_write_incremental.cgns") {
+     auto tree = newNode("CGNSTree", "CGNSTree_t");
+     auto base = newNode("Base", "CGNSBase_t");
+     base->setData(uniformFromStep<int32_t>(2, 4));
+     base->attachTo(tree);
+     for (size_t z = 0; z < 3; ++z) {
+          auto zone = newNode("Zone" + std::to_string(z), "Zone_t");
+          zone->setData(uniformFromStep<int32_t>(7, 10));
+          zone->attachTo(base);
+          auto coordinates = newNode("GridCoordinates", "GridCoordinates_t");
+          coordinates->attachTo(zone);
+          auto x = newNode("CoordinateX", "DataArray_t");
+          x->setData(uniformFromStep<double>(0, 8));
+          x->attachTo(coordinates);
+          auto solution = newNode("FlowSolution", "FlowSolution_t");
+          solution->attachTo(zone);
+          auto density = newNode("Density", "DataArray_t");
+          density->setData(uniformFromStep<double>(0, 8));
+          density->attachTo(solution);
+     }
+     auto family = newNode("Family", "Family_t");
+     family->attachTo(base);
+
+     WriteOptions options;
+     options.incremental = true;
+     write_node(tmp_filename, tree, options);
+
+     // change a dataset behind the writer's back: only rewritten datasets lose the change
+     const auto overwriteFirstValue = [&tmp_filename](const std::string& dataPath) {
+          hid_t file = H5Fopen(tmp_filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+          hid_t dset = H5Dopen2(file, dataPath.c_str(), H5P_DEFAULT);
+          hsize_t start[1] = {0};
+          hsize_t count[1] = {1};
+          hid_t fileSpace = H5Dget_space(dset);
+          H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+          hid_t memSpace = H5Screate_simple(1, count, nullptr);
+          const double value = -1.0;
+          H5Dwrite(dset, H5T_NATIVE_DOUBLE, memSpace, fileSpace, H5P_DEFAULT, &value);
+          H5Sclose(memSpace);
+          H5Sclose(fileSpace);
+          H5Dclose(dset);
+          H5Fclose(file);
+     };
+     overwriteFirstValue("/Base/Zone0/GridCoordinates/CoordinateX/ data");
+     overwriteFirstValue("/Base/Zone1/FlowSolution/Density/ data");
+
+     tree->getAtPath("CGNSTree/Base/Zone1/FlowSolution/Density")->setData(uniformFromStep<double>(10, 18));
+     tree->getAtPath("CGNSTree/Base/Zone2/GridCoordinates/CoordinateX")->setData(uniformFromStep<float>(0, 4));
+     tree->getAtPath("CGNSTree/Base/Zone2/FlowSolution")->detach();
+     family->setName("Family2");
+     newNode("Pressure", "DataArray_t")->attachTo(tree->getAtPath("CGNSTree/Base/Zone1/FlowSolution"));
+     // edited in place after being hashed: only rehashing the payload sees it
+     auto zone0Density = std::dynamic_pointer_cast<Array>(
+          tree->getAtPath("CGNSTree/Base/Zone0/FlowSolution/Density")->dataPtr());
+     static_cast<double*>(zone0Density->rawData())[0] = 5.0;
+     write_node(tmp_filename, tree, options);
+
+     auto loaded = read(tmp_filename, 'C')->pick().childByName("Base");
+     const auto firstValue = [&loaded](const std::string& path) {
+          return loaded->getAtPath(path, true)->data().itemAsInt64({0});
+     };
+     if (firstValue("Zone0/GridCoordinates/CoordinateX") != -1) {
+          throw std::runtime_error("incremental write: unchanged dataset should not be rewritten");
+     }
+     if (firstValue("Zone1/FlowSolution/Density") != 10 || firstValue("Zone0/FlowSolution/Density") != 5
+          || loaded->getAtPath("Zone2/GridCoordinates/CoordinateX", true)->data().dtype() != "float32") {
+          throw std::runtime_error("incremental write: changed payloads not rewritten");
+     }
+     if (!loaded->getAtPath("Zone1/FlowSolution/Pressure", true)
+          || loaded->getAtPath("Zone2", true)->pick().childByName("FlowSolution")
+          || loaded->pick().childByName("Family")
+          || !loaded->pick().childByName("Family2")) {
+          throw std::runtime_error("incremental write: added, removed or renamed nodes not written");
+     }
+
+     // apart from the dataset changed behind the writer's back, the file holds the tree
+     const TreePatch patch = TreePatch::diff(*base, *loaded);
+     if (patch.size() != 1 || patch.changes()[0].path != "Zone0/GridCoordinates/CoordinateX") {
+          throw std::runtime_error("incremental write: file differs from the written tree");
+     }
+
+     // a renamed root cannot be updated in place: the file is written in full
+     tree->setName("Tree");
+     write_node(tmp_filename, tree, options);
+     loaded = read(tmp_filename, 'C')->pick().childByName("Base");
+     if (firstValue("Zone0/GridCoordinates/CoordinateX") != 0) {
+          throw std::runtime_error("incremental write: renamed root should rewrite the whole file");
+     }
+}
+
 void test_write_link_nodes(std::string filename = "test_links.cgns") {
      auto root = newNode("root", "DataArray_t");
      auto target = newNode("target", "DataArray_t");
-     target->setData(uniformFromStep<int32_t>(0, 4));
-     target->attachTo(root);
-
-     auto linkNode = newNode("target_link");
-     linkNode->setLinkTarget(".", "/root/target");
-     linkNode->attachTo(root);
-
-     write_node(filename, root);
-}
-
+     target->setData(uniformFromStep<int32_t>(0, 4));
+     target->attachTo(root);
+
+     auto linkNode = newNode("target_link");
+     linkNode->setLinkTarget(".", "/root/target");
+     linkNode->attachTo(root);
+
+     write_node(filename, root);
+}
+
 std::shared_ptr<Node> test_read_links(std::string tmp_filename = "test_read_links.cgns") {
      test_write_link_nodes(tmp_filename);
      return read(tmp_filename);
@@ -134,7 +588,72 @@ std::string read_root_hdf5_version(const std::string& filename) {
      return value;
 }
 
+# ifdef ENABLE_MPI
+void test_write_read_parallel( std::string tmp_filename = "test_write_read_parallel.cgns") {
+     int rank = 0;
+     int size = 1;
+     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+     MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+     auto zoneName = [](int zoneRank, size_t k) {
+          std::string paddedRank = std::to_string(zoneRank);
+          paddedRank.insert(0, 4 - paddedRank.size(), '0');
+          return "Zone" + paddedRank + "_" + std::to_string(k);
+     };
+     auto base = newNode("Base", "CGNSBase_t");
+     newNode("Wall", "Family_t")->attachTo(base);
+     for (size_t k = 0; k < 2; ++k) {
+          auto zone = newNode(zoneName(rank, k), "Zone_t");
+          zone->attachTo(base);
+          auto density = newNode("Density", "DataArray_t");
+          Array values = arrayfactory::empty<double>({4, 3}, 'F');
+          for (size_t i = 0; i < 4; ++i) {
+               for (size_t j = 0; j < 3; ++j) {
+                    values.setItemFromInt64({i, j}, static_cast<int64_t>(1000 * rank + 100 * static_cast<int>(k) + 10 * static_cast<int>(i) + static_cast<int>(j)));
+               }
+          }
+          density->setData(values);
+          density->attachTo(zone);
+          auto family = newNode("FamilyName", "FamilyName_t");
+          family->setData("Wall");
+          family->attachTo(zone);
+     }
+
+     for (bool collective : {true, false}) {
+          WriteOptions options;
+          options.collectiveTransfers = collective;
+          write_node_parallel(tmp_filename, base, MPI_COMM_WORLD, options);
+
+          auto mine = read_parallel(tmp_filename, MPI_COMM_WORLD);
+          std::vector<std::string> zones;
+          for (const auto& child : mine->getAtPath("Base")->children()) {
+               if (child->type() == "Zone_t") zones.push_back(child->name());
+          }
+          if (zones != std::vector<std::string>{zoneName(rank, 0), zoneName(rank, 1)} || !mine->getAtPath("Base/Wall")) {
+               throw std::runtime_error("parallel read: rank " + std::to_string(rank) + " did not get its zones");
+          }
+          auto density = mine->getAtPath("Base/" + zoneName(rank, 1) + "/Density");
+          if (density->data().itemAsInt64({3, 2}) != 1000 * rank + 132
+               || mine->getAtPath("Base/" + zoneName(rank, 0) + "/FamilyName")->data().extractString() != "Wall") {
+               throw std::runtime_error("parallel write: wrong values on rank " + std::to_string(rank));
+          }
+
+          if (rank == 0) {
+               auto full = read(tmp_filename);
+               size_t zoneCount = 0;
+               for (const auto& child : full->getAtPath("Base")->children()) {
+                    if (child->type() == "Zone_t") ++zoneCount;
+               }
+               if (zoneCount != 2 * static_cast<size_t>(size)) {
+                    throw std::runtime_error("parallel write: file does not hold the zones of every rank");
+               }
+          }
+          MPI_Barrier(MPI_COMM_WORLD);
+     }
+}
+# endif
+
 }
-
-#endif // TEST_IO_H
-#endif // ENABLE_HDF5_IO
+
+#endif // TEST_IO_H
+#endif // ENABLE_HDF5_IO
@@ -2,6 +2,12 @@
 
 # include <pybind11/pybind11.h>
 
+# include <atomic>
+
+# include <array/array.hpp>
+# include <array/factory/vectors.hpp>
+# include <utils/thread_pool.hpp>
+
 namespace py = pybind11;
 
 #ifdef ENABLE_HDF5_IO
@@ -334,6 +340,68 @@ void test_level() {
     if (e->level() != 4) throw py::value_error("expected level 4");
 }
 
+void test_cachedPlacementFollowsStructure() {
+    auto a = newNode("a");
+    auto b = newNode("b");
+    auto c = newNode("c");
+    b->attachTo(a);
+    c->attachTo(b);
+    const std::string path = c->path();
+    if (path != "a/b/c" || c->level() != 2 || c->root().get() != a.get()) {
+        throw py::value_error("expected path a/b/c at level 2 below a");
+    }
+
+    b->setName("B");
+    if (c->path() != "a/B/c") throw py::value_error("expected path a/B/c after renaming b");
+    if (path != "a/b/c") throw py::value_error("expected a returned path to outlive a rename");
+
+    auto z = newNode("z");
+    b->attachTo(z);
+    if (c->path() != "z/B/c" || c->root().get() != z.get()) {
+        throw py::value_error("expected path z/B/c after moving b below z");
+    }
+
+    b->detach();
+    if (c->path() != "B/c" || c->level() != 1 || c->root().get() != b.get()) {
+        throw py::value_error("expected path B/c after detaching b");
+    }
+
+    // children outlive a destroyed parent
+    auto d = newNode("d");
+    d->attachTo(c);
+    c->detach();
+    c.reset();
+    if (d->path() != "d" || d->level() != 0 || d->root().get() != d.get()) {
+        throw py::value_error("expected d to be a root once its parent is destroyed");
+    }
+
+    // placements are computed by the first thread asking, then read by all of them
+    auto base = newNode("Base");
+    std::vector<std::shared_ptr<Node>> fields;
+    for (size_t i = 0; i < 8; ++i) {
+        auto zone = newNode("Zone" + std::to_string(i));
+        zone->attachTo(base);
+        for (size_t j = 0; j < 64; ++j) {
+            fields.push_back(newNode("Field" + std::to_string(j)));
+            fields.back()->attachTo(zone);
+        }
+    }
+    std::atomic<size_t> wrongPlacements{0};
+    utils::ThreadPool pool(4);
+    pool.parallelFor(4 * fields.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t k = begin; k < end; ++k) {
+            const Node& field = *fields[k % fields.size()];
+            const std::string expected = "Base/Zone" + std::to_string(k % fields.size() / 64) + "/Field" + std::to_string(k % 64);
+            if (field.path() != expected || field.level() != 2 || field.root().get() != base.get()) {
+                wrongPlacements.fetch_add(1);
+            }
+        }
+    });
+    if (wrongPlacements.load() != 0) {
+        throw py::value_error("expected the same placements computed from several threads");
+    }
+}
+
 void test_printTree() {
     auto a = newNode("a");
     auto b = newNode("b");
@@ -593,6 +661,48 @@ void test_swap() {
     if (c->path() != "left/c") throw py::value_error("unexpected path for c after swap");
 }
 
+void test_childByNameWithManyChildren() {
+    auto solution = newNode("FlowSolution", "FlowSolution_t");
+    for (size_t i = 0; i < 1000; ++i) {
+        newNode("Field" + std::to_string(i))->attachTo(solution);
+    }
+    if (solution->childByName("Field500") != solution->children()[500]) {
+        throw py::value_error("lookup among many children returned the wrong child");
+    }
+    if (solution->childByName("Field1000")) throw py::value_error("unexpected child Field1000");
+
+    // conflicts are detected through the index, keeping insertion order
+    auto duplicate = newNode("Field7");
+    duplicate->attachTo(solution, -1, false);
+    if (duplicate->name() != "Field7.0") throw py::value_error("expected renamed duplicate Field7.0");
+    if (solution->children().back() != duplicate) throw py::value_error("new child should be last");
+
+    solution->childByName("Field3")->setName("Renamed");
+    if (solution->childByName("Field3")) throw py::value_error("old name should no longer be found");
+    if (solution->getAtPath("FlowSolution/Renamed") != solution->children()[3]) {
+        throw py::value_error("renamed child should be found at its new path");
+    }
+
+    solution->childByName("Field10")->detach();
+    if (solution->childByName("Field10")) throw py::value_error("detached child should no longer be found");
+    if (solution->children()[10]->name() != "Field11") throw py::value_error("detach should keep children order");
+
+    auto other = newNode("other");
+    auto outsider = newNode("Outsider");
+    outsider->attachTo(other);
+    solution->childByName("Field20")->swap(outsider);
+    if (!solution->childByName("Outsider") || solution->childByName("Field20")) {
+        throw py::value_error("swap should update the name index");
+    }
+    if (solution->children()[19]->name() != "Outsider") throw py::value_error("swap should keep the position");
+
+    // a rename into an existing name keeps the first child in order
+    solution->childByName("Field30")->setName("Field40");
+    if (solution->childByName("Field40") != solution->children()[29]) {
+        throw py::value_error("duplicate names should resolve to the first child in order");
+    }
+}
+
 void test_copy() {
     auto a = newNode("a");
     a->setData(3.14);
@@ -802,6 +912,47 @@ void test_saveThisNodeOnly(const std::string& filename) {
         throw py::value_error("saveThisNodeOnly unexpectedly modified sibling node data");
     }
 }
+
+void test_saveThisNodeOnlyInPlace(const std::string& filename) {
+    auto root = newNode("root");
+    auto mutableNode = newNode("mutable");
+    auto grandChild = newNode("grandChild");
+    mutableNode->setData(1);
+    grandChild->setData(3);
+    grandChild->attachTo(mutableNode);
+    mutableNode->attachTo(root);
+    root->write(filename);
+
+    // nodes only known by the file must survive an in-place update
+    auto otherRoot = newNode("other");
+    otherRoot->setData(5);
+    auto otherLeaf = newNode("leaf");
+    otherLeaf->attachTo(otherRoot);
+    otherLeaf->saveThisNodeOnly(filename);
+
+    grandChild->detach();
+    mutableNode->setData(std::string("now a string"));
+    mutableNode->saveThisNodeOnly(filename);
+
+    auto readRoot = io::read(filename);
+    auto persistedMutable = readRoot->getAtPath("root/mutable");
+    if (!persistedMutable || persistedMutable->data().extractString() != "now a string") {
+        throw py::value_error("saveThisNodeOnly did not replace node data with a different dtype");
+    }
+    if (!readRoot->getAtPath("root/mutable/grandChild")) {
+        throw py::value_error("saveThisNodeOnly removed children persisted in file");
+    }
+    auto persistedOther = readRoot->getAtPath("other");
+    if (!persistedOther || !persistedOther->noData() || !readRoot->getAtPath("other/leaf")) {
+        throw py::value_error("saveThisNodeOnly did not create missing intermediate nodes");
+    }
+
+    mutableNode->setData(-1);
+    mutableNode->reloadNodeData(filename);
+    if (mutableNode->data().extractString() != "now a string" || mutableNode->hasChildren()) {
+        throw py::value_error("reloadNodeData did not read back only the node payload");
+    }
+}
 #endif
 
 void test_merge() {
@@ -832,6 +983,100 @@ void test_merge() {
     if (mergedANames[1] != "Y") throw py::value_error("expected second merged child Y");
 }
 
+void test_fingerprint() {
+    auto root = newNode("root", "CGNSTree_t");
+    auto base = newNode("Base", "CGNSBase_t");
+    auto zone = newNode("Zone", "Zone_t");
+    auto field = newNode("Field", "DataArray_t");
+    auto family = newNode("Family", "Family_t");
+    base->attachTo(root);
+    zone->attachTo(base);
+    field->attachTo(zone);
+    family->attachTo(base);
+
+    // same values in C and Fortran layouts
+    std::vector<double> valuesC = {0, 1, 2, 3, 4, 5};
+    std::vector<double> valuesF = {0, 3, 1, 4, 2, 5};
+    Array arrayC(Array::typeIdFor<double>(), sizeof(double), valuesC.data(), {2, 3}, {3 * sizeof(double), sizeof(double)});
+    Array arrayF(Array::typeIdFor<double>(), sizeof(double), valuesF.data(), {2, 3}, {sizeof(double), 2 * sizeof(double)});
+    if (arrayC.fingerprint() != arrayF.fingerprint()) {
+        throw py::value_error("expected the same values in C and Fortran layouts to hash equal");
+    }
+    field->setData(arrayC);
+    const std::uint64_t initial = root->fingerprint();
+    if (root->copy(true)->fingerprint() != initial) {
+        throw py::value_error("expected a deep copy to hash equal");
+    }
+
+    // a change clears the cached fingerprints on the path to the root only
+    field->setData(arrayF);
+    if (root->cachedFingerprint() || base->cachedFingerprint() || field->cachedFingerprint()) {
+        throw py::value_error("expected setData to clear the fingerprints up to the root");
+    }
+    if (!family->cachedFingerprint()) {
+        throw py::value_error("expected the sibling fingerprint to stay cached");
+    }
+    if (root->fingerprint() != initial) {
+        throw py::value_error("expected the same values in another layout to keep the fingerprint");
+    }
+
+    auto expectChange = [&](const char* what) {
+        const std::uint64_t changed = root->fingerprint();
+        if (changed == initial) {
+            throw py::value_error(std::string("expected ") + what + " to change the fingerprint");
+        }
+    };
+    field->setData(arrayfactory::uniformFromStep<double>(0, 6));
+    expectChange("setData");
+    field->setData(arrayC);
+    family->setName("Family2");
+    expectChange("setName");
+    family->setName("Family");
+    family->setType("UserDefinedData_t");
+    expectChange("setType");
+    family->setType("Family_t");
+    family->setLinkTarget(".", "/root/Base");
+    expectChange("setLinkTarget");
+    family->clearLinkTarget();
+    if (root->fingerprint() != initial) {
+        throw py::value_error("expected the original tree to hash to the original fingerprint");
+    }
+
+    // structure changes, and a moved subtree keeps its own fingerprint
+    const std::uint64_t zoneFingerprint = zone->fingerprint();
+    zone->detach();
+    expectChange("detach");
+    zone->attachTo(family);
+    expectChange("attachTo");
+    if (zone->fingerprint() != zoneFingerprint) {
+        throw py::value_error("expected a moved subtree to keep its fingerprint");
+    }
+    zone->detach();
+    zone->attachTo(base);
+    expectChange("reordering children");
+    family->swap(zone);
+    if (root->fingerprint() != initial) {
+        throw py::value_error("expected the swap to restore the original fingerprint");
+    }
+
+    // payloads edited in place need an explicit invalidation
+    auto payload = std::dynamic_pointer_cast<Array>(field->dataPtr());
+    payload->getPointerOfDataSafely<double>()[0] = 10.0;
+    if (root->fingerprint() != initial) {
+        throw py::value_error("expected in-place edits to be unseen until invalidation");
+    }
+    field->invalidateFingerprint();
+    expectChange("invalidateFingerprint after an in-place edit");
+
+    // or a rehash of the payloads of the tree
+    payload->getPointerOfDataSafely<double>()[0] = 11.0;
+    const std::uint64_t edited = root->fingerprint();
+    root->refreshFingerprint();
+    if (root->fingerprint() == edited || root->fingerprint() == initial) {
+        throw py::value_error("expected refreshFingerprint to see an in-place edit");
+    }
+}
+
 void test_Node_example() {
     // docs:start init_cpp_example
     auto node = newNode("zone", "Zone_t");
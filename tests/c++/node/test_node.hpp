@@ -64,6 +64,8 @@ void test_root();
 
 void test_level();
 
+void test_cachedPlacementFollowsStructure();
+
 void test_printTree();
 void test_printTree_skipDescendantsOfSiblingsOfAncestors();
 
@@ -91,6 +93,7 @@ void test_overrideSiblingByName_addChild();
 void test_overrideSiblingByName_addChildren();
 
 void test_swap();
+void test_childByNameWithManyChildren();
 
 void test_copy();
 
@@ -103,10 +106,13 @@ void test_getParametersMixedListAndDictFallback();
 #ifdef ENABLE_HDF5_IO
 void test_reloadNodeData(const std::string& filename = "test_reload_node_data.cgns");
 void test_saveThisNodeOnly(const std::string& filename = "test_save_this_node_only.cgns");
+void test_saveThisNodeOnlyInPlace(const std::string& filename = "test_save_this_node_only_in_place.cgns");
 #endif
 
 void test_merge();
 
+void test_fingerprint();
+
 void test_Node_example();
 void test_pick_example();
 void test_name_example();
@@ -0,0 +1,21 @@
+# include "test_node_fixtures.hpp"
+
+# include <array/factory/vectors.hpp>
+# include <node/node_factory.hpp>
+
+# include <string>
+
+std::shared_ptr<Node> makeTwoZoneTree() {
+    auto root = newNode("root", "CGNSTree_t");
+    auto base = newNode("Base", "CGNSBase_t");
+    base->attachTo(root);
+    for (const std::string zoneName : {"Zone0", "Zone1"}) {
+        auto zone = newNode(zoneName, "Zone_t");
+        zone->attachTo(base);
+        auto field = newNode("Field", "DataArray_t");
+        field->setData(arrayfactory::uniformFromStep<double>(0, 4));
+        field->attachTo(zone);
+    }
+    newNode("Family", "Family_t")->attachTo(root);
+    return root;
+}
@@ -0,0 +1,21 @@
+# ifndef TEST_NODE_FIXTURES_HPP
+# define TEST_NODE_FIXTURES_HPP
+
+# include <node/node.hpp>
+
+# include <memory>
+
+/**
+ * Small tree shared by the node tests:
+ *
+ *     root
+ *     ├── Base (CGNSBase_t)
+ *     │   ├── Zone0 (Zone_t)
+ *     │   │   └── Field (DataArray_t) = [0, 1, 2, 3]
+ *     │   └── Zone1 (Zone_t)
+ *     │       └── Field (DataArray_t) = [0, 1, 2, 3]
+ *     └── Family (Family_t)
+ */
+std::shared_ptr<Node> makeTwoZoneTree();
+
+# endif
@@ -34,6 +34,7 @@ void bindTestsOfNode(py::module_ &m) {
     sm.def("test_getPath", &test_getPath);
     sm.def("test_root", &test_root);
     sm.def("test_level", &test_level);
+    sm.def("test_cachedPlacementFollowsStructure", &test_cachedPlacementFollowsStructure);
     sm.def("test_printTree", &test_printTree);
     sm.def("test_printTree_skipDescendantsOfSiblingsOfAncestors", &test_printTree_skipDescendantsOfSiblingsOfAncestors);
     sm.def("test_children", &test_children);
@@ -48,6 +49,7 @@ void bindTestsOfNode(py::module_ &m) {
     sm.def("test_overrideSiblingByName_addChild", &test_overrideSiblingByName_addChild);
     sm.def("test_overrideSiblingByName_addChildren", &test_overrideSiblingByName_addChildren);
     sm.def("test_swap", &test_swap);
+    sm.def("test_childByNameWithManyChildren", &test_childByNameWithManyChildren);
     sm.def("test_copy", &test_copy);
     sm.def("test_getAtPath", &test_getAtPath);
     sm.def("test_getLinks", &test_getLinks);
@@ -56,9 +58,11 @@ void bindTestsOfNode(py::module_ &m) {
 #ifdef ENABLE_HDF5_IO
     sm.def("test_reloadNodeData", &test_reloadNodeData);
     sm.def("test_saveThisNodeOnly", &test_saveThisNodeOnly);
+    sm.def("test_saveThisNodeOnlyInPlace", &test_saveThisNodeOnlyInPlace);
     sm.def("test_write_example", &test_write_example);
 #endif
     sm.def("test_merge", &test_merge);
+    sm.def("test_fingerprint", &test_fingerprint);
 }
 
 # endif
@@ -0,0 +1,123 @@
+# include "test_path_query.hpp"
+
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+using namespace std::string_literals;
+
+namespace {
+
+// CGNSTree
+// └── Base (CGNSBase_t)
+//     ├── blk1 (Zone_t)
+//     │   ├── FlowSolution (FlowSolution_t)
+//     │   │   ├── Density   float64
+//     │   │   └── CellIndex int32
+//     │   └── ZoneBC (ZoneBC_t)
+//     │       └── wall (BC_t) "BCWall"
+//     ├── blk2 (Zone_t), same as blk1
+//     └── farfield (Zone_t), same as blk1
+std::shared_ptr<Node> makeTree() {
+    auto tree = newNode("CGNSTree", "CGNSTree_t");
+    auto base = newNode("Base", "CGNSBase_t");
+    base->attachTo(tree);
+    for (const std::string zoneName : {"blk1", "blk2", "farfield"}) {
+        auto zone = newNode(zoneName, "Zone_t");
+        zone->attachTo(base);
+        auto solution = newNode("FlowSolution", "FlowSolution_t");
+        solution->attachTo(zone);
+        auto density = newNode("Density", "DataArray_t");
+        density->setData(1.25);
+        density->attachTo(solution);
+        auto cells = newNode("CellIndex", "DataArray_t");
+        cells->setData(int32_t{7});
+        cells->attachTo(solution);
+        auto zoneBC = newNode("ZoneBC", "ZoneBC_t");
+        zoneBC->attachTo(zone);
+        auto wall = newNode("wall", "BC_t");
+        wall->setData("BCWall");
+        wall->attachTo(zoneBC);
+    }
+    return tree;
+}
+
+std::string selectedPaths(Node& start, const std::string& expression) {
+    std::string paths;
+    for (const auto& node : start.select(expression)) {
+        paths += node->path() + " ";
+    }
+    return paths;
+}
+
+void expectSelected(Node& start, const std::string& expression, const std::string& expected) {
+    const std::string got = selectedPaths(start, expression);
+    if (got != expected) {
+        throw py::value_error("select(\"" + expression + "\"): expected \"" + expected + "\", got \"" + got + "\"");
+    }
+}
+
+size_t selectedCount(Node& start, const std::string& expression) {
+    return start.select(expression).size();
+}
+
+} // namespace
+
+void test_selectSteps() {
+    auto tree = makeTree();
+    expectSelected(*tree, "CGNSBase_t/Zone_t[name~'blk*']/FlowSolution_t/*[dtype=float64]",
+                   "CGNSTree/Base/blk1/FlowSolution/Density CGNSTree/Base/blk2/FlowSolution/Density ");
+    expectSelected(*tree, "Base/farfield/ZoneBC/wall", "CGNSTree/Base/farfield/ZoneBC/wall ");
+    expectSelected(*tree, "/Base/'farfield'/ZoneBC_t/*", "CGNSTree/Base/farfield/ZoneBC/wall ");
+    expectSelected(*tree, "*/blk?", "CGNSTree/Base/blk1 CGNSTree/Base/blk2 ");
+    expectSelected(*tree, "Zone_t", "");
+
+    // a compiled query can be reused on several trees
+    const PathQuery walls("//BC_t[data='BCWall']");
+    if (walls.select(*tree).size() != 3 || walls.select(*makeTree()).size() != 3) {
+        throw py::value_error("expected the compiled query to select the 3 walls of each tree");
+    }
+}
+
+void test_selectDescendantAxes() {
+    auto tree = makeTree();
+    if (selectedCount(*tree, "//DataArray_t") != 6) throw py::value_error("expected every DataArray_t");
+    if (selectedCount(*tree, "//{3}DataArray_t") != 0) throw py::value_error("expected no DataArray_t within 3 levels");
+    if (selectedCount(*tree, "//{4}DataArray_t") != 6) throw py::value_error("expected every DataArray_t within 4 levels");
+    if (selectedCount(*tree, "//{2,2}*") != 3) throw py::value_error("expected the 3 zones at level 2");
+    if (selectedCount(*tree, "CGNSBase_t//*") != 18) throw py::value_error("expected every node below the base");
+    if (selectedCount(*tree, "//Zone_t//DataArray_t") != 6) throw py::value_error("expected DataArray_t below zones");
+    if (selectedCount(*tree, "//*//wall") != 3) {
+        throw py::value_error("expected each node to be selected once across overlapping descendant axes");
+    }
+
+    auto base = tree->pick().childByName("Base");
+    expectSelected(*base, "//{1}*[type~'Zone*']",
+                   "CGNSTree/Base/blk1 CGNSTree/Base/blk2 CGNSTree/Base/farfield ");
+}
+
+void test_selectPredicates() {
+    auto tree = makeTree();
+    if (selectedCount(*tree, "//DataArray_t[data=7]") != 3) throw py::value_error("expected int32 scalars equal to 7");
+    if (selectedCount(*tree, "//DataArray_t[data=1.25]") != 3) throw py::value_error("expected float64 scalars equal to 1.25");
+    if (selectedCount(*tree, "//*[data=7.5]") != 0) throw py::value_error("expected no scalar equal to 7.5");
+    if (selectedCount(*tree, "//*[data~'BC*']") != 3) throw py::value_error("expected string data glob to match");
+    if (selectedCount(*tree, "//*[data='7']") != 0) throw py::value_error("expected a quoted value to compare strings only");
+    if (selectedCount(*tree, "//DataArray_t[dtype!=float64]") != 3) throw py::value_error("expected negated dtype");
+    if (selectedCount(*tree, "//Zone_t[name!~'blk*']") != 1) throw py::value_error("expected negated glob");
+    if (selectedCount(*tree, "//*[ type = 'Zone_t' ][name=blk2]") != 1) throw py::value_error("expected chained predicates");
+}
+
+void test_selectMalformedExpressions() {
+    for (const std::string expression : {""s, "Zone_t/"s, "Zone_t[size=3]"s, "Zone_t[name=blk1"s,
+                                         "Zone_t[name>blk1]"s, "//{0}Zone_t"s, "//{3,2}Zone_t"s,
+                                         "Zone_t['blk1]"s, "Zone_t[name=]"s}) {
+        bool failed = false;
+        try {
+            PathQuery query(expression);
+        } catch (const std::invalid_argument&) {
+            failed = true;
+        }
+        if (!failed) throw py::value_error("expected \"" + expression + "\" to be rejected");
+    }
+}
@@ -0,0 +1,20 @@
+# ifndef TEST_PATH_QUERY_HPP
+# define TEST_PATH_QUERY_HPP
+
+# include <node/node.hpp>
+# include <node/node_factory.hpp>
+# include <node/path_query.hpp>
+
+# include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void test_selectSteps();
+
+void test_selectDescendantAxes();
+
+void test_selectPredicates();
+
+void test_selectMalformedExpressions();
+
+# endif
@@ -0,0 +1,17 @@
+# ifndef TEST_PATH_QUERY_PYBIND_HPP
+# define TEST_PATH_QUERY_PYBIND_HPP
+
+# include <pybind11/pybind11.h>
+
+# include "test_path_query.hpp"
+
+void bindTestsOfPathQuery(py::module_ &m) {
+    py::module_ sm = m.def_submodule("path_query");
+
+    sm.def("test_selectSteps", &test_selectSteps);
+    sm.def("test_selectDescendantAxes", &test_selectDescendantAxes);
+    sm.def("test_selectPredicates", &test_selectPredicates);
+    sm.def("test_selectMalformedExpressions", &test_selectMalformedExpressions);
+}
+
+# endif
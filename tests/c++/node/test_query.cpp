@@ -0,0 +1,185 @@
+# include "test_query.hpp"
+
+using Match = NodeQuery::Match;
+
+void test_queryMatchesEveryCriterion() {
+    auto field = newNode("Density", "DataArray_t");
+    field->setData("kg/m3");
+
+    if (!NodeQuery().matches(*field)) {
+        throw py::value_error("an empty query must match any node");
+    }
+    if (!NodeQuery().name("Dens*", Match::Glob).type("DataArray_t").data("kg", Match::Regex).matches(*field)) {
+        throw py::value_error("expected glob name, exact type and regex data to match");
+    }
+    if (NodeQuery().name("Dens*", Match::Glob).type("Zone_t").matches(*field)) {
+        throw py::value_error("expected a query to fail when one criterion fails");
+    }
+    if (NodeQuery().name("Dens").matches(*field)) {
+        throw py::value_error("exact name must match the whole name");
+    }
+    if (!NodeQuery().name("ens", Match::Regex).matches(*field)) {
+        throw py::value_error("regex name must match anywhere in the name");
+    }
+    if (NodeQuery().name("ens*", Match::Glob).matches(*field)) {
+        throw py::value_error("glob name must match the whole name");
+    }
+
+    auto scalar = newNode("Iterations", "DataArray_t");
+    scalar->setData(int32_t{12});
+    if (!NodeQuery().scalar(int32_t{12}).matches(*scalar)) {
+        throw py::value_error("expected scalar data to match");
+    }
+    if (NodeQuery().scalar(int32_t{12}).matches(*field) || NodeQuery().data("12").matches(*scalar)) {
+        throw py::value_error("string and scalar data criteria must not match the other kind of data");
+    }
+}
+
+void test_queryReusedAcrossTrees() {
+    NodeQuery query;
+    query.name("Zone*", Match::Glob).type("Zone_t");
+
+    auto first = newNode("Base1", "CGNSBase_t");
+    auto zoneA = newNode("ZoneA", "Zone_t");
+    zoneA->attachTo(first);
+    auto notAZone = newNode("ZoneBC", "ZoneBC_t");
+    notAZone->attachTo(zoneA);
+
+    auto second = newNode("Base2", "CGNSBase_t");
+    auto family = newNode("Family", "Family_t");
+    family->attachTo(second);
+    auto zoneB = newNode("ZoneB", "Zone_t");
+    zoneB->attachTo(second);
+
+    auto inFirst = query.all(*first);
+    if (inFirst.size() != 1 || inFirst[0].get() != zoneA.get()) {
+        throw py::value_error("expected ZoneA only in the first tree");
+    }
+    if (query.first(*second).get() != zoneB.get()) {
+        throw py::value_error("expected the same query to find ZoneB in the second tree");
+    }
+}
+
+void test_queryPreOrderAndDepth() {
+    // root
+    // ├── a
+    // │   ├── a1
+    // │   │   └── a11
+    // │   └── a2
+    // └── b
+    //     └── b1
+    auto root = newNode("root");
+    auto a = newNode("a");
+    a->attachTo(root);
+    auto a1 = newNode("a1");
+    a1->attachTo(a);
+    auto a11 = newNode("a11");
+    a11->attachTo(a1);
+    auto a2 = newNode("a2");
+    a2->attachTo(a);
+    auto b = newNode("b");
+    b->attachTo(root);
+    auto b1 = newNode("b1");
+    b1->attachTo(b);
+
+    const NodeQuery any;
+    const std::vector<Node*> preOrder = {a.get(), a1.get(), a11.get(), a2.get(), b.get(), b1.get()};
+    auto all = any.all(*root);
+    if (all.size() != preOrder.size()) {
+        throw py::value_error("expected every descendant, without the start node");
+    }
+    for (size_t i = 0; i < preOrder.size(); ++i) {
+        if (all[i].get() != preOrder[i]) {
+            throw py::value_error("expected descendants in depth-first pre-order");
+        }
+    }
+
+    if (any.all(*root, 0).size() != 0) throw py::value_error("depth=0 must visit nothing");
+    if (any.all(*root, 1).size() != 2) throw py::value_error("depth=1 must visit children only");
+    if (any.all(*root, 2).size() != 5) throw py::value_error("depth=2 must visit grandchildren");
+
+    const NodeQuery second = NodeQuery().name("?1", Match::Glob);
+    if (second.first(*root).get() != a1.get()) {
+        throw py::value_error("expected first to return the first match in pre-order");
+    }
+    if (second.first(*root, 1) != nullptr) {
+        throw py::value_error("expected no match at depth=1");
+    }
+}
+
+void test_queryDeepTree() {
+    const size_t levels = 5000;
+    auto root = newNode("root");
+    auto parent = root;
+    for (size_t level = 0; level < levels; ++level) {
+        auto child = newNode("level" + std::to_string(level), "UserDefinedData_t");
+        child->attachTo(parent);
+        parent = child;
+    }
+
+    const NodeQuery deepest = NodeQuery().name("level" + std::to_string(levels - 1)).type("UserDefined*", Match::Glob);
+    if (deepest.first(*root, levels).get() != parent.get()) {
+        throw py::value_error("expected to reach the deepest node");
+    }
+    if (deepest.first(*root, levels - 1) != nullptr) {
+        throw py::value_error("expected the deepest node to be out of reach");
+    }
+    if (NodeQuery().name("level[0-9]*0$", Match::Regex).all(*root, levels).size() != levels / 10) {
+        throw py::value_error("expected one regex match every 10 levels");
+    }
+
+    // release the chain from the bottom to keep destruction shallow
+    while (parent != root) {
+        auto above = parent->parent().lock();
+        parent->detach();
+        parent = above;
+    }
+}
+
+void test_queryAllParallel() {
+    // uneven zones so that workers finish their tasks at different times
+    auto root = newNode("root", "CGNSTree_t");
+    for (size_t b = 0; b < 3; ++b) {
+        auto base = newNode("Base" + std::to_string(b), "CGNSBase_t");
+        base->attachTo(root);
+        for (size_t z = 0; z < 40; ++z) {
+            auto zone = newNode("Zone" + std::to_string(z), "Zone_t");
+            zone->attachTo(base);
+            for (size_t f = 0; f < 5 * (z % 7); ++f) {
+                auto field = newNode("Field" + std::to_string(f), "DataArray_t");
+                field->setData("field " + std::to_string(f));
+                field->attachTo(zone);
+            }
+        }
+    }
+
+    const std::vector<NodeQuery> queries = {
+        NodeQuery().type("Zone_t"),
+        NodeQuery().data("field 1*", Match::Glob),
+        NodeQuery().name("Field2*", Match::Glob).type("DataArray_t"),
+        NodeQuery().name("missing"),
+    };
+    for (const NodeQuery& query : queries) {
+        for (size_t depth : {size_t{1}, size_t{2}, size_t{100}}) {
+            const auto serial = query.all(*root, depth);
+            for (size_t threads : {size_t{1}, size_t{2}, size_t{7}}) {
+                if (query.allParallel(*root, depth, threads, 16) != serial) {
+                    throw py::value_error("expected parallel results in serial order with "
+                                          + std::to_string(threads) + " threads at depth "
+                                          + std::to_string(depth));
+                }
+            }
+        }
+    }
+
+    // the default grain size keeps this small tree serial, with the same result
+    const NodeQuery fields = NodeQuery().type("DataArray_t");
+    if (fields.allParallel(*root) != fields.all(*root)) {
+        throw py::value_error("expected the serial fallback to return the same result");
+    }
+
+    auto base = root->pick().childByName("Base1");
+    if (fields.allParallel(*base, 100, 4, 8) != fields.all(*base)) {
+        throw py::value_error("expected the same result from a subtree start");
+    }
+}
@@ -0,0 +1,22 @@
+# ifndef TEST_QUERY_HPP
+# define TEST_QUERY_HPP
+
+# include <node/node.hpp>
+# include <node/node_factory.hpp>
+# include <node/query.hpp>
+
+# include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void test_queryMatchesEveryCriterion();
+
+void test_queryReusedAcrossTrees();
+
+void test_queryPreOrderAndDepth();
+
+void test_queryDeepTree();
+
+void test_queryAllParallel();
+
+# endif
@@ -0,0 +1,18 @@
+# ifndef TEST_QUERY_PYBIND_HPP
+# define TEST_QUERY_PYBIND_HPP
+
+# include <pybind11/pybind11.h>
+
+# include "test_query.hpp"
+
+void bindTestsOfNodeQuery(py::module_ &m) {
+    py::module_ sm = m.def_submodule("query");
+
+    sm.def("test_queryMatchesEveryCriterion", &test_queryMatchesEveryCriterion);
+    sm.def("test_queryReusedAcrossTrees", &test_queryReusedAcrossTrees);
+    sm.def("test_queryPreOrderAndDepth", &test_queryPreOrderAndDepth);
+    sm.def("test_queryDeepTree", &test_queryDeepTree);
+    sm.def("test_queryAllParallel", &test_queryAllParallel);
+}
+
+# endif
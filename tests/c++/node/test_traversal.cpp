@@ -0,0 +1,139 @@
+# include "test_traversal.hpp"
+
+# include <algorithm>
+# include <string>
+# include <vector>
+
+using traversal::Action;
+using traversal::Order;
+
+namespace {
+
+// root
+// ├── a
+// │   ├── a1
+// │   └── a2
+// │       └── a21
+// └── b
+//     └── b1
+std::shared_ptr<Node> makeSmallTree() {
+    auto root = newNode("root");
+    auto a = newNode("a");
+    a->attachTo(root);
+    newNode("a1")->attachTo(a);
+    auto a2 = newNode("a2");
+    a2->attachTo(a);
+    newNode("a21")->attachTo(a2);
+    auto b = newNode("b");
+    b->attachTo(root);
+    newNode("b1")->attachTo(b);
+    return root;
+}
+
+std::string visitedNames(Node& start, Order order, size_t maxLevel = traversal::kAllLevels) {
+    std::string names;
+    traversal::walk(start, [&names](Node& node, size_t level) {
+        names += node.name() + ":" + std::to_string(level) + " ";
+    }, order, maxLevel);
+    return names;
+}
+
+void expectNames(const std::string& got, const std::string& expected, const std::string& context) {
+    if (got != expected) {
+        throw py::value_error(context + ": expected \"" + expected + "\", got \"" + got + "\"");
+    }
+}
+
+} // namespace
+
+void test_walkOrders() {
+    auto root = makeSmallTree();
+    expectNames(visitedNames(*root, Order::PreOrder),
+                "root:0 a:1 a1:2 a2:2 a21:3 b:1 b1:2 ", "pre-order");
+    expectNames(visitedNames(*root, Order::PostOrder),
+                "a1:2 a21:3 a2:2 a:1 b1:2 b:1 root:0 ", "post-order");
+    expectNames(visitedNames(*root, Order::BreadthFirst),
+                "root:0 a:1 b:1 a1:2 a2:2 b1:2 a21:3 ", "breadth-first");
+
+    // one Walker reused for several walks
+    traversal::Walker walker;
+    size_t count = 0;
+    for (Order order : {Order::PreOrder, Order::PostOrder, Order::BreadthFirst}) {
+        walker.walk(*root, [&count](Node&) { ++count; }, order);
+    }
+    if (count != 3 * 7) throw py::value_error("expected every node to be visited by each walk");
+}
+
+void test_walkSkipChildrenAndStop() {
+    auto root = makeSmallTree();
+
+    std::string names;
+    traversal::walk(*root, [&names](Node& node) {
+        names += node.name() + " ";
+        return node.name() == "a" ? Action::SkipChildren : Action::Continue;
+    });
+    expectNames(names, "root a b b1 ", "pre-order pruning");
+
+    names.clear();
+    traversal::walk(*root, [&names](Node& node) {
+        names += node.name() + " ";
+        return node.name() == "a" ? Action::SkipChildren : Action::Continue;
+    }, Order::BreadthFirst);
+    expectNames(names, "root a b b1 ", "breadth-first pruning");
+
+    for (Order order : {Order::PreOrder, Order::PostOrder, Order::BreadthFirst}) {
+        names.clear();
+        const bool stopped = traversal::walk(*root, [&names](Node& node) {
+            names += node.name() + " ";
+            return node.name() == "a2" ? Action::Stop : Action::Continue;
+        }, order);
+        if (!stopped) throw py::value_error("expected walk to report that it was stopped");
+        if (names.substr(names.size() - 3) != "a2 ") throw py::value_error("expected no visit after Stop");
+    }
+
+    if (traversal::walk(*root, [](Node&) { return Action::Continue; })) {
+        throw py::value_error("expected a complete walk not to report a stop");
+    }
+}
+
+void test_walkMaxLevel() {
+    auto root = makeSmallTree();
+    expectNames(visitedNames(*root, Order::PreOrder, 0), "root:0 ", "pre-order maxLevel=0");
+    expectNames(visitedNames(*root, Order::PreOrder, 1), "root:0 a:1 b:1 ", "pre-order maxLevel=1");
+    expectNames(visitedNames(*root, Order::PostOrder, 1), "a:1 b:1 root:0 ", "post-order maxLevel=1");
+    expectNames(visitedNames(*root, Order::BreadthFirst, 2),
+                "root:0 a:1 b:1 a1:2 a2:2 b1:2 ", "breadth-first maxLevel=2");
+}
+
+void test_walkDeepTree() {
+    const size_t levels = 20000;
+    auto root = newNode("root");
+    auto parent = root;
+    for (size_t level = 0; level < levels; ++level) {
+        auto child = newNode("level" + std::to_string(level));
+        child->attachTo(parent);
+        parent = child;
+    }
+
+    for (Order order : {Order::PreOrder, Order::PostOrder, Order::BreadthFirst}) {
+        size_t count = 0;
+        size_t deepest = 0;
+        traversal::walk(*root, [&](Node&, size_t level) {
+            ++count;
+            deepest = std::max(deepest, level);
+        }, order);
+        if (count != levels + 1 || deepest != levels) {
+            throw py::value_error("expected to visit every level of the deep tree");
+        }
+    }
+    if (root->descendants().size() != levels + 1) {
+        throw py::value_error("expected descendants to reach every level of the deep tree");
+    }
+
+    // release the chain from the bottom to keep destruction shallow
+    while (parent != root) {
+        auto above = parent->parent().lock();
+        parent->detach();
+        parent = above;
+    }
+}
@@ -0,0 +1,20 @@
+# ifndef TEST_TRAVERSAL_HPP
+# define TEST_TRAVERSAL_HPP
+
+# include <node/node.hpp>
+# include <node/node_factory.hpp>
+# include <node/traversal.hpp>
+
+# include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void test_walkOrders();
+
+void test_walkSkipChildrenAndStop();
+
+void test_walkMaxLevel();
+
+void test_walkDeepTree();
+
+# endif
@@ -0,0 +1,17 @@
+# ifndef TEST_TRAVERSAL_PYBIND_HPP
+# define TEST_TRAVERSAL_PYBIND_HPP
+
+# include <pybind11/pybind11.h>
+
+# include "test_traversal.hpp"
+
+void bindTestsOfTraversal(py::module_ &m) {
+    py::module_ sm = m.def_submodule("traversal");
+
+    sm.def("test_walkOrders", &test_walkOrders);
+    sm.def("test_walkSkipChildrenAndStop", &test_walkSkipChildrenAndStop);
+    sm.def("test_walkMaxLevel", &test_walkMaxLevel);
+    sm.def("test_walkDeepTree", &test_walkDeepTree);
+}
+
+# endif
@@ -0,0 +1,144 @@
+# include "test_tree_diff.hpp"
+# include "test_node_fixtures.hpp"
+
+# include <array/factory/vectors.hpp>
+
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+namespace {
+
+std::string describe(const TreePatch& patch) {
+    std::string text;
+    for (const auto& change : patch.changes()) {
+        text += std::string(TreePatch::kindName(change.kind)) + " " + change.path;
+        if (!change.value.empty()) {
+            text += " " + change.value;
+        }
+        text += "; ";
+    }
+    return text;
+}
+
+void expectPatch(const TreePatch& patch, const std::string& expected, const std::string& context) {
+    const std::string got = describe(patch);
+    if (got != expected) {
+        throw py::value_error(context + ": expected \"" + expected + "\", got \"" + got + "\"");
+    }
+}
+
+} // namespace
+
+void test_treeDiffRecordsChanges() {
+    auto before = makeTwoZoneTree();
+    auto after = before->copy(true);
+    after->childByName("Family")->detach();
+    after->getAtPath("root/Base/Zone1")->setName("ZoneB");
+    after->getAtPath("root/Base/Zone0/Field")->setData(arrayfactory::uniformFromStep<double>(1, 5));
+    newNode("FlowSolution", "FlowSolution_t")->attachTo(after->getAtPath("root/Base/Zone0"));
+    after->getAtPath("root/Base")->setType("UserDefinedData_t");
+
+    TreePatch patch = TreePatch::diff(*before, *after);
+    expectPatch(patch,
+        "Removed Family; Retyped Base UserDefinedData_t; Renamed Base/Zone1 ZoneB; "
+        "Added Base/Zone0; DataChanged Base/Zone0/Field; ",
+        "diff");
+    auto added = after->getAtPath("root/Base/Zone0/FlowSolution");
+    if (patch.changes()[3].subtree != added) {
+        throw py::value_error("expected the added subtree shared with the compared tree");
+    }
+
+    patch.apply(*before);
+    if (before->getAtPath("root/Base/Zone0/FlowSolution") == added || added->parent().lock() == nullptr) {
+        throw py::value_error("expected a copy of the added subtree attached by apply");
+    }
+    if (!TreePatch::diff(*before, *after).empty()) {
+        throw py::value_error("expected no difference left once the patch is applied, got \""
+            + describe(TreePatch::diff(*before, *after)) + "\"");
+    }
+    if (before->getAtPath("root/Base/Zone0/FlowSolution")->position() != 1) {
+        throw py::value_error("expected the added node at its position");
+    }
+    if (!TreePatch::diff(*after, *after).empty()) {
+        throw py::value_error("expected no difference between a tree and itself");
+    }
+}
+
+void test_treeDiffComparesPayloads() {
+    auto before = makeTwoZoneTree();
+
+    // shared payloads are not compared, copied ones are compared element-wise
+    if (!TreePatch::diff(*before, *before->copy(false)).empty()
+        || !TreePatch::diff(*before, *before->copy(true)).empty()) {
+        throw py::value_error("expected copies to be equal to their source");
+    }
+
+    auto after = before->copy(true);
+    auto field = after->getAtPath("root/Base/Zone1/Field");
+    field->setData(arrayfactory::uniformFromStep<double>(1e-9, 4 + 1e-9));
+    expectPatch(TreePatch::diff(*before, *after), "DataChanged Base/Zone1/Field; ", "exact comparison");
+    expectPatch(TreePatch::diff(*before, *after, 0.0, 1e-6), "", "absolute tolerance");
+    expectPatch(TreePatch::diff(*before, *after, 1e-12, 0.0), "DataChanged Base/Zone1/Field; ", "relative tolerance");
+
+    // edits in place, unseen by cached fingerprints, are compared too
+    field->setData(arrayfactory::uniformFromStep<double>(0, 4));
+    if (before->fingerprint() != after->fingerprint()) {
+        throw py::value_error("expected equal fingerprints of equal trees");
+    }
+    static_cast<double*>(std::dynamic_pointer_cast<Array>(field->dataPtr())->rawData())[2] = 7.0;
+    expectPatch(TreePatch::diff(*before, *after), "DataChanged Base/Zone1/Field; ", "edit in place");
+
+    field->setData(arrayfactory::uniformFromStep<float>(0, 4));
+    expectPatch(TreePatch::diff(*before, *after, 1.0, 1.0), "DataChanged Base/Zone1/Field; ", "dtype change");
+    field->setData("text");
+    expectPatch(TreePatch::diff(*before, *after), "DataChanged Base/Zone1/Field; ", "string payload");
+
+    // same values in C and Fortran layouts
+    std::vector<double> valuesC = {0, 1, 2, 3, 4, 5};
+    std::vector<double> valuesF = {0, 3, 1, 4, 2, 5};
+    Array arrayC(Array::typeIdFor<double>(), sizeof(double), valuesC.data(), {2, 3}, {3 * sizeof(double), sizeof(double)});
+    Array arrayF(Array::typeIdFor<double>(), sizeof(double), valuesF.data(), {2, 3}, {sizeof(double), 2 * sizeof(double)});
+    if (!arrayC.isCloseTo(arrayF) || !arrayF.isCloseTo(arrayC)) {
+        throw py::value_error("expected arrays with the same values in different layouts to be close");
+    }
+    valuesF[5] = 6;
+    if (arrayC.isCloseTo(arrayF) || !arrayC.isCloseTo(arrayF, 0.0, 1.0)) {
+        throw py::value_error("expected the last element to differ by 1");
+    }
+    if (!Array().isCloseTo(Array()) || Array().isCloseTo(arrayC) || !Array("ab").isCloseTo(Array("ab"))) {
+        throw py::value_error("expected None and strings to compare by value");
+    }
+}
+
+void test_treePatchRoundTripsThroughNode() {
+    auto before = makeTwoZoneTree();
+    auto after = before->copy(true);
+    after->setName("renamedRoot");
+    after->getAtPath("renamedRoot/Base/Zone0")->detach();
+    auto zone = newNode("Zone2", "Zone_t");
+    newNode("Field", "DataArray_t")->attachTo(zone);
+    zone->attachTo(after->childByName("Base"), 0);
+    after->childByName("Family")->setData(3);
+
+    const TreePatch patch = TreePatch::diff(*before, *after);
+    const TreePatch decoded = TreePatch::fromNode(*patch.toNode());
+    if (describe(decoded) != describe(patch)) {
+        throw py::value_error("expected \"" + describe(patch) + "\" once decoded, got \"" + describe(decoded) + "\"");
+    }
+
+    decoded.apply(*before);
+    if (!TreePatch::diff(*before, *after).empty() || before->childByName("Base")->children()[0]->name() != "Zone2") {
+        throw py::value_error("expected the decoded patch to rebuild the tree");
+    }
+
+    bool threw = false;
+    try {
+        patch.apply(*makeTwoZoneTree()->childByName("Family"));
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    if (!threw) {
+        throw py::value_error("expected apply to reject a tree without the patched paths");
+    }
+}
@@ -0,0 +1,18 @@
+# ifndef TEST_TREE_DIFF_HPP
+# define TEST_TREE_DIFF_HPP
+
+# include <node/node.hpp>
+# include <node/node_factory.hpp>
+# include <node/tree_diff.hpp>
+
+# include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void test_treeDiffRecordsChanges();
+
+void test_treeDiffComparesPayloads();
+
+void test_treePatchRoundTripsThroughNode();
+
+# endif
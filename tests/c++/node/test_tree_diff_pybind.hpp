@@ -0,0 +1,16 @@
+# ifndef TEST_TREE_DIFF_PYBIND_HPP
+# define TEST_TREE_DIFF_PYBIND_HPP
+
+# include <pybind11/pybind11.h>
+
+# include "test_tree_diff.hpp"
+
+void bindTestsOfTreeDiff(py::module_ &m) {
+    py::module_ sm = m.def_submodule("tree_diff");
+
+    sm.def("test_treeDiffRecordsChanges", &test_treeDiffRecordsChanges);
+    sm.def("test_treeDiffComparesPayloads", &test_treeDiffComparesPayloads);
+    sm.def("test_treePatchRoundTripsThroughNode", &test_treePatchRoundTripsThroughNode);
+}
+
+# endif
@@ -0,0 +1,202 @@
+# include "test_tree_index.hpp"
+# include "test_node_fixtures.hpp"
+
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+namespace {
+
+std::string paths(const std::vector<std::shared_ptr<Node>>& nodes) {
+    std::string joined;
+    for (const auto& node : nodes) {
+        joined += node->path() + " ";
+    }
+    return joined;
+}
+
+void expectPaths(const std::vector<std::shared_ptr<Node>>& nodes,
+                 const std::string& expected,
+                 const std::string& context) {
+    const std::string got = paths(nodes);
+    if (got != expected) {
+        throw py::value_error(context + ": expected \"" + expected + "\", got \"" + got + "\"");
+    }
+}
+
+} // namespace
+
+void test_treeIndexSearches() {
+    auto root = makeTwoZoneTree();
+    auto base = root->childByName("Base");
+
+    const auto zones = root->pick().allByType("Zone_t");
+    const auto fields = root->pick().allByName("Field");
+    const auto shallowFields = root->pick().allByName("Field", 2);
+    const auto fieldsOfBase = base->pick().allByName("Field");
+    const auto combined = root->pick().allByAnd("Field", "DataArray_t", "");
+
+    TreeIndex& index = root->enableTreeIndex();
+    if (index.size() != 7 || root->treeIndex() != &index || base->treeIndex() != &index) {
+        throw py::value_error("expected the index to cover the 7 nodes of the tree");
+    }
+
+    // same results, in the same order, with and without the index
+    expectPaths(root->pick().allByType("Zone_t"), paths(zones), "allByType");
+    expectPaths(root->pick().allByName("Field"), paths(fields), "allByName");
+    expectPaths(root->pick().allByName("Field", 2), paths(shallowFields), "allByName depth 2");
+    expectPaths(base->pick().allByName("Field"), paths(fieldsOfBase), "allByName from Base");
+    expectPaths(root->pick().allByAnd("Field", "DataArray_t", ""), paths(combined), "allByAnd");
+
+    if (root->pick().byName("Field")->path() != "root/Base/Zone0/Field") {
+        throw py::value_error("expected byName to return the first Field in pre-order");
+    }
+    if (root->pick().byName("missing") || !root->pick().allByType("missing_t").empty()) {
+        throw py::value_error("expected no match for missing name or type");
+    }
+    if (base->pick().byType("CGNSBase_t")) {
+        throw py::value_error("expected the start node to be excluded from its searches");
+    }
+}
+
+void test_treeIndexFollowsEdits() {
+    auto root = makeTwoZoneTree();
+    root->enableTreeIndex();
+    auto base = root->childByName("Base");
+
+    auto zone2 = newNode("Zone2", "Zone_t");
+    newNode("Field", "DataArray_t")->attachTo(zone2);
+    zone2->attachTo(base, 0);
+    expectPaths(root->pick().allByName("Field"),
+                "root/Base/Zone2/Field root/Base/Zone0/Field root/Base/Zone1/Field ",
+                "after attachTo");
+
+    base->childByName("Zone0")->detach();
+    expectPaths(root->pick().allByType("Zone_t"), "root/Base/Zone2 root/Base/Zone1 ", "after detach");
+
+    zone2->setName("Renamed");
+    expectPaths(root->pick().allByName("Field"),
+                "root/Base/Renamed/Field root/Base/Zone1/Field ", "after setName");
+    if (root->getAtPath("root/Base/Renamed/Field") != zone2->childByName("Field")) {
+        throw py::value_error("expected getAtPath to follow a renamed ancestor");
+    }
+
+    base->childByName("Zone1")->setType("UserDefinedData_t");
+    expectPaths(root->pick().allByType("Zone_t"), "root/Base/Renamed ", "after setType");
+
+    zone2->swap(base->childByName("Zone1"));
+    expectPaths(root->pick().allByName("Field"),
+                "root/Base/Zone1/Field root/Base/Renamed/Field ", "after swap");
+    if (root->treeIndex()->size() != 7) {
+        throw py::value_error("expected 7 indexed nodes after edits, got "
+                              + std::to_string(root->treeIndex()->size()));
+    }
+}
+
+void test_treeIndexAtPath() {
+    auto root = makeTwoZoneTree();
+    TreeIndex& index = root->enableTreeIndex();
+
+    auto field = root->getAtPath("root/Base/Zone1/Field");
+    if (!field || index.atPath("root/Base/Zone1/Field") != field.get()) {
+        throw py::value_error("expected the indexed path of Zone1/Field");
+    }
+    if (root->getAtPath("/root/Base/Zone1/Field") != field || root->getAtPath("Base/Zone1/Field") != field) {
+        throw py::value_error("expected getAtPath to accept a leading slash or omit the root name");
+    }
+    if (index.atPath("root/Base/Zone9") || root->getAtPath("root/Base/Zone9")) {
+        throw py::value_error("expected no node at a missing path");
+    }
+}
+
+void test_treeIndexOwnership() {
+    auto root = makeTwoZoneTree();
+    auto base = root->childByName("Base");
+
+    // an index owned by a subtree is not dropped by indexing an ancestor
+    TreeIndex& baseIndex = base->enableTreeIndex();
+    bool thrown = false;
+    try {
+        root->enableTreeIndex();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    if (!thrown || root->treeIndex() || base->treeIndex() != &baseIndex) {
+        throw py::value_error("expected enableTreeIndex to throw above an index");
+    }
+    base->disableTreeIndex();
+    TreeIndex& index = root->enableTreeIndex();
+    if (&root->enableTreeIndex() != &index || base->treeIndex() != &index) {
+        throw py::value_error("expected one index covering the whole tree");
+    }
+
+    thrown = false;
+    try {
+        base->enableTreeIndex();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    if (!thrown) {
+        throw py::value_error("expected enableTreeIndex to throw below an indexed node");
+    }
+
+    // a detached subtree leaves the index, and may be indexed on its own
+    base->detach();
+    if (base->treeIndex() || index.size() != 2) {
+        throw py::value_error("expected the detached subtree to leave the index");
+    }
+    TreeIndex& detachedIndex = base->enableTreeIndex();
+    if (detachedIndex.size() != 5 || base->pick().allByType("Zone_t").size() != 2) {
+        throw py::value_error("expected the detached subtree to be indexed on its own");
+    }
+
+    // attaching it back requires dropping its own index first
+    thrown = false;
+    try {
+        base->attachTo(root);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    if (!thrown || base->parent().lock() || base->treeIndex() != &detachedIndex || index.size() != 2) {
+        throw py::value_error("expected attachTo to throw, leaving both trees unchanged");
+    }
+    base->disableTreeIndex();
+    base->attachTo(root);
+    if (base->treeIndex() != &index || index.size() != 7) {
+        throw py::value_error("expected the attached subtree to join the index of the tree");
+    }
+
+    root->disableTreeIndex();
+    if (root->treeIndex() || base->treeIndex()) {
+        throw py::value_error("expected disableTreeIndex to unlink every node");
+    }
+    if (root->pick().allByName("Field").size() != 2) {
+        throw py::value_error("expected searches to keep working without index");
+    }
+}
+
+void test_treeIndexKeepsOrderAcrossEdits() {
+    // many attachments at the same place exhaust the free labels and relabel
+    auto root = makeTwoZoneTree();
+    root->enableTreeIndex();
+    auto zone = root->getAtPath("root/Base/Zone0");
+    std::vector<std::shared_ptr<Node>> expected;
+    for (int i = 0; i < 200; ++i) {
+        auto field = newNode("F" + std::to_string(i), "DataArray_t");
+        field->attachTo(zone, static_cast<int16_t>(i % 2 == 0 ? 0 : zone->children().size()));
+        newNode("Field", "DataArray_t")->attachTo(field);
+    }
+    auto base = root->childByName("Base");
+    base->childByName("Zone1")->swap(base->childByName("Zone0"));
+
+    for (const std::string& name : {std::string("Field"), std::string("Zone0")}) {
+        std::vector<std::shared_ptr<Node>> walked;
+        for (const auto& node : root->descendants()) {
+            if (node.get() != root.get() && node->name() == name) {
+                walked.push_back(node);
+            }
+        }
+        expectPaths(root->pick().allByName(name), paths(walked), "pre-order of " + name);
+    }
+    expectPaths(zone->pick().allByName("Field", 1), "root/Base/Zone0/Field ", "depth 1 below Zone0");
+}
@@ -0,0 +1,22 @@
+# ifndef TEST_TREE_INDEX_HPP
+# define TEST_TREE_INDEX_HPP
+
+# include <node/node.hpp>
+# include <node/node_factory.hpp>
+# include <node/tree_index.hpp>
+
+# include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+void test_treeIndexSearches();
+
+void test_treeIndexFollowsEdits();
+
+void test_treeIndexAtPath();
+
+void test_treeIndexOwnership();
+
+void test_treeIndexKeepsOrderAcrossEdits();
+
+# endif
@@ -0,0 +1,18 @@
+# ifndef TEST_TREE_INDEX_PYBIND_HPP
+# define TEST_TREE_INDEX_PYBIND_HPP
+
+# include <pybind11/pybind11.h>
+
+# include "test_tree_index.hpp"
+
+void bindTestsOfTreeIndex(py::module_ &m) {
+    py::module_ sm = m.def_submodule("tree_index");
+
+    sm.def("test_treeIndexSearches", &test_treeIndexSearches);
+    sm.def("test_treeIndexFollowsEdits", &test_treeIndexFollowsEdits);
+    sm.def("test_treeIndexAtPath", &test_treeIndexAtPath);
+    sm.def("test_treeIndexOwnership", &test_treeIndexOwnership);
+    sm.def("test_treeIndexKeepsOrderAcrossEdits", &test_treeIndexKeepsOrderAcrossEdits);
+}
+
+# endif
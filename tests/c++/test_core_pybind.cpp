@@ -10,6 +10,11 @@
 # include "data/data_factory.hpp"
 # include "node/test_data_pybind.hpp"
 # include "node/test_navigation_pybind.hpp"
+# include "node/test_query_pybind.hpp"
+# include "node/test_path_query_pybind.hpp"
+# include "node/test_traversal_pybind.hpp"
+# include "node/test_tree_index_pybind.hpp"
+# include "node/test_tree_diff_pybind.hpp"
 # include "node/test_node_group_pybind.hpp"
 # include "cgns/test_base_tree_pybind.hpp"
 # include "cgns/test_zone_pybind.hpp"
@@ -27,6 +32,22 @@ PYBIND11_MODULE(tests, m) {
                    py::arg("filename")=std::string("test.cgns"));
     io_m.def("test_read", &test_io::test_read, "test read a cgns file",
                    py::arg("tmp_filename")=std::string("test_read.cgns"));
+    io_m.def("test_read_lazy", &test_io::test_read_lazy, "test lazy read of a cgns file",
+                   py::arg("tmp_filename")=std::string("test_read_lazy.cgns"));
+    io_m.def("test_diff_lazy", &test_io::test_diff_lazy, "test diff of lazily read cgns files",
+                   py::arg("tmp_filename")=std::string("test_diff_lazy.cgns"));
+    io_m.def("test_read_filtered", &test_io::test_read_filtered, "test partial read of a cgns file",
+                   py::arg("tmp_filename")=std::string("test_read_filtered.cgns"));
+    io_m.def("test_read_write_slab", &test_io::test_read_write_slab, "test hyperslab read and write",
+                   py::arg("tmp_filename")=std::string("test_read_write_slab.cgns"));
+    io_m.def("test_read_parallel", &test_io::test_read_parallel, "test multithreaded payload read",
+                   py::arg("tmp_filename")=std::string("test_read_parallel.cgns"));
+    io_m.def("test_write_compressed", &test_io::test_write_compressed, "test chunked and compressed write",
+                   py::arg("tmp_filename")=std::string("test_write_compressed.cgns"));
+    io_m.def("test_write_staged_layouts", &test_io::test_write_staged_layouts, "test write of non Fortran-contiguous arrays",
+                   py::arg("tmp_filename")=std::string("test_write_staged_layouts.cgns"));
+    io_m.def("test_write_incremental", &test_io::test_write_incremental, "test incremental write of changed nodes",
+                   py::arg("tmp_filename")=std::string("test_write_incremental.cgns"));
     io_m.def("test_write_link_nodes", &test_io::test_write_link_nodes, "test write cgns links",
                    py::arg("filename")=std::string("test_links.cgns"));
     io_m.def("test_read_links", &test_io::test_read_links, "test read cgns links",
@@ -36,6 +57,11 @@ PYBIND11_MODULE(tests, m) {
     io_m.def("runtime_hdf5_version", &test_io::runtime_hdf5_version, "return linked HDF5 runtime version");
     io_m.def("read_root_hdf5_version", &test_io::read_root_hdf5_version, "read root hdf5version metadata",
                    py::arg("filename"));
+    # ifdef ENABLE_MPI
+    io_m.def("test_write_read_parallel", &test_io::test_write_read_parallel,
+                   "test MPI-parallel write and read (run on MPI_COMM_WORLD)",
+                   py::arg("tmp_filename")=std::string("test_write_read_parallel.cgns"));
+    # endif
 
     # endif 
     io_m.def("test_write_yaml_nodes", &test_io::test_write_yaml_nodes, "test write a yaml file",
@@ -54,6 +80,11 @@ PYBIND11_MODULE(tests, m) {
     bindTestsOfNodeFactory(m);
     bindTestsOfData(m);
     bindTestsOfNavigation(m);
+    bindTestsOfNodeQuery(m);
+    bindTestsOfPathQuery(m);
+    bindTestsOfTraversal(m);
+    bindTestsOfTreeIndex(m);
+    bindTestsOfTreeDiff(m);
     bindTestsOfNodeGroup(m);
     bindTestsOfZone(m);
     bindTestsOfBaseTree(m);
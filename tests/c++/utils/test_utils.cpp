@@ -1,5 +1,7 @@
 # include "test_utils.hpp"
 
+# include <atomic>
+
 void test_stringStartsWith() {
     if (!utils::stringStartsWith("noder", "no")) {
         throw std::runtime_error("stringStartsWith should return true");
@@ -37,3 +39,80 @@ void test_approxEqual() {
         throw std::runtime_error("approxEqual should match equal integers");
     }
 }
+
+void test_globMatch() {
+    const std::vector<std::tuple<std::string, std::string, bool>> cases = {
+        {"Zone1", "Zone1", true},
+        {"Zone1", "Zone", false},
+        {"Zone1", "Zone?", true},
+        {"Zone12", "Zone?", false},
+        {"Zone12", "Zone*", true},
+        {"Zone", "Zone*", true},
+        {"FlowSolution#Init", "*#*", true},
+        {"abcabd", "*ab?", true},
+        {"abcabd", "a*c*d", true},
+        {"abcabe", "a*c*d", false},
+        {"a.b", "a?b", true},
+        {"axb", "a.b", false},
+        {"[x]", "[x]", true},
+        {"", "*", true},
+        {"", "?", false},
+        {"x", "", false},
+    };
+    for (const auto& [text, pattern, expected] : cases) {
+        if (utils::globMatch(text, pattern) != expected) {
+            throw std::runtime_error("globMatch(\"" + text + "\", \"" + pattern + "\") should return "
+                                     + (expected ? "true" : "false"));
+        }
+    }
+}
+
+void test_threadPoolCoversRangeOnce() {
+    utils::ThreadPool pool(4);
+    if (pool.threads() != 4) {
+        throw std::runtime_error("ThreadPool should count the calling thread");
+    }
+    std::vector<std::atomic<int>> visits(1000);
+    std::atomic<size_t> tasks{0};
+    pool.parallelFor(visits.size(), 100, [&](size_t begin, size_t end) {
+        ++tasks;
+        for (size_t i = begin; i < end; ++i) {
+            ++visits[i];
+            // loops started from a task run inline
+            pool.parallelFor(2, 1, [&](size_t, size_t nestedEnd) {
+                if (nestedEnd != 2) {
+                    throw std::runtime_error("nested loops should run as a single range");
+                }
+            });
+        }
+    });
+    for (const std::atomic<int>& count : visits) {
+        if (count != 1) {
+            throw std::runtime_error("parallelFor should visit every item once");
+        }
+    }
+    if (tasks != 4) {
+        throw std::runtime_error("parallelFor should split large loops between the threads");
+    }
+
+    bool rethrown = false;
+    try {
+        pool.parallelFor(visits.size(), 1, [](size_t begin, size_t) {
+            if (begin > 0) {
+                throw std::invalid_argument("failed task");
+            }
+        });
+    } catch (const std::invalid_argument&) {
+        rethrown = true;
+    }
+    if (!rethrown) {
+        throw std::runtime_error("parallelFor should rethrow the exception of a task");
+    }
+
+    pool.setThreads(1);
+    tasks = 0;
+    pool.parallelFor(visits.size(), 1, [&](size_t, size_t) { ++tasks; });
+    if (pool.threads() != 1 || tasks != 1) {
+        throw std::runtime_error("a pool of one thread should run loops on the calling thread");
+    }
+}
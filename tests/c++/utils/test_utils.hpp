@@ -2,13 +2,19 @@
 # define TEST_UTILS_HPP
 
 # include <stdexcept>
+# include <string>
+# include <tuple>
+# include <vector>
 
 # include "utils/string.hpp"
 # include "utils/comparator.hpp"
+# include "utils/thread_pool.hpp"
 
 void test_stringStartsWith();
 void test_stringEndsWith();
 void test_clipStringIfTooLong();
 void test_approxEqual();
+void test_globMatch();
+void test_threadPoolCoversRangeOnce();
 
 # endif
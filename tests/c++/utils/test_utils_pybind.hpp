@@ -12,6 +12,8 @@ void bindTestsOfUtils(py::module_ &m) {
     sm.def("test_stringEndsWith", &test_stringEndsWith);
     sm.def("test_clipStringIfTooLong", &test_clipStringIfTooLong);
     sm.def("test_approxEqual", &test_approxEqual);
+    sm.def("test_globMatch", &test_globMatch);
+    sm.def("test_threadPoolCoversRangeOnce", &test_threadPoolCoversRangeOnce);
 }
 
 # endif
@@ -0,0 +1,74 @@
+import pytest
+import numpy as np
+from noder.core import Array
+
+
+def test_operators():
+    values = np.arange(12, dtype=np.float32).reshape(3, 4)
+    array = Array(values)
+
+    sums = (array + Array(np.arange(4, dtype=np.int16))).getPyArray()
+    assert sums.dtype == np.float32
+    assert np.array_equal(sums, values + np.arange(4, dtype=np.int16))
+
+    assert np.array_equal((1.5 - array).getPyArray(), 1.5 - values)
+    assert np.array_equal((array * values).getPyArray(), values * values)
+    assert np.array_equal((2 / array[1:, :]).getPyArray(), np.float32(2) / values[1:, :])
+
+
+def test_pythonScalarsTakeTheArrayType():
+    integers = Array(np.arange(5, dtype=np.uint8))
+    assert (integers + 1).getPyArray().dtype == np.uint8
+    assert (integers * 1.5).getPyArray().dtype == np.float64
+    assert (Array(np.ones(3, dtype=bool)) + 1).getPyArray().dtype == np.int64
+    assert (integers + np.int16(1)).getPyArray().dtype == np.int16
+    with pytest.raises(OverflowError):
+        integers + 300
+
+
+def test_operationsWithOutput():
+    rho = Array(np.linspace(1.0, 2.0, 100))
+    rhoU = Array(np.linspace(-1.0, 1.0, 100))
+    rhoE = Array(np.linspace(2.5, 5.0, 100))
+
+    # p = (gamma - 1) * (rhoE - rhoU^2 / (2 rho)), written to one array
+    pressure = np.empty(100)
+    rhoU.multiply(rhoU, out=pressure)
+    Array(pressure).divide(rho.multiply(2), out=pressure)
+    rhoE.subtract(pressure, out=pressure)
+    result = Array(pressure).multiply(0.4, out=pressure)
+
+    assert result is pressure
+    expected = 0.4 * (rhoE.getPyArray() - rhoU.getPyArray()**2 / (2 * rho.getPyArray()))
+    assert np.allclose(pressure, expected)
+
+    narrow = np.empty(100, dtype=np.float32)
+    rho.add(rhoU, out=narrow)
+    assert np.allclose(narrow, rho.getPyArray() + rhoU.getPyArray())
+
+
+def test_comparisons():
+    values = np.array([[np.nan, 1.0, 2.0], [3.0, 4.0, 5.0]])
+    array = Array(values)
+
+    less = array.less(np.array([2.0, 2.0, 2.0])).getPyArray()
+    assert less.dtype == bool
+    assert np.array_equal(less, values < 2.0)
+    assert np.array_equal(array.greaterEqual(4).getPyArray(), values >= 4)
+    assert np.array_equal(array.notEqual(array).getPyArray(), values != values)
+
+    counts = np.zeros(3, dtype=np.int32)
+    Array(values[1]).greater(values[0], out=counts)
+    assert np.array_equal(counts, [0, 1, 1])
+
+    assert np.array_equal(array.maximum(3.0).getPyArray(), np.maximum(values, 3.0), equal_nan=True)
+
+
+def test_catchErrorsOfOperandsAndOutput():
+    array = Array(np.arange(3, dtype=np.float64))
+    with pytest.raises(ValueError):
+        array + Array(np.arange(4, dtype=np.float64))
+    with pytest.raises(ValueError):
+        array.add(array, out=np.empty(3, dtype=np.int32))
+    with pytest.raises(ValueError):
+        Array(np.ones(3, dtype=bool)) - Array(np.ones(3, dtype=bool))
@@ -0,0 +1,21 @@
+import pytest
+import noder.tests.array as test_in_cpp
+import noder.array.data_types as dtypes
+
+@pytest.mark.parametrize("dtype", dtypes.scalar_types)
+def test_operateConsideringAllTypes(dtype):
+    return getattr(test_in_cpp,f"operateConsideringAllTypes_{dtype}")()
+
+def test_promoteTypesAsNumPy(): return test_in_cpp.promoteTypesAsNumPy()
+
+def test_broadcastRowsAndColumns(): return test_in_cpp.broadcastRowsAndColumns()
+
+def test_writeToOutputOfAnotherType(): return test_in_cpp.writeToOutputOfAnotherType()
+
+def test_computePressureFromConservativeVariables(): return test_in_cpp.computePressureFromConservativeVariables()
+
+def test_operateOnOverlappingOutput(): return test_in_cpp.operateOnOverlappingOutput()
+
+def test_compareNaN(): return test_in_cpp.compareNaN()
+
+def test_catchErrorsOfOperandsAndOutput(): return test_in_cpp.catchErrorsOfOperandsAndOutput()
@@ -329,3 +329,12 @@ def test_array_print_example():
     array.print(40)
     # docs:end array_print_example
 
+
+@pytest.mark.parametrize("order", ["C", "F", "A"])
+def test_copyInOrder(order):
+    pyarray = np.arange(4 * 5 * 6, dtype=np.float32).reshape(4, 5, 6)[:, ::2, 1:]
+    copied = Array(pyarray).copy(order).getPyArray()
+
+    np.testing.assert_array_equal(copied, pyarray)
+    assert copied.flags.c_contiguous if order != "F" else copied.flags.f_contiguous
+    assert not np.shares_memory(copied, pyarray)
@@ -61,7 +61,11 @@ def test_arrayDifferentToString():
 def test_numericalArrayDifferentToString():
     return test_in_cpp.numericalArrayDifferentToString()
 
+def test_arraySatisfiesValuePredicates():
+    return test_in_cpp.arraySatisfiesValuePredicates()
 
+def test_stringViewMatchesExtractedString():
+    return test_in_cpp.stringViewMatchesExtractedString()
 
-
-
+def test_stridedViewsAreComparedByIndex():
+    return test_in_cpp.stridedViewsAreComparedByIndex()
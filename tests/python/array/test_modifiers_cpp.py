@@ -69,3 +69,11 @@ def test_divideFromArrayConsideringAllTypes(dtype):
     return getattr(test_in_cpp,f"divideFromArrayConsideringAllTypes_{dtype}")()
 
 def test_divideFromArrayToRange(): return test_in_cpp.divideFromArrayToRange()
+
+def test_modifyStridedViews(): return test_in_cpp.modifyStridedViews()
+
+def test_largeArraysAreSharedBetweenThreads(): return test_in_cpp.largeArraysAreSharedBetweenThreads()
+
+@pytest.mark.parametrize("dtype", dtypes.floating_and_integral_types)
+def test_vectorizedKernelsMatchPortableLoops(dtype):
+    return getattr(test_in_cpp,f"vectorizedKernelsMatchPortableLoops_{dtype}")()
@@ -0,0 +1,41 @@
+import pytest
+import numpy as np
+from noder.core import Array, Data
+
+Reduction = Data.Reduction
+
+
+def test_reduce():
+    values = np.arange(24, dtype=np.float32).reshape(2, 3, 4)
+    values[1, 2, 0] = np.nan
+    array = Array(values)
+
+    assert np.isnan(array.reduce(Reduction.Sum).getPyArray()[0])
+    assert array.reduce(Reduction.Sum, skipNaN=True).getPyArray()[0] == np.nansum(values)
+    assert array.reduce(Reduction.ArgMax, skipNaN=True).getPyArray()[0] == np.nanargmax(values)
+
+    maxima = array.reduce(Reduction.Max, axis=1, skipNaN=True).getPyArray()
+    assert maxima.dtype == np.float32
+    assert np.array_equal(maxima, np.nanmax(values, axis=1))
+
+    means = Array(values.T).reduce(Reduction.Mean, axis=0).getPyArray()
+    assert np.allclose(means, values.T.mean(axis=0), equal_nan=True)
+
+    counts = Array(values > 10).reduce(Reduction.Count, axis=2).getPyArray()
+    assert counts.dtype == np.int64 and np.all(counts == 4)
+
+
+def test_reduceIntegers():
+    values = np.arange(-50, 50, dtype=np.int8).reshape(10, 10)
+    array = Array(values)
+
+    sums = array.reduce(Reduction.Sum, axis=0).getPyArray()
+    assert sums.dtype == np.int64
+    assert np.array_equal(sums, values.sum(axis=0))
+    assert array.reduce(Reduction.Norm).getPyArray()[0] == pytest.approx(np.linalg.norm(values))
+    assert array.reduce(Reduction.All).getPyArray()[0] == values.all()
+
+
+def test_catchErrorWhenReducingAlongMissingAxis():
+    with pytest.raises(ValueError):
+        Array(np.zeros((2, 3))).reduce(Reduction.Sum, axis=2)
@@ -0,0 +1,17 @@
+import pytest
+import noder.tests.array as test_in_cpp
+import noder.array.data_types as dtypes
+
+@pytest.mark.parametrize("dtype", dtypes.scalar_types)
+def test_reduceConsideringAllTypes(dtype):
+    return getattr(test_in_cpp,f"reduceConsideringAllTypes_{dtype}")()
+
+def test_reduceAlongEachAxisOfStridedView(): return test_in_cpp.reduceAlongEachAxisOfStridedView()
+
+def test_skipNaN(): return test_in_cpp.skipNaN()
+
+def test_compensatedSumOfFloats(): return test_in_cpp.compensatedSumOfFloats()
+
+def test_reductionsSharedBetweenThreads(): return test_in_cpp.reductionsSharedBetweenThreads()
+
+def test_catchErrorWhenReducingStringsOrNoItems(): return test_in_cpp.catchErrorWhenReducingStringsOrNoItems()
@@ -0,0 +1,15 @@
+import pytest
+import noder.tests.array as test_in_cpp
+import noder.array.data_types as dtypes
+
+@pytest.mark.parametrize("dtype", dtypes.scalar_types)
+def test_copyInOrderConsideringAllTypes(dtype):
+    return getattr(test_in_cpp,f"copyInOrderConsideringAllTypes_{dtype}")()
+
+def test_copyStridedTransposesView(): return test_in_cpp.copyStridedTransposesView()
+
+def test_copyStridedSharedBetweenThreads(): return test_in_cpp.copyStridedSharedBetweenThreads()
+
+def test_copyStridedWithOddItemSize(): return test_in_cpp.copyStridedWithOddItemSize()
+
+def test_catchErrorWhenCopyingInUnknownOrder(): return test_in_cpp.catchErrorWhenCopyingInUnknownOrder()
@@ -2,7 +2,7 @@ import numpy as np
 import pytest
 
 from noder import read
-from noder.core import Node, nodeToPyCGNS, pyCGNSToNode
+from noder.core import Data, Node, nodeToPyCGNS, pyCGNSToNode
 from noder.cgns import (Base, Tree, Zone, add, merge, new_tree, new_base,
                         new_zone_from_arrays, new_zone_from_dict)
 
@@ -207,6 +207,27 @@ def test_new_zone_from_arrays_and_dict():
     assert np.array_equal(zone_from_dict.field("Pressure", behavior_if_not_found="raise"), pressure)
 
 
+
+def test_reduce_field_over_zones():
+    x, y = np.meshgrid(np.arange(3.0), np.arange(2.0), indexing="ij")
+    z = np.zeros_like(x)
+    zone_a = new_zone_from_arrays("BlockA", ["x", "y", "z", "Pressure"], [x, y, z, x + y])
+    zone_b = new_zone_from_arrays("BlockB", ["x", "y", "z", "Pressure"], [x, y, z, 10 * (x - y)])
+    base = new_base("Base", [zone_a, zone_b])
+    pressures = np.concatenate([(x + y).ravel(), (10 * (x - y)).ravel()])
+
+    Reduction = Data.Reduction
+    assert zone_a.reduce_field("Pressure", Reduction.Max) == 3.0
+    assert base.reduce_field("Pressure", Reduction.Min) == pressures.min()
+    assert base.reduce_field("Pressure", Reduction.Max) == pressures.max()
+    assert base.reduce_field("Pressure", Reduction.Mean) == pytest.approx(pressures.mean())
+    assert base.reduce_field("Pressure", Reduction.Norm) == pytest.approx(np.linalg.norm(pressures))
+
+    with pytest.raises(ValueError):
+        base.reduce_field("Pressure", Reduction.ArgMax)
+    with pytest.raises(RuntimeError):
+        base.reduce_field("Density", Reduction.Sum)
+
 def test_add_and_merge_helpers():
     zone_a = make_cart("A")
     zone_b = make_cart("B")
@@ -19,3 +19,7 @@ def test_cpp_new_base_rejects_incoherent_dimensions():
 
 def test_cpp_newZoneFromArrays():
     return test_in_cpp.test_newZoneFromArrays()
+
+
+def test_cpp_reduce_field_over_zones():
+    return test_in_cpp.test_reduce_field_over_zones()
@@ -101,6 +101,229 @@ def test_read(tmp_path):
     assert c is not None
     assert c.data().extractString() == "toto"
 
+def test_read_lazy(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_lazy.hdf5')
+
+    giocpp.test_read_lazy(tmp_filename)
+
+@pytest.mark.parametrize("order", ["C", "F"])
+def test_read_lazy_matches_eager_read(tmp_path, order):
+    from noder import new_node, read
+
+    root = new_node("root", "UserDefinedData_t")
+    root.add_child(new_node("array", "DataArray_t", data=np.arange(6, dtype=np.float64).reshape(2, 3)))
+    root.add_child(new_node("text", "DataArray_t", data="hello"))
+    filename = str(tmp_path / "lazy.cgns")
+    root.write(filename)
+
+    eager = read(filename, order=order)
+    lazy = read(filename, order=order, lazy=True)
+
+    np.testing.assert_array_equal(lazy.get_at_path("root/array").data().getPyArray(),
+                                  eager.get_at_path("root/array").data().getPyArray())
+    assert lazy.get_at_path("root/text").data().extractString() == "hello"
+
+def test_diff_lazy(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_diff_lazy.hdf5')
+
+    giocpp.test_diff_lazy(tmp_filename)
+
+def test_read_filtered(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_filtered.hdf5')
+
+    giocpp.test_read_filtered(tmp_filename)
+
+def test_read_include_exclude_patterns(tmp_path):
+    from noder.core import Node
+
+    tree = _new_cgns_tree()
+    zone = tree.get_at_path("CGNSTree/Base/Zone")
+    for name in ("GridCoordinates", "FlowSolution", "FlowSolution#Init"):
+        container = Node(name, "UserDefinedData_t")
+        container.add_child(Node("Density", "DataArray_t"))
+        zone.add_child(container)
+    filename = str(tmp_path / "filtered.cgns")
+    tree.write(filename)
+
+    root = gio.read(filename, include=["Base/*/FlowSolution*"], exclude=["*/*/*#Init"])
+    base = root.get_at_path("Base")
+    assert [child.name() for child in root.children()] == ["Base"]
+    assert base.data() is None
+    assert [child.name() for child in base.get_at_path("Zone").children()] == ["FlowSolution"]
+
+    shallow = gio.read(filename, max_depth=2)
+    assert shallow.get_at_path("Base/Zone").children() == []
+
+def test_read_write_slab_cpp(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_slab.hdf5')
+
+    giocpp.test_read_write_slab(tmp_filename)
+
+def test_read_and_write_slab(tmp_path):
+    from noder.core import Node
+
+    data = np.arange(24, dtype=np.float64).reshape(2, 3, 4)
+    root = Node("root", "UserDefinedData_t")
+    root.add_child(Node("field", "DataArray_t"))
+    root.get_at_path("root/field").set_data(data)
+    filename = str(tmp_path / "slab.cgns")
+    root.write(filename)
+
+    block = gio.read_slab(filename, "root/field", start=[0, 1, 0], count=[2, 2, 2], stride=[1, 1, 3])
+    np.testing.assert_array_equal(block, data[0:2, 1:3, 0::3])
+
+    gio.write_slab(np.zeros((1, 3, 4)), filename, "root/field", start=[1, 0, 0])
+    expected = data.copy()
+    expected[1] = 0.0
+    np.testing.assert_array_equal(gio.read(filename).get_at_path("root/field").data().getPyArray(), expected)
+
+def test_read_parallel_cpp(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_parallel.hdf5')
+
+    giocpp.test_read_parallel(tmp_filename)
+
+@pytest.mark.parametrize("order", ["C", "F"])
+def test_read_parallel_matches_serial_read(tmp_path, order):
+    from noder.core import Node
+
+    base = Node("Base", "CGNSBase_t")
+    for z in range(8):
+        zone = Node(f"Zone{z}", "Zone_t")
+        zone.attach_to(base)
+        field = Node("Field", "DataArray_t")
+        field.set_data(np.arange(60, dtype=np.float64).reshape(3, 4, 5) + z)
+        field.attach_to(zone)
+    filename = str(tmp_path / "parallel.cgns")
+    base.write(filename)
+
+    serial = gio.read(filename, order=order)
+    parallel = gio.read(filename, order=order, threads=4)
+    for z in range(8):
+        path = f"Base/Zone{z}/Field"
+        expected = serial.get_at_path(path).data().getPyArray()
+        got = parallel.get_at_path(path).data().getPyArray()
+        np.testing.assert_array_equal(got, expected)
+        assert got.flags.c_contiguous == expected.flags.c_contiguous
+
+def test_write_compressed_cpp(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_compressed.hdf5')
+
+    giocpp.test_write_compressed(tmp_filename)
+
+@pytest.mark.parametrize("chunks", [None, [8, 10], "auto"])
+def test_write_compressed_roundtrip(tmp_path, chunks):
+    from noder.core import Node
+
+    data = np.tile(np.linspace(0.0, 1.0, 50), (40, 1))
+    root = Node("root", "UserDefinedData_t")
+    root.add_child(Node("field", "DataArray_t"))
+    root.get_at_path("root/field").set_data(data)
+    plain = str(tmp_path / "plain.cgns")
+    compressed = str(tmp_path / "compressed.cgns")
+    root.write(plain)
+    root.write(compressed, deflate_level=6, shuffle=True, chunks=chunks)
+
+    assert os.path.getsize(compressed) < os.path.getsize(plain)
+    read_back = gio.read(compressed).get_at_path("root/field").data().getPyArray()
+    np.testing.assert_array_equal(read_back, data)
+
+def test_write_incremental_cpp(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_incremental.hdf5')
+
+    giocpp.test_write_incremental(tmp_filename)
+
+def test_write_incremental_checkpoints(tmp_path):
+    from noder.core import Node
+
+    tree = Node("CGNSTree", "CGNSTree_t")
+    base = Node("Base", "CGNSBase_t")
+    base.attach_to(tree)
+    for name in ["CoordinateX", "Density"]:
+        node = Node(name, "DataArray_t")
+        node.set_data(np.linspace(0.0, 1.0, 100))
+        node.attach_to(base)
+    checkpoint = str(tmp_path / "checkpoint.cgns")
+    tree.write(checkpoint, incremental=True)
+
+    density = tree.get_at_path("CGNSTree/Base/Density")
+    for iteration in range(1, 4):
+        density.data().getPyArray()[:] = iteration  # in place, unseen by the cached fingerprint
+        tree.write(checkpoint, incremental=True)
+        read_back = gio.read(checkpoint)
+        np.testing.assert_array_equal(read_back.get_at_path("Base/Density").data().getPyArray(), iteration)
+        np.testing.assert_array_equal(read_back.get_at_path("Base/CoordinateX").data().getPyArray(),
+                                      np.linspace(0.0, 1.0, 100))
+
+def test_write_staged_layouts_cpp(tmp_path):
+    os.makedirs(tmp_path, exist_ok=True)
+    tmp_filename = str(tmp_path/'test_staged_layouts.hdf5')
+
+    giocpp.test_write_staged_layouts(tmp_filename)
+
+@pytest.mark.parametrize("staging_bytes", [8, 512, 4 << 20])
+def test_write_non_fortran_layouts(tmp_path, staging_bytes):
+    from noder.core import Node
+
+    base = np.arange(12 * 7 * 5, dtype=np.float64).reshape(12, 7, 5)
+    arrays = {
+        "fortran": np.asfortranarray(base),
+        "c": base,
+        "strided": base[::3, :, 1::2],
+        "transposed": base.transpose(1, 2, 0),
+    }
+    root = Node("root", "UserDefinedData_t")
+    for name, values in arrays.items():
+        field = Node(name, "DataArray_t")
+        field.set_data(values)
+        field.attach_to(root)
+    filename = str(tmp_path / "layouts.cgns")
+    root.write(filename, staging_bytes=staging_bytes)
+
+    read_back = gio.read(filename)
+    for name, values in arrays.items():
+        got = read_back.get_at_path(f"root/{name}").data().getPyArray()
+        np.testing.assert_array_equal(got, values)
+
+def test_write_rejects_filters_without_chunks(tmp_path):
+    from noder.core import Node
+
+    root = Node("root", "UserDefinedData_t")
+    with pytest.raises(ValueError):
+        root.write(str(tmp_path / "bad.cgns"), deflate_level=1, chunks="contiguous")
+
+def test_lazy_zone_boundary_matches_eager(tmp_path):
+    from noder.core import Node
+    from noder.cgns import Zone
+
+    x, y, z = np.meshgrid(np.linspace(0.0, 1.0, 4), np.linspace(0.0, 2.0, 3),
+                          np.linspace(0.0, 3.0, 2), indexing="ij")
+    zone = Zone("block")
+    coordinates = Node("GridCoordinates", "GridCoordinates_t")
+    for name, values in (("CoordinateX", x), ("CoordinateY", y), ("CoordinateZ", z)):
+        coordinate = Node(name, "DataArray_t")
+        coordinate.set_data(np.asfortranarray(values))
+        coordinates.add_child(coordinate)
+    zone.add_child(coordinates)
+    zone.update_shape()
+    base = Node("Base", "CGNSBase_t")
+    base.add_child(zone)
+    filename = str(tmp_path / "zone.cgns")
+    base.write(filename)
+
+    eager = gio.read(filename).get_at_path("Base/block")
+    lazy = gio.read(filename, lazy=True).get_at_path("Base/block")
+    for bound in ("imin", "jmax", "kmax"):
+        expected = getattr(eager, bound)().get_at_path("GridCoordinates/CoordinateX", True)
+        obtained = getattr(lazy, bound)().get_at_path("GridCoordinates/CoordinateX", True)
+        np.testing.assert_array_equal(obtained.data().getPyArray(), expected.data().getPyArray())
+
 def test_write_nodes_cgns_attrs_layout(tmp_path):
     os.makedirs(tmp_path, exist_ok=True)
     tmp_filename = str(tmp_path/'test_attrs.hdf5')
@@ -0,0 +1,61 @@
+import os
+import shutil
+import subprocess
+import sys
+import pytest
+
+try:
+    import noder.core.io as gio
+    ENABLE_MPI_IO = hasattr(gio, "write_parallel")
+except ImportError:
+    ENABLE_MPI_IO = False
+
+MPIRUN = shutil.which("mpirun") or shutil.which("mpiexec")
+
+pytestmark = [
+    pytest.mark.skipif(not ENABLE_MPI_IO, reason="MPI support not enabled in the build."),
+    pytest.mark.skipif(MPIRUN is None, reason="mpirun not found."),
+]
+
+_WRITE_READ_PARALLEL = """
+import sys
+import numpy as np
+from mpi4py import MPI
+import noder.core.io as gio
+import noder.tests.io as giocpp
+from noder.core import Node
+
+comm = MPI.COMM_WORLD
+filename = sys.argv[1]
+
+giocpp.test_write_read_parallel(filename + ".cpp.cgns")
+
+base = Node("Base", "CGNSBase_t")
+zone = Node(f"Zone{comm.rank:04d}", "Zone_t")
+zone.attach_to(base)
+density = Node("Density", "DataArray_t")
+density.set_data(np.full((3, 4), float(comm.rank)))
+density.attach_to(zone)
+
+for collective in (True, False):
+    gio.write_parallel(base, filename, comm, collective=collective)
+    mine = gio.read_parallel(filename, comm)
+    zones = [child.name() for child in mine.get_at_path("Base").children()]
+    assert zones == [f"Zone{comm.rank:04d}"], zones
+    values = mine.get_at_path(f"Base/Zone{comm.rank:04d}/Density").data().getPyArray()
+    np.testing.assert_array_equal(values, np.full((3, 4), float(comm.rank)))
+    comm.Barrier()
+"""
+
+
+def test_write_read_parallel(tmp_path):
+    pytest.importorskip("mpi4py")
+    filename = str(tmp_path / "parallel.cgns")
+    env = dict(os.environ, OMPI_MCA_rmaps_base_oversubscribe="1")
+
+    subprocess.run(
+        [MPIRUN, "-np", "4", sys.executable, "-c", _WRITE_READ_PARALLEL, filename],
+        check=True,
+        env=env,
+        timeout=300,
+    )
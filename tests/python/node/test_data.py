@@ -40,6 +40,19 @@ def test_data_extract_string_example():
     # docs:end data_extract_string_example
 
 
+def test_data_satisfies_example():
+    # docs:start data_satisfies_example
+    import numpy as np
+    from noder.core import Node, ValuePredicate
+
+    node = Node("temperature")
+    node.set_data(np.array([280.0, 295.5, 310.0]))
+    assert node.data().satisfies(ValuePredicate.between(250.0, 350.0))
+    assert node.data().satisfies(ValuePredicate.greater_than(300.0).any())
+    assert not node.data().satisfies(ValuePredicate.greater_than(300.0))
+    # docs:end data_satisfies_example
+
+
 def test_data_is_scalar():
     node = Node("value")
     node.set_data(12)
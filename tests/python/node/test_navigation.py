@@ -594,6 +594,55 @@ def test_all_by_and_glob():
     assert len(none) == 0
 
 
+def test_all_by_and_parallel():
+    # docs:start all_by_and_parallel_example
+    root = Node("root", "CGNSTree_t")
+    for b in range(4):
+        base = Node(f"Base{b}", "CGNSBase_t")
+        base.attach_to(root)
+        for z in range(20):
+            zone = Node(f"Zone{z}", "Zone_t")
+            zone.attach_to(base)
+            for f in range(z % 5):
+                field = Node(f"Field{f}", "DataArray_t")
+                field.set_data(f"field {f}")
+                field.attach_to(zone)
+
+    serial = root.pick().all_by_and(type="Zone_t")
+    parallel = root.pick().all_by_and_parallel(type="Zone_t", threads=4, grain_size=8)
+    assert len(parallel) == 80
+    assert all(p is s for p, s in zip(parallel, serial))
+
+    serial = root.pick().all_by_and_glob(name="Field*", data="field ?")
+    parallel = root.pick().all_by_and_glob_parallel(name="Field*", data="field ?", threads=3, grain_size=8)
+    assert len(parallel) == len(serial) > 0
+    assert all(p is s for p, s in zip(parallel, serial))
+    # docs:end all_by_and_parallel_example
+
+
+def test_all_by_value():
+    # docs:start all_by_value_example
+    from noder.core import ValuePredicate
+
+    zone = Node("Zone", "Zone_t")
+    for name, values in [("Pressure", [1.0e5, 1.2e5]), ("Density", [1.1, 1.3]), ("Mach", [0.2, 1.4])]:
+        field = Node(name, "DataArray_t")
+        field.set_data(np.array(values))
+        field.attach_to(zone)
+    Node("Label", "Descriptor_t").attach_to(zone)
+    zone.pick().child_by_name("Label").set_data("1.2")
+
+    in_range = zone.pick().all_by_value(ValuePredicate.between(1.0, 2.0))
+    assert [n.name() for n in in_range] == ["Density"]
+
+    above_one = zone.pick().by_value(ValuePredicate.greater_than(1.0).any())
+    assert above_one.name() == "Pressure"
+
+    assert zone.pick().by_value(ValuePredicate.near(0.2, 1e-12).any()).name() == "Mach"
+    assert zone.pick().child_by_name("Mach").data().satisfies(ValuePredicate.at_most(1.4))
+    # docs:end all_by_value_example
+
+
 def test_node_get_and_group_aliases():
     a = Node("a")
     b = Node("b")
@@ -1059,6 +1059,43 @@ def test_descendants_example():
     # docs:end descendants_example
 
 
+
+def test_select_example():
+    # docs:start select_example
+    import numpy as np
+    from noder.core import Node
+
+    tree = Node("CGNSTree", "CGNSTree_t")
+    base = Node("Base", "CGNSBase_t")
+    base.attach_to(tree)
+    for zone_name in ["blk1", "blk2", "wall"]:
+        zone = Node(zone_name, "Zone_t")
+        zone.attach_to(base)
+        solution = Node("FlowSolution", "FlowSolution_t")
+        solution.attach_to(zone)
+        density = Node("Density", "DataArray_t")
+        density.set_data(np.zeros(4))
+        density.attach_to(solution)
+        cells = Node("CellIndex", "DataArray_t")
+        cells.set_data(np.arange(4, dtype=np.int32))
+        cells.attach_to(solution)
+
+    selected = tree.select("CGNSBase_t/Zone_t[name~'blk*']/FlowSolution_t/*[dtype=float64]")
+    assert [n.path() for n in selected] == [
+        "CGNSTree/Base/blk1/FlowSolution/Density",
+        "CGNSTree/Base/blk2/FlowSolution/Density",
+    ]
+    assert len(tree.select("//DataArray_t")) == 6
+    assert len(tree.select("//{2}DataArray_t")) == 0
+    # docs:end select_example
+
+
+def test_select_rejects_malformed_expression():
+    root = Node("root")
+    with pytest.raises(ValueError, match="PathQuery"):
+        root.select("Zone_t[size=3]")
+
+
 def test_merge_example():
     # docs:start merge_example
     from noder.core import Node
@@ -1072,6 +1109,89 @@ def test_merge_example():
     # docs:end merge_example
 
 
+def test_tree_index_example():
+    # docs:start tree_index_example
+    from noder.core import Node
+
+    tree = Node("CGNSTree", "CGNSTree_t")
+    base = Node("Base", "CGNSBase_t")
+    base.attach_to(tree)
+    for zone_name in ["blk1", "blk2"]:
+        Node(zone_name, "Zone_t").attach_to(base)
+
+    tree.enable_tree_index()
+    assert base.has_tree_index()
+
+    # the index follows edits of the tree
+    Node("blk3", "Zone_t").attach_to(base)
+    base.get_at_path("CGNSTree/Base/blk1").set_name("wall")
+    assert [n.name() for n in tree.pick().all_by_type("Zone_t")] == ["wall", "blk2", "blk3"]
+    assert tree.get_at_path("CGNSTree/Base/wall").type() == "Zone_t"
+
+    tree.disable_tree_index()
+    assert not base.has_tree_index()
+    # docs:end tree_index_example
+
+
+def test_tree_diff_example():
+    # docs:start tree_diff_example
+    import numpy as np
+    from noder.core import Node, TreePatch
+
+    run1 = Node("CGNSTree", "CGNSTree_t")
+    for name in ["blk1", "blk2"]:
+        zone = Node(name, "Zone_t")
+        zone.attach_to(run1)
+        pressure = Node("Pressure", "DataArray_t")
+        pressure.set_data(np.linspace(1.0, 2.0, 5))
+        pressure.attach_to(zone)
+
+    run2 = run1.copy(deep=True)
+    run2.get_at_path("CGNSTree/blk1/Pressure").set_data(np.linspace(1.0, 2.0, 5) + 1e-12)
+    run2.get_at_path("CGNSTree/blk2/Pressure").set_data(np.linspace(1.0, 3.0, 5))
+    Node("Density", "DataArray_t").attach_to(run2.get_at_path("CGNSTree/blk2"))
+
+    patch = run1.diff(run2, absolute_tolerance=1e-9)
+    assert [(c.kind, c.path) for c in patch.changes()] == [
+        (TreePatch.Kind.Added, "blk2"),
+        (TreePatch.Kind.DataChanged, "blk2/Pressure"),
+    ]
+
+    run1.apply_patch(patch)
+    assert run1.diff(run2, absolute_tolerance=1e-9).empty()
+    assert TreePatch.from_node(patch.to_node()).changes()[0].subtree.name() == "Density"
+    # docs:end tree_diff_example
+
+
+def test_fingerprint_example():
+    # docs:start fingerprint_example
+    import numpy as np
+    from noder.core import Node
+
+    tree = Node("CGNSTree", "CGNSTree_t")
+    zone = Node("blk1", "Zone_t")
+    zone.attach_to(tree)
+    pressure = Node("Pressure", "DataArray_t")
+    pressure.set_data(np.linspace(1.0, 2.0, 6).reshape((2, 3)))
+    pressure.attach_to(zone)
+
+    reference = tree.fingerprint()
+    copy = tree.copy(deep=True)
+    copy.get_at_path("CGNSTree/blk1/Pressure").set_data(
+        np.asfortranarray(np.linspace(1.0, 2.0, 6).reshape((2, 3))))
+    assert copy.fingerprint() == reference  # same values, other memory layout
+
+    pressure.set_name("P")
+    assert tree.fingerprint() != reference
+    pressure.set_name("Pressure")
+    assert tree.fingerprint() == reference
+
+    pressure.data()[0, 0] = 0.0  # in-place edit, unseen by the cache
+    pressure.invalidate_fingerprint()
+    assert tree.fingerprint() != reference
+    # docs:end fingerprint_example
+
+
 def test_has_link_target_example():
     # docs:start has_link_target_example
     from noder.core import Node
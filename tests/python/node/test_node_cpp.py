@@ -64,6 +64,8 @@ def test_cpp_root(): return test_in_cpp.test_root()
 
 def test_cpp_level(): return test_in_cpp.test_level()
 
+def test_cpp_cachedPlacementFollowsStructure(): return test_in_cpp.test_cachedPlacementFollowsStructure()
+
 @pytest.mark.skipif(os.getenv("ENABLE_CPP_PRINT_TEST") != "1", reason="test_cpp_printTree disabled by default, to enable set ENABLE_CPP_PRINT_TEST=1")
 def test_cpp_printTree(capsys):
     with capsys.disabled():
@@ -110,6 +112,8 @@ def test_cpp_overrideSiblingByName_addChildren(): return test_in_cpp.test_overri
 
 def test_cpp_swap(): return test_in_cpp.test_swap()
 
+def test_cpp_childByNameWithManyChildren(): return test_in_cpp.test_childByNameWithManyChildren()
+
 def test_cpp_copy(): return test_in_cpp.test_copy()
 
 def test_cpp_getAtPath(): return test_in_cpp.test_getAtPath()
@@ -131,12 +135,19 @@ def test_cpp_saveThisNodeOnly(tmp_path):
     filename = str(tmp_path / "save_this_node_only.cgns")
     return test_in_cpp.test_saveThisNodeOnly(filename)
 
+@pytest.mark.skipif(not ENABLE_HDF5_IO, reason="HDF5 support not enabled in the build.")
+def test_cpp_saveThisNodeOnlyInPlace(tmp_path):
+    filename = str(tmp_path / "save_this_node_only_in_place.cgns")
+    return test_in_cpp.test_saveThisNodeOnlyInPlace(filename)
+
 @pytest.mark.skipif(not ENABLE_HDF5_IO, reason="HDF5 support not enabled in the build.")
 def test_cpp_write_example(tmp_path):
     return test_in_cpp.test_write_example(str(tmp_path))
 
 def test_cpp_merge(): return test_in_cpp.test_merge()
 
+def test_cpp_fingerprint(): return test_in_cpp.test_fingerprint()
+
 def test_link_metadata_api():
     node = Node("link")
     assert not node.has_link_target()
@@ -0,0 +1,17 @@
+import noder.tests.path_query as test_in_cpp
+
+
+def test_cpp_selectSteps():
+    return test_in_cpp.test_selectSteps()
+
+
+def test_cpp_selectDescendantAxes():
+    return test_in_cpp.test_selectDescendantAxes()
+
+
+def test_cpp_selectPredicates():
+    return test_in_cpp.test_selectPredicates()
+
+
+def test_cpp_selectMalformedExpressions():
+    return test_in_cpp.test_selectMalformedExpressions()
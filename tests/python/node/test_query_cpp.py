@@ -0,0 +1,21 @@
+import noder.tests.query as test_in_cpp
+
+
+def test_cpp_queryMatchesEveryCriterion():
+    return test_in_cpp.test_queryMatchesEveryCriterion()
+
+
+def test_cpp_queryReusedAcrossTrees():
+    return test_in_cpp.test_queryReusedAcrossTrees()
+
+
+def test_cpp_queryPreOrderAndDepth():
+    return test_in_cpp.test_queryPreOrderAndDepth()
+
+
+def test_cpp_queryDeepTree():
+    return test_in_cpp.test_queryDeepTree()
+
+
+def test_cpp_queryAllParallel():
+    return test_in_cpp.test_queryAllParallel()
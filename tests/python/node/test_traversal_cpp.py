@@ -0,0 +1,17 @@
+import noder.tests.traversal as test_in_cpp
+
+
+def test_cpp_walkOrders():
+    return test_in_cpp.test_walkOrders()
+
+
+def test_cpp_walkSkipChildrenAndStop():
+    return test_in_cpp.test_walkSkipChildrenAndStop()
+
+
+def test_cpp_walkMaxLevel():
+    return test_in_cpp.test_walkMaxLevel()
+
+
+def test_cpp_walkDeepTree():
+    return test_in_cpp.test_walkDeepTree()
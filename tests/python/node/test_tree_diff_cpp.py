@@ -0,0 +1,13 @@
+import noder.tests.tree_diff as test_in_cpp
+
+
+def test_cpp_treeDiffRecordsChanges():
+    return test_in_cpp.test_treeDiffRecordsChanges()
+
+
+def test_cpp_treeDiffComparesPayloads():
+    return test_in_cpp.test_treeDiffComparesPayloads()
+
+
+def test_cpp_treePatchRoundTripsThroughNode():
+    return test_in_cpp.test_treePatchRoundTripsThroughNode()
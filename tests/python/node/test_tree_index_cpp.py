@@ -0,0 +1,21 @@
+import noder.tests.tree_index as test_in_cpp
+
+
+def test_cpp_treeIndexSearches():
+    return test_in_cpp.test_treeIndexSearches()
+
+
+def test_cpp_treeIndexFollowsEdits():
+    return test_in_cpp.test_treeIndexFollowsEdits()
+
+
+def test_cpp_treeIndexAtPath():
+    return test_in_cpp.test_treeIndexAtPath()
+
+
+def test_cpp_treeIndexOwnership():
+    return test_in_cpp.test_treeIndexOwnership()
+
+
+def test_cpp_treeIndexKeepsOrderAcrossEdits():
+    return test_in_cpp.test_treeIndexKeepsOrderAcrossEdits()
@@ -15,3 +15,11 @@ def test_clipStringIfTooLong():
 
 def test_approxEqual():
     return test_in_cpp.test_approxEqual()
+
+
+def test_globMatch():
+    return test_in_cpp.test_globMatch()
+
+
+def test_threadPoolCoversRangeOnce():
+    return test_in_cpp.test_threadPoolCoversRangeOnce()